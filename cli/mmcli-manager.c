@@ -55,7 +55,9 @@ static gboolean get_daemon_version_flag;
 static gboolean list_modems_flag;
 static gboolean monitor_modems_flag;
 static gboolean scan_modems_flag;
+static gboolean get_method_statistics_flag;
 static gchar *set_logging_str;
+static gchar *set_properties_changed_interval_str;
 static gchar *inhibit_device_str;
 static gchar *report_kernel_event_str;
 
@@ -72,6 +74,10 @@ static GOptionEntry entries[] = {
       "Set logging level in the ModemManager daemon",
       "[ERR,WARN,MSG,INFO,DEBUG]",
     },
+    { "set-properties-changed-interval", 0, 0, G_OPTION_ARG_STRING, &set_properties_changed_interval_str,
+      "Set the interval used to batch property updates in the ModemManager daemon, 0 to disable batching",
+      "[Milliseconds]",
+    },
     { "list-modems", 'L', 0, G_OPTION_ARG_NONE, &list_modems_flag,
       "List available modems",
       NULL
@@ -84,6 +90,10 @@ static GOptionEntry entries[] = {
       "Request to re-scan looking for modems",
       NULL
     },
+    { "get-method-statistics", 0, 0, G_OPTION_ARG_NONE, &get_method_statistics_flag,
+      "Get D-Bus method statistics (daemon must run with --debug)",
+      NULL
+    },
     { "inhibit-device", 'I', 0, G_OPTION_ARG_STRING, &inhibit_device_str,
       "Inhibit device given a unique device identifier",
       "[UID]"
@@ -130,7 +140,9 @@ mmcli_manager_options_enabled (void)
                  list_modems_flag +
                  monitor_modems_flag +
                  scan_modems_flag +
+                 get_method_statistics_flag +
                  !!set_logging_str +
+                 !!set_properties_changed_interval_str +
                  !!inhibit_device_str +
                  !!report_kernel_event_str);
 
@@ -143,7 +155,7 @@ mmcli_manager_options_enabled (void)
         exit (EXIT_FAILURE);
     }
 
-    if (get_daemon_version_flag)
+    if (get_daemon_version_flag || get_method_statistics_flag)
         mmcli_force_sync_operation ();
     else if (monitor_modems_flag) {
         if (mmcli_output_get () != MMC_OUTPUT_TYPE_HUMAN) {
@@ -292,6 +304,47 @@ set_logging_ready (MMManager    *manager,
     mmcli_async_operation_done ();
 }
 
+static void
+set_properties_changed_interval_process_reply (gboolean      result,
+                                               const GError *error)
+{
+    if (!result) {
+        g_printerr ("error: couldn't set properties changed interval: '%s'\n",
+                    error ? error->message : "unknown error");
+        exit (EXIT_FAILURE);
+    }
+
+    g_print ("Successfully set properties changed interval\n");
+}
+
+static void
+set_properties_changed_interval_ready (MMManager    *manager,
+                                       GAsyncResult *result,
+                                       gpointer      nothing)
+{
+    gboolean operation_result;
+    GError *error = NULL;
+
+    operation_result = mm_manager_set_properties_changed_interval_finish (manager,
+                                                                          result,
+                                                                          &error);
+    set_properties_changed_interval_process_reply (operation_result, error);
+
+    mmcli_async_operation_done ();
+}
+
+static guint
+parse_properties_changed_interval (void)
+{
+    guint interval;
+
+    if (!mm_get_uint_from_str (set_properties_changed_interval_str, &interval)) {
+        g_printerr ("error: invalid interval value '%s'\n", set_properties_changed_interval_str);
+        exit (EXIT_FAILURE);
+    }
+    return interval;
+}
+
 static void
 scan_devices_process_reply (gboolean      result,
                             const GError *error)
@@ -424,6 +477,16 @@ get_manager_ready (GObject      *source,
         return;
     }
 
+    /* Request to set properties changed interval? */
+    if (set_properties_changed_interval_str) {
+        mm_manager_set_properties_changed_interval (ctx->manager,
+                                                    parse_properties_changed_interval (),
+                                                    ctx->cancellable,
+                                                    (GAsyncReadyCallback)set_properties_changed_interval_ready,
+                                                    NULL);
+        return;
+    }
+
     /* Request to scan modems? */
     if (scan_modems_flag) {
         mm_manager_scan_devices (ctx->manager,
@@ -566,6 +629,30 @@ mmcli_manager_run_synchronous (GDBusConnection *connection)
         return;
     }
 
+    /* Get D-Bus method statistics? */
+    if (get_method_statistics_flag) {
+        MmGdbusDebug *debug;
+        GVariant     *statistics = NULL;
+
+        debug = mm_gdbus_debug_proxy_new_sync (connection,
+                                               G_DBUS_PROXY_FLAGS_DO_NOT_LOAD_PROPERTIES,
+                                               MM_DBUS_SERVICE,
+                                               MM_DBUS_PATH,
+                                               NULL,
+                                               &error);
+        if (!debug || !mm_gdbus_debug_call_get_method_statistics_sync (debug, &statistics, NULL, &error)) {
+            g_printerr ("error: couldn't get method statistics: '%s'\n",
+                        error ? error->message : "unknown error");
+            exit (EXIT_FAILURE);
+        }
+
+        mmcli_output_method_statistics (statistics);
+        mmcli_output_dump ();
+        g_variant_unref (statistics);
+        g_object_unref (debug);
+        return;
+    }
+
     /* Setup operation timeout */
     mmcli_force_operation_timeout (mm_manager_peek_proxy (ctx->manager));
 
@@ -581,6 +668,18 @@ mmcli_manager_run_synchronous (GDBusConnection *connection)
         return;
     }
 
+    /* Request to set properties changed interval? */
+    if (set_properties_changed_interval_str) {
+        gboolean result;
+
+        result = mm_manager_set_properties_changed_interval_sync (ctx->manager,
+                                                                  parse_properties_changed_interval (),
+                                                                  NULL,
+                                                                  &error);
+        set_properties_changed_interval_process_reply (result, error);
+        return;
+    }
+
     /* Request to scan modems? */
     if (scan_modems_flag) {
         gboolean result;
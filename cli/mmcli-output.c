@@ -87,6 +87,7 @@ static SectionInfo section_infos[] = {
     [MMC_S_SMS_PROPERTIES]             = { "Properties"           },
     [MMC_S_SIM_GENERAL]                = { "General"              },
     [MMC_S_SIM_PROPERTIES]             = { "Properties"           },
+    [MMC_S_MANAGER_METHOD_STATISTICS]  = { "Method statistics"    },
 };
 
 /******************************************************************************/
@@ -313,6 +314,8 @@ static FieldInfo field_infos[] = {
     [MMC_F_SIM_PROPERTIES_REMOVABILITY]              = { "sim.properties.removability",                     "removability",             MMC_S_SIM_PROPERTIES,             },
     [MMC_F_SAR_STATE]                                = { "modem.sar.state",                                 "enabled",                  MMC_S_MODEM_SAR,                  },
     [MMC_F_SAR_POWER_LEVEL]                          = { "modem.sar.power-level",                           "power level",              MMC_S_MODEM_SAR,                  },
+    [MMC_F_METHOD_STATISTICS_METHODS]                = { "manager.method-statistics.methods",               "methods",                  MMC_S_MANAGER_METHOD_STATISTICS,  },
+    [MMC_F_METHOD_STATISTICS_OPERATIONS]             = { "manager.method-statistics.operations",            "operations",               MMC_S_MANAGER_METHOD_STATISTICS,  },
     [MMC_F_MODEM_LIST_DBUS_PATH]                     = { "modem-list",                                      "modems",                   MMC_S_UNKNOWN,                    },
     [MMC_F_SMS_LIST_DBUS_PATH]                       = { "modem.messaging.sms",                             "sms messages",             MMC_S_UNKNOWN,                    },
     [MMC_F_CALL_LIST_DBUS_PATH]                      = { "modem.voice.call",                                "calls",                    MMC_S_UNKNOWN,                    },
@@ -1081,6 +1084,102 @@ mmcli_output_cell_info (GList *cell_info_list)
         output_item_new_take_multiple (MMC_F_CELL_INFO, cell_infos, TRUE, FALSE);
 }
 
+/******************************************************************************/
+/* (Custom) Method statistics output */
+
+static gchar *
+build_method_statistics_item (GVariant    *dictionary,
+                              const gchar *name)
+{
+    GString *str;
+    guint32  count = 0;
+    guint32  errors = 0;
+    guint32  p50 = 0;
+    guint32  p99 = 0;
+    guint32  max = 0;
+    guint32  auth_count = 0;
+
+    g_variant_lookup (dictionary, "count",       "u", &count);
+    g_variant_lookup (dictionary, "errors",      "u", &errors);
+    g_variant_lookup (dictionary, "latency-p50", "u", &p50);
+    g_variant_lookup (dictionary, "latency-p99", "u", &p99);
+    g_variant_lookup (dictionary, "latency-max", "u", &max);
+
+    str = g_string_new (NULL);
+    if (selected_type == MMC_OUTPUT_TYPE_HUMAN)
+        g_string_append_printf (str, "%s: count %u, errors %u, latency p50 %uus, p99 %uus, max %uus",
+                                name, count, errors, p50, p99, max);
+    else
+        g_string_append_printf (str, "name: %s, count: %u, errors: %u, latency-p50: %u, latency-p99: %u, latency-max: %u",
+                                name, count, errors, p50, p99, max);
+
+    if (g_variant_lookup (dictionary, "auth-count", "u", &auth_count)) {
+        g_variant_lookup (dictionary, "auth-latency-p50", "u", &p50);
+        g_variant_lookup (dictionary, "auth-latency-p99", "u", &p99);
+        g_variant_lookup (dictionary, "auth-latency-max", "u", &max);
+        if (selected_type == MMC_OUTPUT_TYPE_HUMAN)
+            g_string_append_printf (str, ", auth count %u, auth latency p50 %uus, p99 %uus, max %uus",
+                                    auth_count, p50, p99, max);
+        else
+            g_string_append_printf (str, ", auth-count: %u, auth-latency-p50: %u, auth-latency-p99: %u, auth-latency-max: %u",
+                                    auth_count, p50, p99, max);
+    }
+
+    return g_string_free (str, FALSE);
+}
+
+void
+mmcli_output_method_statistics (GVariant *statistics)
+{
+    GPtrArray     *methods;
+    GPtrArray     *operations;
+    gchar        **methods_strv = NULL;
+    gchar        **operations_strv = NULL;
+    GVariantIter   iter;
+    GVariant      *dictionary;
+
+    methods = g_ptr_array_new ();
+    operations = g_ptr_array_new ();
+
+    g_variant_iter_init (&iter, statistics);
+    while ((dictionary = g_variant_iter_next_value (&iter))) {
+        const gchar *interface = NULL;
+        const gchar *method = NULL;
+        const gchar *operation = NULL;
+
+        if (g_variant_lookup (dictionary, "operation", "&s", &operation))
+            g_ptr_array_add (operations, build_method_statistics_item (dictionary, operation));
+        else if (g_variant_lookup (dictionary, "interface", "&s", &interface) &&
+                 g_variant_lookup (dictionary, "method", "&s", &method)) {
+            g_autofree gchar *name = NULL;
+
+            name = g_strdup_printf ("%s.%s", interface, method);
+            g_ptr_array_add (methods, build_method_statistics_item (dictionary, name));
+        }
+        g_variant_unref (dictionary);
+    }
+
+    if (methods->len) {
+        g_ptr_array_add (methods, NULL);
+        methods_strv = (gchar **) g_ptr_array_free (methods, FALSE);
+    } else
+        g_ptr_array_free (methods, TRUE);
+
+    if (operations->len) {
+        g_ptr_array_add (operations, NULL);
+        operations_strv = (gchar **) g_ptr_array_free (operations, FALSE);
+    } else
+        g_ptr_array_free (operations, TRUE);
+
+    /* When printing human result, we want to show some result even if no
+     * statistics are available, so we force a explicit string result. */
+    if (selected_type == MMC_OUTPUT_TYPE_HUMAN && !methods_strv)
+        output_item_new_take_single (MMC_F_METHOD_STATISTICS_METHODS, g_strdup ("n/a"));
+    else
+        output_item_new_take_multiple (MMC_F_METHOD_STATISTICS_METHODS, methods_strv, TRUE, FALSE);
+    output_item_new_take_multiple (MMC_F_METHOD_STATISTICS_OPERATIONS, operations_strv, TRUE, FALSE);
+}
+
 /******************************************************************************/
 /* Human-friendly output */
 
@@ -83,6 +83,7 @@ typedef enum {
     MMC_S_SMS_PROPERTIES,
     MMC_S_SIM_GENERAL,
     MMC_S_SIM_PROPERTIES,
+    MMC_S_MANAGER_METHOD_STATISTICS,
 } MmcS;
 
 /******************************************************************************/
@@ -331,6 +332,9 @@ typedef enum {
     MMC_F_SIM_PROPERTIES_REMOVABILITY,
     MMC_F_SAR_STATE,
     MMC_F_SAR_POWER_LEVEL,
+    /* Method statistics section */
+    MMC_F_METHOD_STATISTICS_METHODS,
+    MMC_F_METHOD_STATISTICS_OPERATIONS,
     /* Lists */
     MMC_F_MODEM_LIST_DBUS_PATH,
     MMC_F_SMS_LIST_DBUS_PATH,
@@ -400,6 +404,7 @@ void mmcli_output_preferred_networks (GList                     *preferred_nets_
 void mmcli_output_profile_list       (GList                     *profile_list);
 void mmcli_output_profile_set        (MM3gppProfile             *profile);
 void mmcli_output_cell_info          (GList                     *cell_info_list);
+void mmcli_output_method_statistics  (GVariant                  *statistics);
 
 /******************************************************************************/
 /* Dump output */
@@ -448,6 +448,157 @@ mm_manager_set_logging_sync (MMManager     *manager,
 
 /*****************************************************************************/
 
+/**
+ * mm_manager_get_properties_changed_interval:
+ * @manager: A #MMManager.
+ *
+ * Gets the interval used by the daemon to batch property updates together.
+ *
+ * Returns: The interval, in milliseconds, or 0 if batching is disabled.
+ *
+ * Since: 1.22
+ */
+guint
+mm_manager_get_properties_changed_interval (MMManager *manager)
+{
+    g_return_val_if_fail (MM_IS_MANAGER (manager), 0);
+
+    if (!ensure_modem_manager1_proxy (manager, NULL))
+        return 0;
+
+    return mm_gdbus_org_freedesktop_modem_manager1_get_properties_changed_interval (manager->priv->manager_iface_proxy);
+}
+
+/**
+ * mm_manager_set_properties_changed_interval_finish:
+ * @manager: A #MMManager.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to
+ *  mm_manager_set_properties_changed_interval().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with
+ * mm_manager_set_properties_changed_interval().
+ *
+ * Returns: %TRUE if the call succeeded, %FALSE if @error is set.
+ *
+ * Since: 1.22
+ */
+gboolean
+mm_manager_set_properties_changed_interval_finish (MMManager     *manager,
+                                                   GAsyncResult  *res,
+                                                   GError       **error)
+{
+    return g_task_propagate_boolean (G_TASK (res), error);
+}
+
+static void
+set_properties_changed_interval_ready (MmGdbusOrgFreedesktopModemManager1 *manager_iface_proxy,
+                                       GAsyncResult                       *res,
+                                       GTask                              *task)
+{
+    GError *error = NULL;
+
+    if (!mm_gdbus_org_freedesktop_modem_manager1_call_set_properties_changed_interval_finish (
+            manager_iface_proxy,
+            res,
+            &error))
+        g_task_return_error (task, error);
+    else
+        g_task_return_boolean (task, TRUE);
+
+    g_object_unref (task);
+}
+
+/**
+ * mm_manager_set_properties_changed_interval:
+ * @manager: A #MMManager.
+ * @interval: the batching interval, in milliseconds, or 0 to disable batching.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or
+ *  %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously requests the daemon to batch together all the property
+ * updates of each interface done during @interval.
+ *
+ * When the operation is finished, @callback will be invoked in the
+ * <link linkend="g-main-context-push-thread-default">thread-default main loop</link>
+ * of the thread you are calling this method from. You can then call
+ * mm_manager_set_properties_changed_interval_finish() to get the result of the
+ * operation.
+ *
+ * See mm_manager_set_properties_changed_interval_sync() for the synchronous,
+ * blocking version of this method.
+ *
+ * Since: 1.22
+ */
+void
+mm_manager_set_properties_changed_interval (MMManager           *manager,
+                                            guint                interval,
+                                            GCancellable        *cancellable,
+                                            GAsyncReadyCallback  callback,
+                                            gpointer             user_data)
+{
+    GTask *task;
+    GError *inner_error = NULL;
+
+    g_return_if_fail (MM_IS_MANAGER (manager));
+
+    task = g_task_new (manager, cancellable, callback, user_data);
+
+    if (!ensure_modem_manager1_proxy (manager, &inner_error)) {
+        g_task_return_error (task, inner_error);
+        g_object_unref (task);
+        return;
+    }
+
+    mm_gdbus_org_freedesktop_modem_manager1_call_set_properties_changed_interval (
+        manager->priv->manager_iface_proxy,
+        interval,
+        cancellable,
+        (GAsyncReadyCallback)set_properties_changed_interval_ready,
+        task);
+}
+
+/**
+ * mm_manager_set_properties_changed_interval_sync:
+ * @manager: A #MMManager.
+ * @interval: the batching interval, in milliseconds, or 0 to disable batching.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously requests the daemon to batch together all the property
+ * updates of each interface done during @interval.
+ *
+ * The calling thread is blocked until a reply is received.
+ *
+ * See mm_manager_set_properties_changed_interval() for the asynchronous
+ * version of this method.
+ *
+ * Returns: %TRUE if the call succeeded, %FALSE if @error is set.
+ *
+ * Since: 1.22
+ */
+gboolean
+mm_manager_set_properties_changed_interval_sync (MMManager     *manager,
+                                                 guint          interval,
+                                                 GCancellable  *cancellable,
+                                                 GError       **error)
+{
+    g_return_val_if_fail (MM_IS_MANAGER (manager), FALSE);
+
+    if (!ensure_modem_manager1_proxy (manager, error))
+        return FALSE;
+
+    return (mm_gdbus_org_freedesktop_modem_manager1_call_set_properties_changed_interval_sync (
+                manager->priv->manager_iface_proxy,
+                interval,
+                cancellable,
+                error));
+}
+
+/*****************************************************************************/
+
 /**
  * mm_manager_scan_devices_finish:
  * @manager: A #MMManager.
@@ -101,6 +101,21 @@ gboolean mm_manager_set_logging_sync (MMManager     *manager,
                                       GCancellable  *cancellable,
                                       GError       **error);
 
+guint mm_manager_get_properties_changed_interval (MMManager *manager);
+
+void mm_manager_set_properties_changed_interval (MMManager           *manager,
+                                                 guint                interval,
+                                                 GCancellable        *cancellable,
+                                                 GAsyncReadyCallback  callback,
+                                                 gpointer             user_data);
+gboolean mm_manager_set_properties_changed_interval_finish (MMManager     *manager,
+                                                            GAsyncResult  *res,
+                                                            GError       **error);
+gboolean mm_manager_set_properties_changed_interval_sync (MMManager     *manager,
+                                                          guint          interval,
+                                                          GCancellable  *cancellable,
+                                                          GError       **error);
+
 void mm_manager_scan_devices (MMManager           *manager,
                               GCancellable        *cancellable,
                               GAsyncReadyCallback  callback,
@@ -843,6 +843,134 @@ mm_modem_3gpp_scan_sync (MMModem3gpp *self,
 
 /*****************************************************************************/
 
+static GVariant *
+build_scan_settings (guint max_age)
+{
+    GVariantBuilder builder;
+
+    g_variant_builder_init (&builder, G_VARIANT_TYPE ("a{sv}"));
+    g_variant_builder_add (&builder, "{sv}", "max-age", g_variant_new_uint32 (max_age));
+    return g_variant_builder_end (&builder);
+}
+
+/**
+ * mm_modem_3gpp_scan_with_max_age_finish:
+ * @self: A #MMModem3gpp.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to
+ *  mm_modem_3gpp_scan_with_max_age().
+ * @out_timestamp: (out) (allow-none): Return location for the UNIX timestamp,
+ *  in seconds, of the scan that reported the results, or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with mm_modem_3gpp_scan_with_max_age().
+ *
+ * Returns: (transfer full) (element-type ModemManager.Modem3gppNetwork): a list
+ * of #MMModem3gppNetwork structs, or #NULL if @error is set. The returned value
+ * should be freed with g_list_free_full() using mm_modem_3gpp_network_free() as
+ * #GDestroyNotify function.
+ *
+ * Since: 1.22
+ */
+GList *
+mm_modem_3gpp_scan_with_max_age_finish (MMModem3gpp   *self,
+                                        GAsyncResult  *res,
+                                        gint64        *out_timestamp,
+                                        GError       **error)
+{
+    GVariant *result = NULL;
+    gint64    timestamp = 0;
+
+    g_return_val_if_fail (MM_IS_MODEM_3GPP (self), NULL);
+
+    if (!mm_gdbus_modem3gpp_call_scan_with_settings_finish (MM_GDBUS_MODEM3GPP (self), &result, &timestamp, res, error))
+        return NULL;
+
+    if (out_timestamp)
+        *out_timestamp = timestamp;
+    return create_networks_list (result);
+}
+
+/**
+ * mm_modem_3gpp_scan_with_max_age:
+ * @self: A #MMModem3gpp.
+ * @max_age: Maximum age, in seconds, of the results of a previous scan to be
+ *  returned instead of running a new scan. Use 0 to always run a new scan.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or
+ *  %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously requests to scan available 3GPP networks, allowing the
+ * results of a previous scan to be reused.
+ *
+ * When the operation is finished, @callback will be invoked in the
+ * <link linkend="g-main-context-push-thread-default">thread-default main loop</link>
+ * of the thread you are calling this method from. You can then call
+ * mm_modem_3gpp_scan_with_max_age_finish() to get the result of the operation.
+ *
+ * See mm_modem_3gpp_scan_with_max_age_sync() for the synchronous, blocking
+ * version of this method.
+ *
+ * Since: 1.22
+ */
+void
+mm_modem_3gpp_scan_with_max_age (MMModem3gpp         *self,
+                                 guint                max_age,
+                                 GCancellable        *cancellable,
+                                 GAsyncReadyCallback  callback,
+                                 gpointer             user_data)
+{
+    g_return_if_fail (MM_IS_MODEM_3GPP (self));
+
+    mm_gdbus_modem3gpp_call_scan_with_settings (MM_GDBUS_MODEM3GPP (self), build_scan_settings (max_age), cancellable, callback, user_data);
+}
+
+/**
+ * mm_modem_3gpp_scan_with_max_age_sync:
+ * @self: A #MMModem3gpp.
+ * @max_age: Maximum age, in seconds, of the results of a previous scan to be
+ *  returned instead of running a new scan. Use 0 to always run a new scan.
+ * @out_timestamp: (out) (allow-none): Return location for the UNIX timestamp,
+ *  in seconds, of the scan that reported the results, or %NULL.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously requests to scan available 3GPP networks, allowing the
+ * results of a previous scan to be reused.
+ *
+ * The calling thread is blocked until a reply is received. See
+ * mm_modem_3gpp_scan_with_max_age() for the asynchronous version of this
+ * method.
+ *
+ * Returns: (transfer full) (element-type ModemManager.Modem3gppNetwork): a list
+ * of #MMModem3gppNetwork structs, or #NULL if @error is set. The returned value
+ * should be freed with g_list_free_full() using mm_modem_3gpp_network_free() as
+ * #GDestroyNotify function.
+ *
+ * Since: 1.22
+ */
+GList *
+mm_modem_3gpp_scan_with_max_age_sync (MMModem3gpp   *self,
+                                      guint          max_age,
+                                      gint64        *out_timestamp,
+                                      GCancellable  *cancellable,
+                                      GError       **error)
+{
+    GVariant *result = NULL;
+    gint64    timestamp = 0;
+
+    g_return_val_if_fail (MM_IS_MODEM_3GPP (self), NULL);
+
+    if (!mm_gdbus_modem3gpp_call_scan_with_settings_sync (MM_GDBUS_MODEM3GPP (self), build_scan_settings (max_age), &result, &timestamp, cancellable, error))
+        return NULL;
+
+    if (out_timestamp)
+        *out_timestamp = timestamp;
+    return create_networks_list (result);
+}
+
+/*****************************************************************************/
+
 /**
  * mm_modem_3gpp_set_eps_ue_mode_operation_finish:
  * @self: A #MMModem3gpp.
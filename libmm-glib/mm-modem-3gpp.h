@@ -141,6 +141,21 @@ GList *mm_modem_3gpp_scan_sync   (MMModem3gpp *self,
                                   GCancellable *cancellable,
                                   GError **error);
 
+void   mm_modem_3gpp_scan_with_max_age        (MMModem3gpp          *self,
+                                               guint                 max_age,
+                                               GCancellable         *cancellable,
+                                               GAsyncReadyCallback   callback,
+                                               gpointer              user_data);
+GList *mm_modem_3gpp_scan_with_max_age_finish (MMModem3gpp          *self,
+                                               GAsyncResult         *res,
+                                               gint64               *out_timestamp,
+                                               GError              **error);
+GList *mm_modem_3gpp_scan_with_max_age_sync   (MMModem3gpp          *self,
+                                               guint                 max_age,
+                                               gint64               *out_timestamp,
+                                               GCancellable         *cancellable,
+                                               GError              **error);
+
 void     mm_modem_3gpp_set_eps_ue_mode_operation        (MMModem3gpp                    *self,
                                                          MMModem3gppEpsUeModeOperation   mode,
                                                          GCancellable                   *cancellable,
@@ -283,6 +283,224 @@ mm_modem_signal_setup_thresholds_sync (MMModemSignal                *self,
 
 /*****************************************************************************/
 
+/**
+ * mm_modem_signal_setup_history_finish:
+ * @self: A #MMModemSignal.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to
+ *  mm_modem_signal_setup_history().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with mm_modem_signal_setup_history().
+ *
+ * Returns: %TRUE if the setup was successful, %FALSE if @error is set.
+ *
+ * Since: 1.22
+ */
+gboolean
+mm_modem_signal_setup_history_finish (MMModemSignal  *self,
+                                      GAsyncResult   *res,
+                                      GError        **error)
+{
+    g_return_val_if_fail (MM_IS_MODEM_SIGNAL (self), FALSE);
+
+    return mm_gdbus_modem_signal_call_setup_history_finish (MM_GDBUS_MODEM_SIGNAL (self), res, error);
+}
+
+/**
+ * mm_modem_signal_setup_history:
+ * @self: A #MMModemSignal.
+ * @resolution: History resolution, in seconds. Use 0 to disable the history.
+ * @size: Maximum number of samples to keep. Use 0 for the default.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or
+ *  %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously enables or disables the history of extended signal quality
+ * information and cell info kept by the daemon.
+ *
+ * When the operation is finished, @callback will be invoked in the
+ * <link linkend="g-main-context-push-thread-default">thread-default main loop</link>
+ * of the thread you are calling this method from. You can then call
+ * mm_modem_signal_setup_history_finish() to get the result of the operation.
+ *
+ * See mm_modem_signal_setup_history_sync() for the synchronous, blocking
+ * version of this method.
+ *
+ * Since: 1.22
+ */
+void
+mm_modem_signal_setup_history (MMModemSignal       *self,
+                               guint                resolution,
+                               guint                size,
+                               GCancellable        *cancellable,
+                               GAsyncReadyCallback  callback,
+                               gpointer             user_data)
+{
+    g_return_if_fail (MM_IS_MODEM_SIGNAL (self));
+
+    mm_gdbus_modem_signal_call_setup_history (MM_GDBUS_MODEM_SIGNAL (self), resolution, size, cancellable, callback, user_data);
+}
+
+/**
+ * mm_modem_signal_setup_history_sync:
+ * @self: A #MMModemSignal.
+ * @resolution: History resolution, in seconds. Use 0 to disable the history.
+ * @size: Maximum number of samples to keep. Use 0 for the default.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously enables or disables the history of extended signal quality
+ * information and cell info kept by the daemon.
+ *
+ * The calling thread is blocked until a reply is received. See
+ * mm_modem_signal_setup_history() for the asynchronous version of this method.
+ *
+ * Returns: %TRUE if the setup was successful, %FALSE if @error is set.
+ *
+ * Since: 1.22
+ */
+gboolean
+mm_modem_signal_setup_history_sync (MMModemSignal  *self,
+                                    guint           resolution,
+                                    guint           size,
+                                    GCancellable   *cancellable,
+                                    GError        **error)
+{
+    g_return_val_if_fail (MM_IS_MODEM_SIGNAL (self), FALSE);
+
+    return mm_gdbus_modem_signal_call_setup_history_sync (MM_GDBUS_MODEM_SIGNAL (self), resolution, size, cancellable, error);
+}
+
+/*****************************************************************************/
+
+/**
+ * mm_modem_signal_get_history_finish:
+ * @self: A #MMModemSignal.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to
+ *  mm_modem_signal_get_history().
+ * @out_signal: (out) (allow-none) (transfer full): Return location for the
+ *  extended signal quality information samples, or %NULL.
+ * @out_cell_info: (out) (allow-none) (transfer full): Return location for the
+ *  cell info samples, or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with mm_modem_signal_get_history().
+ *
+ * The extended signal quality information samples are given with signature
+ * <literal>"a(xudddd)"</literal> and the cell info samples with signature
+ * <literal>"a(xaa{sv})"</literal>, as described in the
+ * <link linkend="gdbus-method-org-freedesktop-ModemManager1-Modem-Signal.GetHistory">GetHistory()</link>
+ * D-Bus method. The returned values should be freed with g_variant_unref().
+ *
+ * Returns: %TRUE if the history was retrieved, %FALSE if @error is set.
+ *
+ * Since: 1.22
+ */
+gboolean
+mm_modem_signal_get_history_finish (MMModemSignal  *self,
+                                    GAsyncResult   *res,
+                                    GVariant      **out_signal,
+                                    GVariant      **out_cell_info,
+                                    GError        **error)
+{
+    g_autoptr(GVariant) signal_history = NULL;
+    g_autoptr(GVariant) cell_info_history = NULL;
+
+    g_return_val_if_fail (MM_IS_MODEM_SIGNAL (self), FALSE);
+
+    if (!mm_gdbus_modem_signal_call_get_history_finish (MM_GDBUS_MODEM_SIGNAL (self), &signal_history, &cell_info_history, res, error))
+        return FALSE;
+
+    if (out_signal)
+        *out_signal = g_steal_pointer (&signal_history);
+    if (out_cell_info)
+        *out_cell_info = g_steal_pointer (&cell_info_history);
+    return TRUE;
+}
+
+/**
+ * mm_modem_signal_get_history:
+ * @self: A #MMModemSignal.
+ * @since: UNIX timestamp, in seconds. Only samples newer than this are
+ *  returned. Use 0 to get all samples.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or
+ *  %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously retrieves the samples stored in the history configured with
+ * mm_modem_signal_setup_history().
+ *
+ * When the operation is finished, @callback will be invoked in the
+ * <link linkend="g-main-context-push-thread-default">thread-default main loop</link>
+ * of the thread you are calling this method from. You can then call
+ * mm_modem_signal_get_history_finish() to get the result of the operation.
+ *
+ * See mm_modem_signal_get_history_sync() for the synchronous, blocking
+ * version of this method.
+ *
+ * Since: 1.22
+ */
+void
+mm_modem_signal_get_history (MMModemSignal       *self,
+                             gint64               since,
+                             GCancellable        *cancellable,
+                             GAsyncReadyCallback  callback,
+                             gpointer             user_data)
+{
+    g_return_if_fail (MM_IS_MODEM_SIGNAL (self));
+
+    mm_gdbus_modem_signal_call_get_history (MM_GDBUS_MODEM_SIGNAL (self), since, cancellable, callback, user_data);
+}
+
+/**
+ * mm_modem_signal_get_history_sync:
+ * @self: A #MMModemSignal.
+ * @since: UNIX timestamp, in seconds. Only samples newer than this are
+ *  returned. Use 0 to get all samples.
+ * @out_signal: (out) (allow-none) (transfer full): Return location for the
+ *  extended signal quality information samples, or %NULL.
+ * @out_cell_info: (out) (allow-none) (transfer full): Return location for the
+ *  cell info samples, or %NULL.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously retrieves the samples stored in the history configured with
+ * mm_modem_signal_setup_history().
+ *
+ * The calling thread is blocked until a reply is received. See
+ * mm_modem_signal_get_history() for the asynchronous version of this method.
+ *
+ * Returns: %TRUE if the history was retrieved, %FALSE if @error is set.
+ *
+ * Since: 1.22
+ */
+gboolean
+mm_modem_signal_get_history_sync (MMModemSignal  *self,
+                                  gint64          since,
+                                  GVariant      **out_signal,
+                                  GVariant      **out_cell_info,
+                                  GCancellable   *cancellable,
+                                  GError        **error)
+{
+    g_autoptr(GVariant) signal_history = NULL;
+    g_autoptr(GVariant) cell_info_history = NULL;
+
+    g_return_val_if_fail (MM_IS_MODEM_SIGNAL (self), FALSE);
+
+    if (!mm_gdbus_modem_signal_call_get_history_sync (MM_GDBUS_MODEM_SIGNAL (self), since, &signal_history, &cell_info_history, cancellable, error))
+        return FALSE;
+
+    if (out_signal)
+        *out_signal = g_steal_pointer (&signal_history);
+    if (out_cell_info)
+        *out_cell_info = g_steal_pointer (&cell_info_history);
+    return TRUE;
+}
+
+/*****************************************************************************/
+
 /**
  * mm_modem_signal_get_rate:
  * @self: A #MMModemSignal.
@@ -345,6 +563,48 @@ mm_modem_signal_get_error_rate_threshold (MMModemSignal *self)
 
 /*****************************************************************************/
 
+/**
+ * mm_modem_signal_get_history_resolution:
+ * @self: A #MMModemSignal.
+ *
+ * Gets the currently configured history resolution.
+ *
+ * A value of 0 indicates the history is disabled.
+ *
+ * Returns: the history resolution, in seconds.
+ *
+ * Since: 1.22
+ */
+guint
+mm_modem_signal_get_history_resolution (MMModemSignal *self)
+{
+    g_return_val_if_fail (MM_IS_MODEM_SIGNAL (self), 0);
+
+    return mm_gdbus_modem_signal_get_history_resolution (MM_GDBUS_MODEM_SIGNAL (self));
+}
+
+/*****************************************************************************/
+
+/**
+ * mm_modem_signal_get_history_size:
+ * @self: A #MMModemSignal.
+ *
+ * Gets the maximum number of samples kept in the history.
+ *
+ * Returns: the history size.
+ *
+ * Since: 1.22
+ */
+guint
+mm_modem_signal_get_history_size (MMModemSignal *self)
+{
+    g_return_val_if_fail (MM_IS_MODEM_SIGNAL (self), 0);
+
+    return mm_gdbus_modem_signal_get_history_size (MM_GDBUS_MODEM_SIGNAL (self));
+}
+
+/*****************************************************************************/
+
 /**
  * mm_modem_signal_get_cdma:
  * @self: A #MMModem.
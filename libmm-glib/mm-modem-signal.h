@@ -72,6 +72,8 @@ gchar       *mm_modem_signal_dup_path                 (MMModemSignal *self);
 guint        mm_modem_signal_get_rate                 (MMModemSignal *self);
 guint        mm_modem_signal_get_rssi_threshold       (MMModemSignal *self);
 gboolean     mm_modem_signal_get_error_rate_threshold (MMModemSignal *self);
+guint        mm_modem_signal_get_history_resolution   (MMModemSignal *self);
+guint        mm_modem_signal_get_history_size         (MMModemSignal *self);
 
 void     mm_modem_signal_setup                   (MMModemSignal                *self,
                                                   guint                         rate,
@@ -97,6 +99,36 @@ gboolean mm_modem_signal_setup_thresholds_sync   (MMModemSignal                *
                                                   MMSignalThresholdProperties  *properties,
                                                   GCancellable                 *cancellable,
                                                   GError                      **error);
+void     mm_modem_signal_setup_history           (MMModemSignal                *self,
+                                                  guint                         resolution,
+                                                  guint                         size,
+                                                  GCancellable                 *cancellable,
+                                                  GAsyncReadyCallback           callback,
+                                                  gpointer                      user_data);
+gboolean mm_modem_signal_setup_history_finish    (MMModemSignal                *self,
+                                                  GAsyncResult                 *res,
+                                                  GError                      **error);
+gboolean mm_modem_signal_setup_history_sync      (MMModemSignal                *self,
+                                                  guint                         resolution,
+                                                  guint                         size,
+                                                  GCancellable                 *cancellable,
+                                                  GError                      **error);
+void     mm_modem_signal_get_history             (MMModemSignal                *self,
+                                                  gint64                        since,
+                                                  GCancellable                 *cancellable,
+                                                  GAsyncReadyCallback           callback,
+                                                  gpointer                      user_data);
+gboolean mm_modem_signal_get_history_finish      (MMModemSignal                *self,
+                                                  GAsyncResult                 *res,
+                                                  GVariant                    **out_signal,
+                                                  GVariant                    **out_cell_info,
+                                                  GError                      **error);
+gboolean mm_modem_signal_get_history_sync        (MMModemSignal                *self,
+                                                  gint64                        since,
+                                                  GVariant                    **out_signal,
+                                                  GVariant                    **out_cell_info,
+                                                  GCancellable                 *cancellable,
+                                                  GError                      **error);
 
 MMSignal *mm_modem_signal_get_cdma  (MMModemSignal *self);
 MMSignal *mm_modem_signal_peek_cdma (MMModemSignal *self);
@@ -3373,6 +3373,109 @@ mm_modem_get_cell_info_sync (MMModem       *self,
     return create_cell_info_list (result, error);
 }
 
+/**
+ * mm_modem_get_recent_cell_info_finish:
+ * @self: A #MMModem.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to
+ *  mm_modem_get_recent_cell_info().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with mm_modem_get_recent_cell_info().
+ *
+ * Returns: (transfer full) (element-type ModemManager.CellInfo): a list
+ * of #MMCellInfo objects, or #NULL if @error is set. The returned value
+ * should be freed with g_list_free_full() using g_object_unref() as
+ * #GDestroyNotify function.
+ *
+ * Since: 1.22
+ */
+GList *
+mm_modem_get_recent_cell_info_finish (MMModem       *self,
+                                      GAsyncResult  *res,
+                                      GError       **error)
+{
+    GVariant *result = NULL;
+
+    g_return_val_if_fail (MM_IS_MODEM (self), FALSE);
+
+    if (!mm_gdbus_modem_call_get_recent_cell_info_finish (MM_GDBUS_MODEM (self), &result, res, error))
+        return NULL;
+
+    return create_cell_info_list (result, error);
+}
+
+/**
+ * mm_modem_get_recent_cell_info:
+ * @self: A #MMModem.
+ * @max_age: Maximum age of the cell info, in seconds.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or
+ *  %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously requests to get info about serving and neighboring cells,
+ * allowing the daemon to reply with the info it last retrieved from the modem
+ * if it was retrieved less than @max_age seconds ago.
+ *
+ * When the operation is finished, @callback will be invoked in the
+ * <link linkend="g-main-context-push-thread-default">thread-default main loop</link>
+ * of the thread you are calling this method from. You can then call
+ * mm_modem_get_recent_cell_info_finish() to get the result of the operation.
+ *
+ * See mm_modem_get_recent_cell_info_sync() for the synchronous, blocking
+ * version of this method.
+ *
+ * Since: 1.22
+ */
+void
+mm_modem_get_recent_cell_info (MMModem             *self,
+                               guint                max_age,
+                               GCancellable        *cancellable,
+                               GAsyncReadyCallback  callback,
+                               gpointer             user_data)
+{
+    g_return_if_fail (MM_IS_MODEM (self));
+
+    mm_gdbus_modem_call_get_recent_cell_info (MM_GDBUS_MODEM (self), max_age, cancellable, callback, user_data);
+}
+
+/**
+ * mm_modem_get_recent_cell_info_sync:
+ * @self: A #MMModem.
+ * @max_age: Maximum age of the cell info, in seconds.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously requests to get info about serving and neighboring cells,
+ * allowing the daemon to reply with the info it last retrieved from the modem
+ * if it was retrieved less than @max_age seconds ago.
+ *
+ * The calling thread is blocked until a reply is received. See
+ * mm_modem_get_recent_cell_info() for the asynchronous version of this method.
+ *
+ * Returns: (transfer full) (element-type ModemManager.CellInfo): a list
+ * of #MMCellInfo objects, or #NULL if @error is set. The returned value
+ * should be freed with g_list_free_full() using g_object_unref() as
+ * #GDestroyNotify function.
+ *
+ * Since: 1.22
+ */
+GList *
+mm_modem_get_recent_cell_info_sync (MMModem       *self,
+                                    guint          max_age,
+                                    GCancellable  *cancellable,
+                                    GError       **error)
+{
+    GVariant *result = NULL;
+
+    g_return_val_if_fail (MM_IS_MODEM (self), FALSE);
+
+    if (!mm_gdbus_modem_call_get_recent_cell_info_sync (MM_GDBUS_MODEM (self), max_age, &result, cancellable, error))
+        return NULL;
+
+    return create_cell_info_list (result, error);
+}
+
 /*****************************************************************************/
 
 static void
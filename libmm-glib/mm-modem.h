@@ -384,6 +384,19 @@ GList *mm_modem_get_cell_info_sync   (MMModem              *self,
                                       GCancellable         *cancellable,
                                       GError              **error);
 
+void   mm_modem_get_recent_cell_info        (MMModem              *self,
+                                             guint                 max_age,
+                                             GCancellable         *cancellable,
+                                             GAsyncReadyCallback   callback,
+                                             gpointer              user_data);
+GList *mm_modem_get_recent_cell_info_finish (MMModem              *self,
+                                             GAsyncResult         *res,
+                                             GError              **error);
+GList *mm_modem_get_recent_cell_info_sync   (MMModem              *self,
+                                             guint                 max_age,
+                                             GCancellable         *cancellable,
+                                             GError              **error);
+
 G_END_DECLS
 
 #endif /* _MM_MODEM_H_ */
@@ -17,6 +17,7 @@
 
 #include <string.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <endian.h>
 
 #include "log-items.h"
@@ -66,6 +67,51 @@ check_log_item (const char *buf, size_t len, uint16_t log_code, size_t min_len,
 
 /**********************************************************************/
 
+/* Size of the DMCmdLog members covered by its 'len' field */
+#define LOG_ITEM_LEN_HEADER_SIZE (sizeof (DMCmdLog) - offsetof (DMCmdLog, _unknown2))
+
+int
+qcdm_log_item_parse_header (const char *buf,
+                            size_t len,
+                            uint16_t *out_log_code,
+                            uint64_t *out_timestamp,
+                            const char **out_payload,
+                            size_t *out_payload_len)
+{
+    DMCmdLog *log_cmd = (DMCmdLog *) buf;
+    size_t item_len;
+
+    qcdm_return_val_if_fail (buf != NULL, -QCDM_ERROR_INVALID_ARGUMENTS);
+
+    if (len < sizeof (DMCmdLog)) {
+        qcdm_err (0, "DM log item malformed (must be at least %zu bytes in length)", sizeof (DMCmdLog));
+        return -QCDM_ERROR_RESPONSE_MALFORMED;
+    }
+
+    if (buf[0] != DIAG_CMD_LOG)
+        return -QCDM_ERROR_RESPONSE_UNEXPECTED;
+
+    item_len = le16toh (log_cmd->len);
+    if (item_len < LOG_ITEM_LEN_HEADER_SIZE ||
+        item_len > len - offsetof (DMCmdLog, _unknown2)) {
+        qcdm_err (0, "DM log item length invalid (got %zu, available %zu)",
+                  item_len, len - offsetof (DMCmdLog, _unknown2));
+        return -QCDM_ERROR_RESPONSE_BAD_LENGTH;
+    }
+
+    if (out_log_code)
+        *out_log_code = le16toh (log_cmd->log_code);
+    if (out_timestamp)
+        *out_timestamp = le64toh (log_cmd->timestamp);
+    if (out_payload)
+        *out_payload = (const char *) log_cmd->data;
+    if (out_payload_len)
+        *out_payload_len = item_len - LOG_ITEM_LEN_HEADER_SIZE;
+    return QCDM_SUCCESS;
+}
+
+/**********************************************************************/
+
 #define PILOT_SETS_LOG_ACTIVE_SET    "active-set"
 #define PILOT_SETS_LOG_CANDIDATE_SET "candidate-set"
 #define PILOT_SETS_LOG_REMAINING_SET  "remaining-set"
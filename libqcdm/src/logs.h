@@ -23,6 +23,18 @@
 
 /**********************************************************************/
 
+/* Generic log item header parsing. The returned payload points into 'buf',
+ * so it's only valid as long as 'buf' is.
+ */
+int         qcdm_log_item_parse_header                 (const char *buf,
+                                                        size_t len,
+                                                        uint16_t *out_log_code,
+                                                        uint64_t *out_timestamp,
+                                                        const char **out_payload,
+                                                        size_t *out_payload_len);
+
+/**********************************************************************/
+
 enum {
     QCDM_LOG_ITEM_EVDO_PILOT_SETS_V2_TYPE_UNKNOWN = 0,
     QCDM_LOG_ITEM_EVDO_PILOT_SETS_V2_TYPE_ACTIVE = 1,
@@ -20,6 +20,8 @@
 
 #include "result.h"
 
+/* Keys are stored as given, so they must be static strings */
+
 QcdmResult *qcdm_result_new (void);
 
 void qcdm_result_add_string (QcdmResult *result,
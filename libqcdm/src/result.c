@@ -17,6 +17,7 @@
 
 #include <string.h>
 #include <stdlib.h>
+#include <sys/types.h>
 
 #include "result.h"
 #include "result-private.h"
@@ -24,7 +25,16 @@
 
 /*********************************************************/
 
-typedef struct Val Val;
+/* Results are built once while parsing a response and then only read, so all
+ * values are kept in a flat array and all string and array contents in a
+ * single data buffer, both stored inline in the result for the common case.
+ * Keys are always the static QCDM_*_ITEM_* strings, so they're stored as
+ * given (not copied) and compared by pointer before falling back to strcmp().
+ */
+
+#define RESULT_INLINE_VALS 16
+#define RESULT_INLINE_DATA 256
+#define RESULT_DATA_ALIGN  8
 
 typedef enum {
     VAL_TYPE_NONE = 0,
@@ -35,151 +45,30 @@ typedef enum {
     VAL_TYPE_U16_ARRAY = 5,
 } ValType;
 
-struct Val {
-    char *key;
+typedef struct {
+    const char *key;
     uint8_t type;
     union {
-        char *s;
         uint8_t u8;
         uint32_t u32;
-        uint8_t *u8_array;
-        uint16_t *u16_array;
+        size_t offset;  /* into the data buffer, for strings and arrays */
     } u;
     uint32_t array_len;
-    Val *next;
-};
-
-static void
-val_free (Val *v)
-{
-    if (v->type == VAL_TYPE_STRING) {
-        free (v->u.s);
-    } else if (v->type == VAL_TYPE_U8_ARRAY) {
-        free (v->u.u8_array);
-    } else if (v->type == VAL_TYPE_U16_ARRAY) {
-        free (v->u.u16_array);
-    }
-    free (v->key);
-    memset (v, 0, sizeof (*v));
-    free (v);
-}
-
-static Val *
-val_new_string (const char *key, const char *value)
-{
-    Val *v;
-
-    qcdm_return_val_if_fail (key != NULL, NULL);
-    qcdm_return_val_if_fail (key[0] != '\0', NULL);
-    qcdm_return_val_if_fail (value != NULL, NULL);
-
-    v = calloc (sizeof (Val), 1);
-    if (v == NULL)
-        return NULL;
-
-    v->key = strdup (key);
-    v->type = VAL_TYPE_STRING;
-    v->u.s = strdup (value);
-    return v;
-}
-
-static Val *
-val_new_u8 (const char *key, uint8_t u)
-{
-    Val *v;
-
-    qcdm_return_val_if_fail (key != NULL, NULL);
-    qcdm_return_val_if_fail (key[0] != '\0', NULL);
-
-    v = calloc (sizeof (Val), 1);
-    if (v == NULL)
-        return NULL;
-
-    v->key = strdup (key);
-    v->type = VAL_TYPE_U8;
-    v->u.u8 = u;
-    return v;
-}
-
-static Val *
-val_new_u8_array (const char *key, const uint8_t *array, size_t array_len)
-{
-    Val *v;
-
-    qcdm_return_val_if_fail (key != NULL, NULL);
-    qcdm_return_val_if_fail (key[0] != '\0', NULL);
-    qcdm_return_val_if_fail (array != NULL, NULL);
-    qcdm_return_val_if_fail (array_len > 0, NULL);
-
-    v = calloc (sizeof (Val), 1);
-    if (v == NULL)
-        return NULL;
-
-    v->key = strdup (key);
-    v->type = VAL_TYPE_U8_ARRAY;
-    v->u.u8_array = malloc (array_len);
-    if (v->u.u8_array == NULL) {
-        val_free (v);
-        return NULL;
-    }
-    memcpy (v->u.u8_array, array, array_len);
-    v->array_len = array_len;
-
-    return v;
-}
-
-static Val *
-val_new_u32 (const char *key, uint32_t u)
-{
-    Val *v;
-
-    qcdm_return_val_if_fail (key != NULL, NULL);
-    qcdm_return_val_if_fail (key[0] != '\0', NULL);
-
-    v = calloc (sizeof (Val), 1);
-    if (v == NULL)
-        return NULL;
-
-    v->key = strdup (key);
-    v->type = VAL_TYPE_U32;
-    v->u.u32 = u;
-    return v;
-}
-
-static Val *
-val_new_u16_array (const char *key, const uint16_t *array, size_t array_len)
-{
-    Val *v;
-    size_t sz;
+} Val;
 
-    qcdm_return_val_if_fail (key != NULL, NULL);
-    qcdm_return_val_if_fail (key[0] != '\0', NULL);
-    qcdm_return_val_if_fail (array != NULL, NULL);
-    qcdm_return_val_if_fail (array_len > 0, NULL);
-
-    v = calloc (sizeof (Val), 1);
-    if (v == NULL)
-        return NULL;
-
-    v->key = strdup (key);
-    v->type = VAL_TYPE_U16_ARRAY;
-    sz = sizeof (uint16_t) * array_len;
-    v->u.u16_array = malloc (sz);
-    if (v->u.u16_array == NULL) {
-        val_free (v);
-        return NULL;
-    }
-    memcpy (v->u.u16_array, array, sz);
-    v->array_len = array_len;
+struct QcdmResult {
+    uint32_t refcount;
 
-    return v;
-}
+    Val *vals;
+    uint32_t n_vals;
+    uint32_t max_vals;
 
-/*********************************************************/
+    uint8_t *data;
+    size_t data_len;
+    size_t max_data;
 
-struct QcdmResult {
-    uint32_t refcount;
-    Val *first;
+    Val inline_vals[RESULT_INLINE_VALS];
+    uint64_t inline_data[RESULT_INLINE_DATA / sizeof (uint64_t)];
 };
 
 QcdmResult *
@@ -187,9 +76,16 @@ qcdm_result_new (void)
 {
     QcdmResult *r;
 
-    r = calloc (sizeof (QcdmResult), 1);
-    if (r)
+    r = malloc (sizeof (QcdmResult));
+    if (r) {
         r->refcount = 1;
+        r->vals = r->inline_vals;
+        r->n_vals = 0;
+        r->max_vals = RESULT_INLINE_VALS;
+        r->data = (uint8_t *) r->inline_data;
+        r->data_len = 0;
+        r->max_data = sizeof (r->inline_data);
+    }
     return r;
 }
 
@@ -206,14 +102,10 @@ qcdm_result_ref (QcdmResult *r)
 static void
 qcdm_result_free (QcdmResult *r)
 {
-    Val *v, *n;
-
-    v = r->first;
-    while (v) {
-        n = v->next;
-        val_free (v);
-        v = n;
-    }
+    if (r->vals != r->inline_vals)
+        free (r->vals);
+    if (r->data != (uint8_t *) r->inline_data)
+        free (r->data);
     memset (r, 0, sizeof (*r));
     free (r);
 }
@@ -229,20 +121,81 @@ qcdm_result_unref (QcdmResult *r)
         qcdm_result_free (r);
 }
 
+static Val *
+add_val (QcdmResult *r, const char *key, ValType type)
+{
+    Val *v;
+
+    qcdm_return_val_if_fail (key[0] != '\0', NULL);
+
+    if (r->n_vals == r->max_vals) {
+        Val *vals;
+
+        if (r->vals == r->inline_vals) {
+            vals = malloc (sizeof (Val) * r->max_vals * 2);
+            if (vals)
+                memcpy (vals, r->vals, sizeof (Val) * r->n_vals);
+        } else
+            vals = realloc (r->vals, sizeof (Val) * r->max_vals * 2);
+        if (vals == NULL)
+            return NULL;
+        r->vals = vals;
+        r->max_vals *= 2;
+    }
+
+    v = &r->vals[r->n_vals++];
+    v->key = key;
+    v->type = type;
+    v->array_len = 0;
+    return v;
+}
+
+/* Returns the offset of the copied data, or -1 on error */
+static ssize_t
+add_data (QcdmResult *r, const void *data, size_t len)
+{
+    size_t offset;
+
+    offset = (r->data_len + RESULT_DATA_ALIGN - 1) & ~((size_t) RESULT_DATA_ALIGN - 1);
+    if (offset + len > r->max_data) {
+        uint8_t *buf;
+        size_t max_data;
+
+        max_data = r->max_data * 2;
+        while (offset + len > max_data)
+            max_data *= 2;
+
+        if (r->data == (uint8_t *) r->inline_data) {
+            buf = malloc (max_data);
+            if (buf)
+                memcpy (buf, r->data, r->data_len);
+        } else
+            buf = realloc (r->data, max_data);
+        if (buf == NULL)
+            return -1;
+        r->data = buf;
+        r->max_data = max_data;
+    }
+
+    memcpy (r->data + offset, data, len);
+    r->data_len = offset + len;
+    return (ssize_t) offset;
+}
+
 static Val *
 find_val (QcdmResult *r, const char *key, ValType expected_type)
 {
-    Val *v, *n;
+    uint32_t i;
+
+    /* Last added value wins, as keys are not expected to be repeated */
+    for (i = r->n_vals; i > 0; i--) {
+        Val *v = &r->vals[i - 1];
 
-    v = r->first;
-    while (v) {
-        n = v->next;
-        if (strcmp (v->key, key) == 0) {
+        if (v->key == key || strcmp (v->key, key) == 0) {
             /* Check type */
             qcdm_return_val_if_fail (v->type == expected_type, NULL);
             return v;
         }
-        v = n;
     }
     return NULL;
 }
@@ -253,16 +206,18 @@ qcdm_result_add_string (QcdmResult *r,
                        const char *str)
 {
     Val *v;
+    ssize_t offset;
 
     qcdm_return_if_fail (r != NULL);
     qcdm_return_if_fail (r->refcount > 0);
     qcdm_return_if_fail (key != NULL);
     qcdm_return_if_fail (str != NULL);
 
-    v = val_new_string (key, str);
+    offset = add_data (r, str, strlen (str) + 1);
+    qcdm_return_if_fail (offset >= 0);
+    v = add_val (r, key, VAL_TYPE_STRING);
     qcdm_return_if_fail (v != NULL);
-    v->next = r->first;
-    r->first = v;
+    v->u.offset = offset;
 }
 
 int
@@ -282,7 +237,7 @@ qcdm_result_get_string (QcdmResult *r,
     if (v == NULL)
         return -QCDM_ERROR_VALUE_NOT_FOUND;
 
-    *out_val = v->u.s;
+    *out_val = (const char *) (r->data + v->u.offset);
     return 0;
 }
 
@@ -297,10 +252,9 @@ qcdm_result_add_u8 (QcdmResult *r,
     qcdm_return_if_fail (r->refcount > 0);
     qcdm_return_if_fail (key != NULL);
 
-    v = val_new_u8 (key, num);
+    v = add_val (r, key, VAL_TYPE_U8);
     qcdm_return_if_fail (v != NULL);
-    v->next = r->first;
-    r->first = v;
+    v->u.u8 = num;
 }
 
 int
@@ -330,16 +284,20 @@ qcdm_result_add_u8_array (QcdmResult *r,
                           size_t array_len)
 {
     Val *v;
+    ssize_t offset;
 
     qcdm_return_if_fail (r != NULL);
     qcdm_return_if_fail (r->refcount > 0);
     qcdm_return_if_fail (key != NULL);
     qcdm_return_if_fail (array != NULL);
+    qcdm_return_if_fail (array_len > 0);
 
-    v = val_new_u8_array (key, array, array_len);
+    offset = add_data (r, array, array_len);
+    qcdm_return_if_fail (offset >= 0);
+    v = add_val (r, key, VAL_TYPE_U8_ARRAY);
     qcdm_return_if_fail (v != NULL);
-    v->next = r->first;
-    r->first = v;
+    v->u.offset = offset;
+    v->array_len = array_len;
 }
 
 int
@@ -360,7 +318,7 @@ qcdm_result_get_u8_array (QcdmResult *r,
     if (v == NULL)
         return -QCDM_ERROR_VALUE_NOT_FOUND;
 
-    *out_val = v->u.u8_array;
+    *out_val = r->data + v->u.offset;
     *out_len = v->array_len;
     return 0;
 }
@@ -376,10 +334,9 @@ qcdm_result_add_u32 (QcdmResult *r,
     qcdm_return_if_fail (r->refcount > 0);
     qcdm_return_if_fail (key != NULL);
 
-    v = val_new_u32 (key, num);
+    v = add_val (r, key, VAL_TYPE_U32);
     qcdm_return_if_fail (v != NULL);
-    v->next = r->first;
-    r->first = v;
+    v->u.u32 = num;
 }
 
 int
@@ -409,16 +366,20 @@ qcdm_result_add_u16_array (QcdmResult *r,
                            size_t array_len)
 {
     Val *v;
+    ssize_t offset;
 
     qcdm_return_if_fail (r != NULL);
     qcdm_return_if_fail (r->refcount > 0);
     qcdm_return_if_fail (key != NULL);
     qcdm_return_if_fail (array != NULL);
+    qcdm_return_if_fail (array_len > 0);
 
-    v = val_new_u16_array (key, array, array_len);
+    offset = add_data (r, array, sizeof (uint16_t) * array_len);
+    qcdm_return_if_fail (offset >= 0);
+    v = add_val (r, key, VAL_TYPE_U16_ARRAY);
     qcdm_return_if_fail (v != NULL);
-    v->next = r->first;
-    r->first = v;
+    v->u.offset = offset;
+    v->array_len = array_len;
 }
 
 int
@@ -439,7 +400,7 @@ qcdm_result_get_u16_array (QcdmResult *r,
     if (v == NULL)
         return -QCDM_ERROR_VALUE_NOT_FOUND;
 
-    *out_val = v->u.u16_array;
+    *out_val = (const uint16_t *) (r->data + v->u.offset);
     *out_len = v->array_len;
     return 0;
 }
@@ -18,6 +18,7 @@
 #include <stdio.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <stdlib.h>
 #include <malloc.h>
 #include <fcntl.h>
 #include <string.h>
@@ -309,3 +310,192 @@ dm_decapsulate_buffer (const char *inbuf,
     *out_decap_len = unesc_len - 2; /* decap_len should not include the CRC */
     return TRUE;
 }
+
+/*****************************************************************************/
+
+/* Running CRC (before the final complement) of a frame that includes its own
+ * little-endian CRC; any valid frame always ends up with this same value. */
+#define DIAG_CRC_GOOD_RESIDUE 0xF0B8
+
+/* Minimum unescaped frame length: at least one data byte plus the CRC */
+#define DIAG_MIN_FRAME_LEN 3
+
+/**
+ * dm_frame_decoder_init:
+ * @decoder: the decoder to initialize
+ * @max_frame_len: maximum length of an unescaped frame, including its CRC
+ *
+ * Initializes a frame decoder and allocates the buffer where decoded frames
+ * are placed.  The decoder must be released with dm_frame_decoder_clear().
+ *
+ * Returns: QCDM_SUCCESS, or a QCDM_ERROR_* value on failure.
+ **/
+int
+dm_frame_decoder_init (DmFrameDecoder *decoder,
+                       size_t max_frame_len)
+{
+    qcdm_return_val_if_fail (decoder != NULL, -QCDM_ERROR_INVALID_ARGUMENTS);
+    qcdm_return_val_if_fail (max_frame_len >= DIAG_MIN_FRAME_LEN, -QCDM_ERROR_INVALID_ARGUMENTS);
+
+    memset (decoder, 0, sizeof (*decoder));
+    decoder->frame = malloc (max_frame_len);
+    if (!decoder->frame)
+        return -QCDM_ERROR_INVALID_ARGUMENTS;
+    decoder->max_frame_len = max_frame_len;
+    dm_frame_decoder_reset (decoder);
+    return QCDM_SUCCESS;
+}
+
+/**
+ * dm_frame_decoder_reset:
+ * @decoder: a frame decoder
+ *
+ * Discards any partially decoded frame, e.g. after the port is reopened.
+ **/
+void
+dm_frame_decoder_reset (DmFrameDecoder *decoder)
+{
+    qcdm_return_if_fail (decoder != NULL);
+
+    decoder->frame_len = 0;
+    decoder->crc = 0xffff;
+    decoder->escaping = FALSE;
+    decoder->overflow = FALSE;
+    decoder->complete = FALSE;
+}
+
+void
+dm_frame_decoder_clear (DmFrameDecoder *decoder)
+{
+    qcdm_return_if_fail (decoder != NULL);
+
+    free (decoder->frame);
+    memset (decoder, 0, sizeof (*decoder));
+}
+
+static void
+frame_decoder_append (DmFrameDecoder *decoder,
+                      const char *data,
+                      size_t len)
+{
+    uint16_t crc = decoder->crc;
+    size_t i;
+
+    if (decoder->overflow)
+        return;
+
+    if (len > decoder->max_frame_len - decoder->frame_len) {
+        decoder->overflow = TRUE;
+        return;
+    }
+
+    for (i = 0; i < len; i++)
+        crc = crc_table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    decoder->crc = crc;
+
+    memcpy (decoder->frame + decoder->frame_len, data, len);
+    decoder->frame_len += len;
+}
+
+/**
+ * dm_frame_decoder_feed:
+ * @decoder: a frame decoder
+ * @inbuf: data read from the port
+ * @inbuf_len: length of @inbuf
+ * @out_used: on return, amount of data consumed from @inbuf; the caller should
+ *  discard this much data and feed the remaining data again, if any
+ * @out_frame: on DM_FRAME_DECODER_STATUS_FRAME, the decoded frame without the
+ *  CRC; owned by the decoder and valid until the next call to any decoder method
+ * @out_frame_len: on DM_FRAME_DECODER_STATUS_FRAME, the length of @out_frame
+ *
+ * Unescapes and CRC-checks data until the end of a frame is found or until
+ * all the input is consumed.  Frames too short to be valid (e.g. repeated
+ * control characters used as frame start markers) are silently skipped.
+ *
+ * Returns: DM_FRAME_DECODER_STATUS_FRAME if a full valid frame was decoded,
+ *  DM_FRAME_DECODER_STATUS_ERROR if a frame was found but it was malformed, too
+ *  long or the CRC check failed, or DM_FRAME_DECODER_STATUS_NEED_MORE if all
+ *  data was consumed without reaching the end of a frame.
+ **/
+DmFrameDecoderStatus
+dm_frame_decoder_feed (DmFrameDecoder *decoder,
+                       const char *inbuf,
+                       size_t inbuf_len,
+                       size_t *out_used,
+                       const char **out_frame,
+                       size_t *out_frame_len)
+{
+    const char *p = inbuf;
+    const char *end = inbuf + inbuf_len;
+
+    qcdm_return_val_if_fail (decoder != NULL, DM_FRAME_DECODER_STATUS_ERROR);
+    qcdm_return_val_if_fail (decoder->frame != NULL, DM_FRAME_DECODER_STATUS_ERROR);
+    qcdm_return_val_if_fail (inbuf != NULL || inbuf_len == 0, DM_FRAME_DECODER_STATUS_ERROR);
+    qcdm_return_val_if_fail (out_used != NULL, DM_FRAME_DECODER_STATUS_ERROR);
+    qcdm_return_val_if_fail (out_frame != NULL, DM_FRAME_DECODER_STATUS_ERROR);
+    qcdm_return_val_if_fail (out_frame_len != NULL, DM_FRAME_DECODER_STATUS_ERROR);
+
+    *out_used = 0;
+    *out_frame = NULL;
+    *out_frame_len = 0;
+
+    /* The previously returned frame is no longer needed */
+    if (decoder->complete)
+        dm_frame_decoder_reset (decoder);
+
+    while (p < end) {
+        const char *marker;
+        const char *span_end;
+
+        /* Both searches use memchr(), which libc implementations vectorize */
+        marker = memchr (p, DIAG_CONTROL_CHAR, end - p);
+        span_end = marker ? marker : end;
+
+        while (p < span_end) {
+            const char *esc;
+
+            if (decoder->escaping) {
+                char c = *p++ ^ DIAG_ESC_MASK;
+
+                frame_decoder_append (decoder, &c, 1);
+                decoder->escaping = FALSE;
+                continue;
+            }
+
+            esc = memchr (p, DIAG_ESC_CHAR, span_end - p);
+            frame_decoder_append (decoder, p, (esc ? esc : span_end) - p);
+            if (!esc) {
+                p = span_end;
+                break;
+            }
+            decoder->escaping = TRUE;
+            p = esc + 1;
+        }
+
+        if (!marker)
+            break;
+
+        /* Frame end found */
+        p = marker + 1;
+
+        if (!decoder->overflow && !decoder->escaping && decoder->frame_len < DIAG_MIN_FRAME_LEN) {
+            dm_frame_decoder_reset (decoder);
+            continue;
+        }
+
+        *out_used = p - inbuf;
+
+        if (decoder->overflow || decoder->escaping || decoder->crc != DIAG_CRC_GOOD_RESIDUE) {
+            dm_frame_decoder_reset (decoder);
+            return DM_FRAME_DECODER_STATUS_ERROR;
+        }
+
+        decoder->complete = TRUE;
+        *out_frame = decoder->frame;
+        *out_frame_len = decoder->frame_len - 2; /* frame should not include the CRC */
+        return DM_FRAME_DECODER_STATUS_FRAME;
+    }
+
+    *out_used = inbuf_len;
+    return DM_FRAME_DECODER_STATUS_NEED_MORE;
+}
@@ -59,4 +59,41 @@ qcdmbool dm_decapsulate_buffer (const char *inbuf,
                                 size_t *out_used,
                                 qcdmbool *out_need_more);
 
+/* Incremental QCDM frame decoder.
+ *
+ * Data can be fed in chunks of any size as it is read from the port; the
+ * unescaping and CRC state is kept across calls so that each input byte is
+ * processed exactly once, and decoded frames are written into a single buffer
+ * allocated when the decoder is initialized.
+ */
+typedef struct {
+    char *frame;
+    size_t frame_len;
+    size_t max_frame_len;
+    uint16_t crc;
+    qcdmbool escaping;
+    qcdmbool overflow;
+    qcdmbool complete;
+} DmFrameDecoder;
+
+typedef enum {
+    DM_FRAME_DECODER_STATUS_NEED_MORE = 0,
+    DM_FRAME_DECODER_STATUS_FRAME,
+    DM_FRAME_DECODER_STATUS_ERROR,
+} DmFrameDecoderStatus;
+
+int dm_frame_decoder_init (DmFrameDecoder *decoder,
+                           size_t max_frame_len);
+
+void dm_frame_decoder_reset (DmFrameDecoder *decoder);
+
+void dm_frame_decoder_clear (DmFrameDecoder *decoder);
+
+DmFrameDecoderStatus dm_frame_decoder_feed (DmFrameDecoder *decoder,
+                                            const char *inbuf,
+                                            size_t inbuf_len,
+                                            size_t *out_used,
+                                            const char **out_frame,
+                                            size_t *out_frame_len);
+
 #endif  /* LIBQCDM_UTILS_H */
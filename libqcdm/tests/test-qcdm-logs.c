@@ -0,0 +1,65 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * Copyright (C) 2026 The ModemManager authors
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of version 2 of the GNU General Public
+ * License as published by the Free Software Foundation
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <glib.h>
+#include <string.h>
+
+#include "test-qcdm-logs.h"
+#include "logs.h"
+#include "errors.h"
+
+/* EVDO pilot sets v2 log item (0x108B) with a 4-byte payload */
+static const char log_item[] = {
+    0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x8b, 0x10, 0x11, 0x22, 0x33, 0x44,
+    0x55, 0x66, 0x77, 0x00, 0xaa, 0xbb, 0xcc, 0xdd
+};
+
+void
+test_logs_parse_header (void *f, void *data)
+{
+    uint16_t log_code = 0;
+    uint64_t timestamp = 0;
+    const char *payload = NULL;
+    size_t payload_len = 0;
+    int err;
+
+    err = qcdm_log_item_parse_header (log_item, sizeof (log_item),
+                                      &log_code, &timestamp,
+                                      &payload, &payload_len);
+    g_assert_cmpint (err, ==, QCDM_SUCCESS);
+    g_assert_cmpuint (log_code, ==, 0x108B);
+    g_assert_cmpuint (timestamp, ==, G_GUINT64_CONSTANT (0x0077665544332211));
+
+    /* Payload is given as a view into the input buffer */
+    g_assert (payload == &log_item[16]);
+    g_assert_cmpuint (payload_len, ==, 4);
+}
+
+void
+test_logs_parse_header_bad_length (void *f, void *data)
+{
+    int err;
+
+    /* Truncated payload */
+    err = qcdm_log_item_parse_header (log_item, sizeof (log_item) - 1,
+                                      NULL, NULL, NULL, NULL);
+    g_assert_cmpint (err, ==, -QCDM_ERROR_RESPONSE_BAD_LENGTH);
+
+    /* Truncated header */
+    err = qcdm_log_item_parse_header (log_item, 10, NULL, NULL, NULL, NULL);
+    g_assert_cmpint (err, ==, -QCDM_ERROR_RESPONSE_MALFORMED);
+}
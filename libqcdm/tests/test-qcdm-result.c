@@ -90,3 +90,49 @@ test_result_uint8_array (void *f, void *data)
 
     qcdm_result_unref (result);
 }
+
+void
+test_result_many_values (void *f, void *data)
+{
+    static const char *keys[] = {
+        "k00", "k01", "k02", "k03", "k04", "k05", "k06", "k07", "k08", "k09",
+        "k10", "k11", "k12", "k13", "k14", "k15", "k16", "k17", "k18", "k19",
+    };
+    char key[] = "k19";
+    uint16_t array[200];
+    const uint16_t *tmp_array = NULL;
+    size_t tmp_len = 0;
+    const char *tmp_str = NULL;
+    guint32 tmp = 0;
+    QcdmResult *result;
+    guint i;
+
+    for (i = 0; i < G_N_ELEMENTS (array); i++)
+        array[i] = i * 3;
+
+    /* More values and data than the result stores inline */
+    result = qcdm_result_new ();
+    qcdm_result_add_string (result, TEST_TAG, "a");
+    for (i = 0; i < G_N_ELEMENTS (keys); i++)
+        qcdm_result_add_u32 (result, keys[i], i);
+    qcdm_result_add_u16_array (result, "array", array, G_N_ELEMENTS (array));
+
+    for (i = 0; i < G_N_ELEMENTS (keys); i++) {
+        g_assert_cmpint (qcdm_result_get_u32 (result, keys[i], &tmp), ==, 0);
+        g_assert_cmpuint (tmp, ==, i);
+    }
+
+    g_assert_cmpint (qcdm_result_get_string (result, TEST_TAG, &tmp_str), ==, 0);
+    g_assert_cmpstr (tmp_str, ==, "a");
+
+    g_assert_cmpint (qcdm_result_get_u16_array (result, "array", &tmp_array, &tmp_len), ==, 0);
+    g_assert_cmpuint (tmp_len, ==, G_N_ELEMENTS (array));
+    g_assert_cmpint (((gsize) tmp_array) % sizeof (uint16_t), ==, 0);
+    g_assert_cmpint (memcmp (tmp_array, array, sizeof (array)), ==, 0);
+
+    /* Keys given as a different pointer are still found */
+    g_assert_cmpint (qcdm_result_get_u32 (result, key, &tmp), ==, 0);
+    g_assert_cmpuint (tmp, ==, 19);
+
+    qcdm_result_unref (result);
+}
@@ -104,3 +104,110 @@ test_utils_decapsulate_sierra_cns (void *f, void *data)
     g_assert (success == FALSE);
 }
 
+
+void
+test_utils_frame_decoder_chunks (void *f, void *data)
+{
+    DmFrameDecoder decoder;
+    DmFrameDecoderStatus status = DM_FRAME_DECODER_STATUS_NEED_MORE;
+    char decap_outbuf[512];
+    gsize decap_len = 0;
+    gsize used = 0;
+    qcdmbool more = FALSE;
+    const char *frame = NULL;
+    gsize frame_len = 0;
+    char marker = DIAG_CONTROL_CHAR;
+    gsize i;
+
+    g_assert (dm_decapsulate_buffer (decap_inbuf, sizeof (decap_inbuf),
+                                     decap_outbuf, sizeof (decap_outbuf),
+                                     &decap_len, &used, &more));
+
+    g_assert_cmpint (dm_frame_decoder_init (&decoder, 1024), ==, 0);
+
+    /* A leading frame start marker must be ignored */
+    status = dm_frame_decoder_feed (&decoder, &marker, 1, &used, &frame, &frame_len);
+    g_assert_cmpint (status, ==, DM_FRAME_DECODER_STATUS_NEED_MORE);
+    g_assert_cmpuint (used, ==, 1);
+
+    /* Feed the frame one byte at a time */
+    for (i = 0; i < sizeof (decap_inbuf); i++) {
+        status = dm_frame_decoder_feed (&decoder, &decap_inbuf[i], 1, &used, &frame, &frame_len);
+        g_assert_cmpuint (used, ==, 1);
+        if (i < sizeof (decap_inbuf) - 1)
+            g_assert_cmpint (status, ==, DM_FRAME_DECODER_STATUS_NEED_MORE);
+    }
+
+    g_assert_cmpint (status, ==, DM_FRAME_DECODER_STATUS_FRAME);
+    g_assert_cmpuint (frame_len, ==, decap_len);
+    g_assert (memcmp (frame, decap_outbuf, frame_len) == 0);
+
+    dm_frame_decoder_clear (&decoder);
+}
+
+void
+test_utils_frame_decoder_multiple (void *f, void *data)
+{
+    DmFrameDecoder decoder;
+    DmFrameDecoderStatus status;
+    char inbuf[sizeof (decap_inbuf) + sizeof (cns_inbuf) + sizeof (encap_outbuf)];
+    gsize inbuf_len = 0;
+    gsize offset = 0;
+    gsize used = 0;
+    const char *frame = NULL;
+    gsize frame_len = 0;
+
+    /* Valid frame, frame with a bad CRC, valid frame */
+    memcpy (&inbuf[inbuf_len], decap_inbuf, sizeof (decap_inbuf));
+    inbuf_len += sizeof (decap_inbuf);
+    memcpy (&inbuf[inbuf_len], cns_inbuf, sizeof (cns_inbuf));
+    inbuf_len += sizeof (cns_inbuf);
+    memcpy (&inbuf[inbuf_len], encap_outbuf, sizeof (encap_outbuf));
+    inbuf_len += sizeof (encap_outbuf);
+
+    g_assert_cmpint (dm_frame_decoder_init (&decoder, 1024), ==, 0);
+
+    status = dm_frame_decoder_feed (&decoder, &inbuf[offset], inbuf_len - offset, &used, &frame, &frame_len);
+    g_assert_cmpint (status, ==, DM_FRAME_DECODER_STATUS_FRAME);
+    g_assert_cmpuint (used, ==, sizeof (decap_inbuf));
+    g_assert_cmpuint (frame_len, ==, 214);
+    offset += used;
+
+    status = dm_frame_decoder_feed (&decoder, &inbuf[offset], inbuf_len - offset, &used, &frame, &frame_len);
+    g_assert_cmpint (status, ==, DM_FRAME_DECODER_STATUS_ERROR);
+    g_assert_cmpuint (used, ==, sizeof (cns_inbuf));
+    offset += used;
+
+    status = dm_frame_decoder_feed (&decoder, &inbuf[offset], inbuf_len - offset, &used, &frame, &frame_len);
+    g_assert_cmpint (status, ==, DM_FRAME_DECODER_STATUS_FRAME);
+    g_assert_cmpuint (used, ==, sizeof (encap_outbuf));
+    g_assert_cmpuint (frame_len, ==, 4);
+    g_assert (frame[0] == 0x4B);
+    offset += used;
+    g_assert_cmpuint (offset, ==, inbuf_len);
+
+    dm_frame_decoder_clear (&decoder);
+}
+
+void
+test_utils_frame_decoder_overflow (void *f, void *data)
+{
+    DmFrameDecoder decoder;
+    DmFrameDecoderStatus status;
+    gsize used = 0;
+    const char *frame = NULL;
+    gsize frame_len = 0;
+
+    /* Frame longer than the maximum is reported as an error once its end is found */
+    g_assert_cmpint (dm_frame_decoder_init (&decoder, 16), ==, 0);
+    status = dm_frame_decoder_feed (&decoder, decap_inbuf, sizeof (decap_inbuf), &used, &frame, &frame_len);
+    g_assert_cmpint (status, ==, DM_FRAME_DECODER_STATUS_ERROR);
+    g_assert_cmpuint (used, ==, sizeof (decap_inbuf));
+
+    /* And the decoder is usable right away */
+    status = dm_frame_decoder_feed (&decoder, encap_outbuf, sizeof (encap_outbuf), &used, &frame, &frame_len);
+    g_assert_cmpint (status, ==, DM_FRAME_DECODER_STATUS_FRAME);
+    g_assert_cmpuint (frame_len, ==, 4);
+
+    dm_frame_decoder_clear (&decoder);
+}
@@ -23,6 +23,7 @@
 #include "test-qcdm-com.h"
 #include "test-qcdm-result.h"
 #include "test-qcdm-utils.h"
+#include "test-qcdm-logs.h"
 
 typedef struct {
     gpointer com_data;
@@ -86,10 +87,16 @@ int main (int argc, char **argv)
     g_test_suite_add (suite, TESTCASE (test_utils_decapsulate_buffer, NULL));
     g_test_suite_add (suite, TESTCASE (test_utils_encapsulate_buffer, NULL));
     g_test_suite_add (suite, TESTCASE (test_utils_decapsulate_sierra_cns, NULL));
+    g_test_suite_add (suite, TESTCASE (test_utils_frame_decoder_chunks, NULL));
+    g_test_suite_add (suite, TESTCASE (test_utils_frame_decoder_multiple, NULL));
+    g_test_suite_add (suite, TESTCASE (test_utils_frame_decoder_overflow, NULL));
+    g_test_suite_add (suite, TESTCASE (test_logs_parse_header, NULL));
+    g_test_suite_add (suite, TESTCASE (test_logs_parse_header_bad_length, NULL));
     g_test_suite_add (suite, TESTCASE (test_result_string, NULL));
     g_test_suite_add (suite, TESTCASE (test_result_uint32, NULL));
     g_test_suite_add (suite, TESTCASE (test_result_uint8, NULL));
     g_test_suite_add (suite, TESTCASE (test_result_uint8_array, NULL));
+    g_test_suite_add (suite, TESTCASE (test_result_many_values, NULL));
 
     /* Live tests */
     if (port) {
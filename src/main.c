@@ -30,6 +30,8 @@
 #include "mm-log.h"
 #include "mm-base-manager.h"
 #include "mm-context.h"
+#include "mm-modem-helpers.h"
+#include "mm-regex.h"
 
 #if defined WITH_SUSPEND_RESUME
 # include "mm-sleep-monitor.h"
@@ -188,6 +190,12 @@ main (int argc, char *argv[])
     /* Detect runtime charset conversion support */
     mm_modem_charsets_init ();
 
+    /* Compile all known parser regexes in advance, if requested */
+    if (mm_context_get_regex_warm_up ()) {
+        mm_modem_helpers_warm_up ();
+        mm_dbg ("regex registry warmed up: %u patterns compiled", mm_regex_get_n_compilations ());
+    }
+
     /* Acquire name, don't allow replacement */
     name_id = g_bus_own_name (mm_context_get_test_session () ? G_BUS_TYPE_SESSION : G_BUS_TYPE_SYSTEM,
                               MM_DBUS_SERVICE,
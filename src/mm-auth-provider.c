@@ -22,6 +22,7 @@
 #include "mm-log-object.h"
 #include "mm-utils.h"
 #include "mm-auth-provider.h"
+#include "mm-method-stats.h"
 
 #if defined WITH_POLKIT
 # include <polkit/polkit.h>
@@ -59,6 +60,7 @@ typedef struct {
     PolkitSubject         *subject;
     gchar                 *authorization;
     GDBusMethodInvocation *invocation;
+    gint64                 start_time;
 } AuthorizeContext;
 
 static void
@@ -85,6 +87,10 @@ check_authorization_ready (PolkitAuthority *authority,
     }
 
     ctx = g_task_get_task_data (task);
+    mm_method_stats_record_auth (mm_method_stats_get (),
+                                 ctx->invocation,
+                                 g_get_monotonic_time () - ctx->start_time);
+
     pk_result = polkit_authority_check_authorization_finish (authority, res, &error);
     if (!pk_result) {
         g_task_return_new_error (task,
@@ -144,6 +150,7 @@ mm_auth_provider_authorize (MMAuthProvider        *self,
 
         ctx = g_new (AuthorizeContext, 1);
         ctx->invocation = g_object_ref (invocation);
+        ctx->start_time = g_get_monotonic_time ();
         ctx->authorization = g_strdup (authorization);
         ctx->subject = polkit_system_bus_name_new (g_dbus_method_invocation_get_sender (ctx->invocation));
         g_task_set_task_data (task, ctx, (GDestroyNotify)authorize_context_free);
@@ -48,9 +48,11 @@
 
 #define BEARER_STATS_UPDATE_TIMEOUT 30
 
-/* Initial connectivity check after 30s, then each 5s */
+/* Initial connectivity check after 30s, then after 5s, backing off
+ * exponentially up to one check every 60s */
 #define BEARER_CONNECTION_MONITOR_INITIAL_TIMEOUT 30
 #define BEARER_CONNECTION_MONITOR_TIMEOUT          5
+#define BEARER_CONNECTION_MONITOR_TIMEOUT_MAX     60
 
 static void log_object_iface_init (MMLogObjectInterface *iface);
 
@@ -101,6 +103,7 @@ struct _MMBaseBearerPrivate {
 
     /* Connection status monitoring */
     guint connection_monitor_id;
+    guint connection_monitor_timeout;
     /* Flag to specify whether connection monitoring is supported or not */
     gboolean load_connection_status_unsupported;
 
@@ -197,30 +200,24 @@ load_connection_status_ready (MMBaseBearer *self,
 static gboolean
 connection_monitor_cb (MMBaseBearer *self)
 {
-    /* If the implementation knows how to load connection status, run it */
-    if (self->priv->status == MM_BEARER_STATUS_CONNECTED)
-        MM_BASE_BEARER_GET_CLASS (self)->load_connection_status (
-            self,
-            (GAsyncReadyCallback)load_connection_status_ready,
-            NULL);
-    return G_SOURCE_CONTINUE;
-}
+    self->priv->connection_monitor_id = 0;
 
-static gboolean
-initial_connection_monitor_cb (MMBaseBearer *self)
-{
+    /* If the implementation knows how to load connection status, run it */
     if (self->priv->status == MM_BEARER_STATUS_CONNECTED)
         MM_BASE_BEARER_GET_CLASS (self)->load_connection_status (
             self,
             (GAsyncReadyCallback)load_connection_status_ready,
             NULL);
 
-    /* Add new monitor timeout at a higher rate */
-    self->priv->connection_monitor_id = g_timeout_add_seconds (BEARER_CONNECTION_MONITOR_TIMEOUT,
+    /* Polling is only a fallback when the implementation cannot rely on
+     * indications to report disconnections (e.g. if unsupported, the
+     * monitoring is stopped as soon as the load operation reports so), so
+     * back off exponentially to limit the amount of wakeups */
+    self->priv->connection_monitor_id = g_timeout_add_seconds (self->priv->connection_monitor_timeout,
                                                                (GSourceFunc) connection_monitor_cb,
                                                                self);
-
-    /* Remove the initial connection monitor timeout as we added a new one */
+    self->priv->connection_monitor_timeout = MIN (self->priv->connection_monitor_timeout * 2,
+                                                  BEARER_CONNECTION_MONITOR_TIMEOUT_MAX);
     return G_SOURCE_REMOVE;
 }
 
@@ -237,8 +234,9 @@ connection_monitor_start (MMBaseBearer *self)
 
     /* Schedule initial check */
     g_assert (!self->priv->connection_monitor_id);
+    self->priv->connection_monitor_timeout = BEARER_CONNECTION_MONITOR_TIMEOUT;
     self->priv->connection_monitor_id = g_timeout_add_seconds (BEARER_CONNECTION_MONITOR_INITIAL_TIMEOUT,
-                                                               (GSourceFunc) initial_connection_monitor_cb,
+                                                               (GSourceFunc) connection_monitor_cb,
                                                                self);
 }
 
@@ -557,8 +555,11 @@ bearer_update_status (MMBaseBearer *self,
         self->priv->ignore_disconnection_reports = FALSE;
         /* Stop statistics */
         bearer_stats_stop (self);
-        /* Stop connection monitoring */
+        /* Stop connection monitoring; whether it is required is evaluated
+         * again in the next connection, as the availability of indications
+         * may have changed (e.g. +CGEV reporting enabled or disabled) */
         connection_monitor_stop (self);
+        self->priv->load_connection_status_unsupported = FALSE;
 
         /* Build and log report */
         report = g_string_new (NULL);
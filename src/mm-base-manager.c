@@ -55,6 +55,8 @@
 #include "mm-filter.h"
 #include "mm-log-object.h"
 #include "mm-base-modem.h"
+#include "mm-properties-batcher.h"
+#include "mm-method-stats.h"
 
 static void initable_iface_init   (GInitableIface       *iface);
 static void log_object_iface_init (MMLogObjectInterface *iface);
@@ -104,6 +106,8 @@ struct _MMBaseManagerPrivate {
     GDBusObjectManagerServer *object_manager;
     /* The map of inhibited devices */
     GHashTable *inhibited_devices;
+    /* The Debug interface support */
+    MmGdbusDebug *debug_skeleton;
 
 #if defined WITH_TESTS
     /* Whether the test interface is enabled */
@@ -739,41 +743,85 @@ mm_base_manager_num_modems (MMBaseManager *self)
 
 #if defined WITH_SUSPEND_RESUME
 
+/* Tracks the synchronization of all modems after a resume, in order to report
+ * the overall resume-to-usable latency */
+typedef struct {
+    MMBaseManager *self;
+    guint          n_pending;
+    guint          n_failed;
+    GTimer        *timer;
+} SyncAllContext;
+
 static void
-base_modem_sync_ready (MMBaseModem  *self,
-                       GAsyncResult *res,
-                       gpointer      user_data)
+sync_all_context_free (SyncAllContext *ctx)
+{
+    g_object_unref (ctx->self);
+    g_timer_destroy (ctx->timer);
+    g_slice_free (SyncAllContext, ctx);
+}
+
+static void
+base_modem_sync_ready (MMBaseModem    *self,
+                       GAsyncResult   *res,
+                       SyncAllContext *ctx)
 {
     g_autoptr(GError) error = NULL;
 
     mm_base_modem_sync_finish (self, res, &error);
     if (error) {
         mm_obj_warn (self, "synchronization failed: %s", error->message);
+        ctx->n_failed++;
+    } else
+        mm_obj_msg (self, "synchronization finished");
+
+    g_assert (ctx->n_pending > 0);
+    if (--ctx->n_pending > 0)
         return;
-    }
-    mm_obj_msg (self, "synchronization finished");
+
+    mm_obj_msg (ctx->self, "synchronization of all modems finished in %.3lf seconds (%u failed)",
+                g_timer_elapsed (ctx->timer, NULL), ctx->n_failed);
+    mm_method_stats_record_operation (mm_method_stats_get (),
+                                      "resume-sync",
+                                      (gint64) (g_timer_elapsed (ctx->timer, NULL) * G_USEC_PER_SEC),
+                                      ctx->n_failed > 0);
+    sync_all_context_free (ctx);
 }
 
 void
 mm_base_manager_sync (MMBaseManager *self)
 {
-    GHashTableIter iter;
-    gpointer       key, value;
+    GHashTableIter  iter;
+    gpointer        key, value;
+    GList          *modems = NULL;
+    GList          *l;
+    SyncAllContext *ctx;
 
     g_return_if_fail (self != NULL);
     g_return_if_fail (MM_IS_BASE_MANAGER (self));
 
-    /* Refresh each device */
     g_hash_table_iter_init (&iter, self->priv->devices);
     while (g_hash_table_iter_next (&iter, &key, &value)) {
         MMBaseModem *modem;
 
         modem = mm_device_peek_modem (MM_DEVICE (value));
-
-        /* We just want to start the synchronization, we don't need the result */
         if (modem)
-            mm_base_modem_sync (modem, (GAsyncReadyCallback)base_modem_sync_ready, NULL);
+            modems = g_list_prepend (modems, g_object_ref (modem));
     }
+
+    if (!modems)
+        return;
+
+    ctx = g_slice_new0 (SyncAllContext);
+    ctx->self = g_object_ref (self);
+    ctx->n_pending = g_list_length (modems);
+    ctx->timer = g_timer_new ();
+
+    /* Refresh each device; modems are synchronized concurrently, and each one
+     * applies its own deadline */
+    for (l = modems; l; l = g_list_next (l))
+        mm_base_modem_sync (MM_BASE_MODEM (l->data), (GAsyncReadyCallback)base_modem_sync_ready, ctx);
+
+    g_list_free_full (modems, g_object_unref);
 }
 
 #endif
@@ -838,6 +886,70 @@ handle_set_logging (MmGdbusOrgFreedesktopModemManager1 *manager,
     return TRUE;
 }
 
+/*****************************************************************************/
+/* Set properties changed interval */
+
+typedef struct {
+    MMBaseManager *self;
+    GDBusMethodInvocation *invocation;
+    guint interval;
+} SetPropertiesChangedIntervalContext;
+
+static void
+set_properties_changed_interval_context_free (SetPropertiesChangedIntervalContext *ctx)
+{
+    g_object_unref (ctx->invocation);
+    g_object_unref (ctx->self);
+    g_free (ctx);
+}
+
+static void
+set_properties_changed_interval_auth_ready (MMAuthProvider                      *authp,
+                                            GAsyncResult                        *res,
+                                            SetPropertiesChangedIntervalContext *ctx)
+{
+    GError *error = NULL;
+
+    if (!mm_auth_provider_authorize_finish (authp, res, &error))
+        g_dbus_method_invocation_take_error (ctx->invocation, error);
+    else if (ctx->interval > MM_PROPERTIES_BATCHER_INTERVAL_MAX)
+        g_dbus_method_invocation_return_error (ctx->invocation, MM_CORE_ERROR, MM_CORE_ERROR_INVALID_ARGS,
+                                               "Invalid interval: %u ms (maximum %u ms)",
+                                               ctx->interval, MM_PROPERTIES_BATCHER_INTERVAL_MAX);
+    else {
+        mm_properties_batcher_set_interval (mm_properties_batcher_get (), ctx->interval);
+        mm_gdbus_org_freedesktop_modem_manager1_set_properties_changed_interval (
+            MM_GDBUS_ORG_FREEDESKTOP_MODEM_MANAGER1 (ctx->self),
+            ctx->interval);
+        mm_gdbus_org_freedesktop_modem_manager1_complete_set_properties_changed_interval (
+            MM_GDBUS_ORG_FREEDESKTOP_MODEM_MANAGER1 (ctx->self),
+            ctx->invocation);
+    }
+
+    set_properties_changed_interval_context_free (ctx);
+}
+
+static gboolean
+handle_set_properties_changed_interval (MmGdbusOrgFreedesktopModemManager1 *manager,
+                                        GDBusMethodInvocation *invocation,
+                                        guint interval)
+{
+    SetPropertiesChangedIntervalContext *ctx;
+
+    ctx = g_new0 (SetPropertiesChangedIntervalContext, 1);
+    ctx->self = MM_BASE_MANAGER (g_object_ref (manager));
+    ctx->invocation = g_object_ref (invocation);
+    ctx->interval = interval;
+
+    mm_auth_provider_authorize (ctx->self->priv->authp,
+                                invocation,
+                                MM_AUTHORIZATION_MANAGER_CONTROL,
+                                ctx->self->priv->authp_cancellable,
+                                (GAsyncReadyCallback)set_properties_changed_interval_auth_ready,
+                                ctx);
+    return TRUE;
+}
+
 /*****************************************************************************/
 /* Manual scan */
 
@@ -1418,6 +1530,30 @@ out:
 
 #endif
 
+/*****************************************************************************/
+/* Debug method statistics */
+
+static gboolean
+handle_get_method_statistics (MmGdbusDebug          *skeleton,
+                              GDBusMethodInvocation *invocation,
+                              MMBaseManager         *self)
+{
+    mm_gdbus_debug_complete_get_method_statistics (skeleton,
+                                                   invocation,
+                                                   mm_method_stats_build_variant (mm_method_stats_get ()));
+    return TRUE;
+}
+
+static gboolean
+handle_reset_method_statistics (MmGdbusDebug          *skeleton,
+                                GDBusMethodInvocation *invocation,
+                                MMBaseManager         *self)
+{
+    mm_method_stats_reset (mm_method_stats_get ());
+    mm_gdbus_debug_complete_reset_method_statistics (skeleton, invocation);
+    return TRUE;
+}
+
 /*****************************************************************************/
 
 static gchar *
@@ -1490,6 +1626,11 @@ set_property (GObject      *object,
                 g_dbus_interface_skeleton_unexport (G_DBUS_INTERFACE_SKELETON (self->priv->test_skeleton));
             }
 #endif
+            if (self->priv->debug_skeleton &&
+                g_dbus_interface_skeleton_get_connection (G_DBUS_INTERFACE_SKELETON (self->priv->debug_skeleton))) {
+                mm_obj_dbg (self, "stopping connection in debug skeleton");
+                g_dbus_interface_skeleton_unexport (G_DBUS_INTERFACE_SKELETON (self->priv->debug_skeleton));
+            }
         }
         break;
     }
@@ -1586,10 +1727,11 @@ mm_base_manager_init (MMBaseManager *self)
 
     /* Enable processing of input DBus messages */
     g_object_connect (self,
-                      "signal::handle-set-logging",         G_CALLBACK (handle_set_logging),         NULL,
-                      "signal::handle-scan-devices",        G_CALLBACK (handle_scan_devices),        NULL,
-                      "signal::handle-report-kernel-event", G_CALLBACK (handle_report_kernel_event), NULL,
-                      "signal::handle-inhibit-device",      G_CALLBACK (handle_inhibit_device),      NULL,
+                      "signal::handle-set-logging",                         G_CALLBACK (handle_set_logging),                         NULL,
+                      "signal::handle-set-properties-changed-interval",     G_CALLBACK (handle_set_properties_changed_interval),     NULL,
+                      "signal::handle-scan-devices",                        G_CALLBACK (handle_scan_devices),                        NULL,
+                      "signal::handle-report-kernel-event",                 G_CALLBACK (handle_report_kernel_event),                 NULL,
+                      "signal::handle-inhibit-device",                      G_CALLBACK (handle_inhibit_device),                      NULL,
                       NULL);
 }
 
@@ -1665,6 +1807,25 @@ initable_init (GInitable     *initable,
     }
 #endif
 
+    /* PropertiesChanged signals are batched in the connection, if requested */
+    mm_properties_batcher_monitor_connection (mm_properties_batcher_get (), self->priv->connection);
+
+    /* Setup the Debug skeleton and start collecting method statistics */
+    if (mm_context_get_debug ()) {
+        mm_method_stats_monitor_connection (mm_method_stats_get (), self->priv->connection);
+
+        self->priv->debug_skeleton = mm_gdbus_debug_skeleton_new ();
+        g_object_connect (self->priv->debug_skeleton,
+                          "signal::handle-get-method-statistics",   G_CALLBACK (handle_get_method_statistics),   initable,
+                          "signal::handle-reset-method-statistics", G_CALLBACK (handle_reset_method_statistics), initable,
+                          NULL);
+        if (!g_dbus_interface_skeleton_export (G_DBUS_INTERFACE_SKELETON (self->priv->debug_skeleton),
+                                               self->priv->connection,
+                                               MM_DBUS_PATH,
+                                               error))
+            return FALSE;
+    }
+
     /* All good */
     return TRUE;
 }
@@ -1706,6 +1867,9 @@ finalize (GObject *object)
         g_object_unref (self->priv->test_skeleton);
 #endif
 
+    if (self->priv->debug_skeleton)
+        g_object_unref (self->priv->debug_skeleton);
+
     if (self->priv->connection)
         g_object_unref (self->priv->connection);
 
@@ -123,6 +123,9 @@ struct _MMBaseModemPrivate {
     GList *enable_tasks;
     GList *disable_tasks;
 
+    /* Support for coalesced operations, as lists of tasks indexed by key */
+    GHashTable *coalesced_tasks;
+
 #if defined WITH_QMI
     /* QMI ports */
     GList *qmi;
@@ -1708,6 +1711,71 @@ mm_base_modem_authorize (MMBaseModem *self,
                                 task);
 }
 
+/*****************************************************************************/
+/* Coalesced operations */
+
+GVariant *
+mm_base_modem_coalesce_finish (MMBaseModem   *self,
+                               GAsyncResult  *res,
+                               GError       **error)
+{
+    return g_task_propagate_pointer (G_TASK (res), error);
+}
+
+static void
+coalesce_ready (MMBaseModem  *self,
+                GAsyncResult *res,
+                gchar        *key)
+{
+    g_autoptr(GError)    error = NULL;
+    g_autoptr(GVariant)  result = NULL;
+    GList               *l;
+    GList               *tasks;
+
+    tasks = g_hash_table_lookup (self->priv->coalesced_tasks, key);
+    g_assert (tasks);
+    g_hash_table_remove (self->priv->coalesced_tasks, key);
+
+    result = g_task_propagate_pointer (G_TASK (res), &error);
+    for (l = tasks; l; l = g_list_next (l)) {
+        if (error)
+            g_task_return_error (G_TASK (l->data), g_error_copy (error));
+        else
+            g_task_return_pointer (G_TASK (l->data), g_variant_ref (result), (GDestroyNotify) g_variant_unref);
+    }
+
+    g_list_free_full (tasks, g_object_unref);
+    g_free (key);
+}
+
+void
+mm_base_modem_coalesce (MMBaseModem           *self,
+                        const gchar           *key,
+                        MMBaseModemCoalesceFn  run,
+                        GAsyncReadyCallback    callback,
+                        gpointer               user_data)
+{
+    GTask *task;
+    GList *tasks;
+
+    if (G_UNLIKELY (!self->priv->coalesced_tasks))
+        self->priv->coalesced_tasks = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+
+    task = g_task_new (self, NULL, callback, user_data);
+
+    /* If the same operation is already running, just wait for its result.
+     * Appending to a non-empty list doesn't change its head. */
+    tasks = g_hash_table_lookup (self->priv->coalesced_tasks, key);
+    if (tasks) {
+        mm_obj_dbg (self, "operation '%s' already in progress: waiting for its result", key);
+        tasks = g_list_append (tasks, task);
+        return;
+    }
+
+    g_hash_table_insert (self->priv->coalesced_tasks, g_strdup (key), g_list_append (NULL, task));
+    run (self, g_task_new (self, NULL, (GAsyncReadyCallback) coalesce_ready, g_strdup (key)));
+}
+
 /*****************************************************************************/
 
 const gchar *
@@ -1998,6 +2066,8 @@ finalize (GObject *object)
 
     g_assert (!self->priv->enable_tasks);
     g_assert (!self->priv->disable_tasks);
+    g_assert (!self->priv->coalesced_tasks || !g_hash_table_size (self->priv->coalesced_tasks));
+    g_clear_pointer (&self->priv->coalesced_tasks, g_hash_table_unref);
 
     mm_obj_dbg (self, "completely disposed");
 
@@ -224,6 +224,21 @@ gboolean mm_base_modem_authorize_finish (MMBaseModem *self,
                                          GAsyncResult *res,
                                          GError **error);
 
+/* Run an operation only once for all the requests with the same key received
+ * while it is in progress. The operation takes ownership of the given task and
+ * completes it with a GVariant, which is then reported to all the requests. */
+typedef void (* MMBaseModemCoalesceFn) (MMBaseModem *self,
+                                        GTask       *task);
+
+void      mm_base_modem_coalesce        (MMBaseModem           *self,
+                                         const gchar           *key,
+                                         MMBaseModemCoalesceFn  run,
+                                         GAsyncReadyCallback    callback,
+                                         gpointer               user_data);
+GVariant *mm_base_modem_coalesce_finish (MMBaseModem           *self,
+                                         GAsyncResult          *res,
+                                         GError               **error);
+
 void     mm_base_modem_initialize        (MMBaseModem *self,
                                           GAsyncReadyCallback callback,
                                           gpointer user_data);
@@ -33,6 +33,7 @@
 #include "mm-base-modem.h"
 #include "mm-log-object.h"
 #include "mm-modem-helpers.h"
+#include "mm-sim-cache.h"
 
 static void async_initable_iface_init (GAsyncInitableIface *iface);
 static void log_object_iface_init     (MMLogObjectInterface *iface);
@@ -70,6 +71,15 @@ struct _MMBaseSimPrivate {
     /* The SIM slot number, which will be 0 always if the system
      * doesn't support multiple SIMS. */
      guint slot_number;
+
+    /* Background revalidation of the contents loaded from the SIM cache */
+    guint sim_cache_revalidate_id;
+
+    /* Responses of the EF reads prefetched in a single command line, keyed
+     * by the (static) per-EF command string */
+    GHashTable *ef_prefetched;
+    /* Set if the modem didn't accept several EF reads in one command line */
+    gboolean ef_batch_unsupported;
 };
 
 static guint signals[SIGNAL_LAST] = { 0 };
@@ -1681,6 +1691,50 @@ mm_base_sim_is_emergency_number (MMBaseSim   *self,
     return FALSE;
 }
 
+/*****************************************************************************/
+/* Elementary file reads */
+
+/* READ BINARY of EFad (Administrative Data) ETSI 51.011 section 10.3.18 */
+#define EF_AD_READ_COMMAND  "+CRSM=176,28589,0,0,4"
+/* READ BINARY of EFspn (Service Provider Name) ETSI 51.011 section 10.3.11 */
+#define EF_SPN_READ_COMMAND "+CRSM=176,28486,0,0,17"
+/* READ BINARY of EF_ECC (Emergency Call Codes) ETSI TS 51.011 section 10.3.27 */
+#define EF_ECC_READ_COMMAND "+CRSM=176,28599,0,0,15"
+/* READ BINARY of EFgid1 */
+#define EF_GID1_READ_COMMAND "+CRSM=176,28478,0,0,0"
+/* READ BINARY of EFgid2 */
+#define EF_GID2_READ_COMMAND "+CRSM=176,28479,0,0,0"
+
+/* Run the given EF read command, unless its response was already prefetched
+ * during initialization. The task is completed with the response string. */
+static void
+ef_read (MMBaseSim           *self,
+         const gchar         *command,
+         guint                timeout,
+         GAsyncReadyCallback  command_ready,
+         GTask               *task)
+{
+    const gchar *prefetched = NULL;
+
+    if (self->priv->ef_prefetched)
+        prefetched = g_hash_table_lookup (self->priv->ef_prefetched, command);
+
+    if (prefetched) {
+        mm_obj_dbg (self, "using prefetched response for '%s'", command);
+        g_task_return_pointer (task, g_strdup (prefetched), g_free);
+        g_hash_table_remove (self->priv->ef_prefetched, command);
+        g_object_unref (task);
+        return;
+    }
+
+    mm_base_modem_at_command (self->priv->modem,
+                              command,
+                              timeout,
+                              FALSE,
+                              command_ready,
+                              task);
+}
+
 /*****************************************************************************/
 
 #undef STR_REPLY_READY_FN
@@ -1769,14 +1823,11 @@ load_emergency_numbers (MMBaseSim           *self,
 {
     mm_obj_dbg (self, "loading emergency numbers...");
 
-    /* READ BINARY of EF_ECC (Emergency Call Codes) ETSI TS 51.011 section 10.3.27 */
-    mm_base_modem_at_command (
-        self->priv->modem,
-        "+CRSM=176,28599,0,0,15",
-        20,
-        FALSE,
-        (GAsyncReadyCallback)load_emergency_numbers_command_ready,
-        g_task_new (self, NULL, callback, user_data));
+    ef_read (self,
+             EF_ECC_READ_COMMAND,
+             20,
+             (GAsyncReadyCallback)load_emergency_numbers_command_ready,
+             g_task_new (self, NULL, callback, user_data));
 }
 
 /*****************************************************************************/
@@ -2185,14 +2236,11 @@ load_operator_identifier (MMBaseSim *self,
 {
     mm_obj_dbg (self, "loading operator ID...");
 
-    /* READ BINARY of EFad (Administrative Data) ETSI 51.011 section 10.3.18 */
-    mm_base_modem_at_command (
-        self->priv->modem,
-        "+CRSM=176,28589,0,0,4",
-        10,
-        FALSE,
-        (GAsyncReadyCallback)load_operator_identifier_command_ready,
-        g_task_new (self, NULL, callback, user_data));
+    ef_read (self,
+             EF_AD_READ_COMMAND,
+             10,
+             (GAsyncReadyCallback)load_operator_identifier_command_ready,
+             g_task_new (self, NULL, callback, user_data));
 }
 
 /*****************************************************************************/
@@ -2275,14 +2323,11 @@ load_operator_name (MMBaseSim *self,
 {
     mm_obj_dbg (self, "loading operator name...");
 
-    /* READ BINARY of EFspn (Service Provider Name) ETSI 51.011 section 10.3.11 */
-    mm_base_modem_at_command (
-        self->priv->modem,
-        "+CRSM=176,28486,0,0,17",
-        10,
-        FALSE,
-        (GAsyncReadyCallback)load_operator_name_command_ready,
-        g_task_new (self, NULL, callback, user_data));
+    ef_read (self,
+             EF_SPN_READ_COMMAND,
+             10,
+             (GAsyncReadyCallback)load_operator_name_command_ready,
+             g_task_new (self, NULL, callback, user_data));
 }
 
 /*****************************************************************************/
@@ -2344,14 +2389,11 @@ load_gid1 (MMBaseSim           *self,
            GAsyncReadyCallback  callback,
            gpointer             user_data)
 {
-    /* READ BINARY of EFgid1 */
-    mm_base_modem_at_command (
-        self->priv->modem,
-        "+CRSM=176,28478,0,0,0",
-        10,
-        FALSE,
-        (GAsyncReadyCallback)load_gid1_command_ready,
-        g_task_new (self, NULL, callback, user_data));
+    ef_read (self,
+             EF_GID1_READ_COMMAND,
+             10,
+             (GAsyncReadyCallback)load_gid1_command_ready,
+             g_task_new (self, NULL, callback, user_data));
 }
 
 static void
@@ -2359,14 +2401,11 @@ load_gid2 (MMBaseSim           *self,
            GAsyncReadyCallback  callback,
            gpointer             user_data)
 {
-    /* READ BINARY of EFgid2 */
-    mm_base_modem_at_command (
-        self->priv->modem,
-        "+CRSM=176,28479,0,0,0",
-        10,
-        FALSE,
-        (GAsyncReadyCallback)load_gid2_command_ready,
-        g_task_new (self, NULL, callback, user_data));
+    ef_read (self,
+             EF_GID2_READ_COMMAND,
+             10,
+             (GAsyncReadyCallback)load_gid2_command_ready,
+             g_task_new (self, NULL, callback, user_data));
 }
 
 /*****************************************************************************/
@@ -2411,6 +2450,8 @@ typedef enum {
     INITIALIZATION_STEP_SIM_TYPE,
     INITIALIZATION_STEP_ESIM_STATUS,
     INITIALIZATION_STEP_SIM_IDENTIFIER,
+    INITIALIZATION_STEP_SIM_CACHE,
+    INITIALIZATION_STEP_EF_PREFETCH,
     INITIALIZATION_STEP_IMSI,
     INITIALIZATION_STEP_OPERATOR_ID,
     INITIALIZATION_STEP_OPERATOR_NAME,
@@ -2426,8 +2467,24 @@ typedef enum {
 struct _InitAsyncContext {
     InitializationStep step;
     guint sim_identifier_tries;
+    /* Contents loaded from the SIM cache */
+    gboolean sim_cache_loaded;
+    /* Reload all contents, even if already available; values already
+     * exposed are only updated if the reload succeeds */
+    gboolean revalidate;
+    /* Whether any of the contents couldn't be loaded */
+    gboolean load_failed;
+    /* EF reads sent in a single command line, NULL-terminated */
+    const gchar *ef_batch_commands[6];
+    guint        n_ef_batch_commands;
 };
 
+/* Delay before reloading from the card the contents served from the cache */
+#define SIM_CACHE_REVALIDATE_TIMEOUT_SECS 30
+
+/* Whether the value exposed in the given property needs to be loaded */
+#define NEEDS_LOAD(ctx,value) ((ctx)->revalidate || (value) == NULL)
+
 MMBaseSim *
 mm_base_sim_new_finish (GAsyncResult  *res,
                         GError       **error)
@@ -2467,16 +2524,18 @@ initable_init_finish (GAsyncInitable  *initable,
         g_autoptr(GError)  error = NULL;                                                  \
         g_autofree gchar  *val = NULL;                                                    \
                                                                                           \
+        ctx = g_task_get_task_data (task);                                                \
         val = MM_BASE_SIM_GET_CLASS (self)->load_##NAME##_finish (self, res, &error);     \
-        mm_gdbus_sim_set_##NAME (MM_GDBUS_SIM (self), val);                               \
+        if (!error || !ctx->revalidate)                                                   \
+            mm_gdbus_sim_set_##NAME (MM_GDBUS_SIM (self), val);                           \
                                                                                           \
-        if (error)                                                                        \
+        if (error) {                                                                      \
             mm_obj_dbg (self, "couldn't load %s: %s", DISPLAY, error->message);           \
-        else                                                                              \
+            ctx->load_failed = TRUE;                                                      \
+        } else                                                                            \
             mm_obj_info (self, "loaded %s: %s", DISPLAY, VALUE_FORMAT (val));             \
                                                                                           \
         /* Go on to next step */                                                          \
-        ctx = g_task_get_task_data (task);                                                \
         ctx->step++;                                                                      \
         interface_initialization_step (task);                                             \
     }
@@ -2498,16 +2557,18 @@ initable_init_finish (GAsyncInitable  *initable,
         g_autoptr(GError)  error = NULL;                                              \
         ENUM_TYPE          val;                                                       \
                                                                                       \
+        ctx = g_task_get_task_data (task);                                            \
         val = MM_BASE_SIM_GET_CLASS (self)->load_##NAME##_finish (self, res, &error); \
-        mm_gdbus_sim_set_##NAME (MM_GDBUS_SIM (self), (guint) val);                   \
+        if (!error || !ctx->revalidate)                                               \
+            mm_gdbus_sim_set_##NAME (MM_GDBUS_SIM (self), (guint) val);               \
                                                                                       \
-        if (error)                                                                    \
+        if (error) {                                                                  \
             mm_obj_dbg (self, "couldn't load %s: %s", DISPLAY, error->message);       \
-        else                                                                          \
+            ctx->load_failed = TRUE;                                                  \
+        } else                                                                        \
             mm_obj_info (self, "loaded %s: %s", DISPLAY, ENUM_GET_STRING (val));      \
                                                                                       \
         /* Go on to next step */                                                      \
-        ctx = g_task_get_task_data (task);                                            \
         ctx->step++;                                                                  \
         interface_initialization_step (task);                                         \
     }
@@ -2523,18 +2584,21 @@ initable_init_finish (GAsyncInitable  *initable,
         g_autoptr(GError)      error = NULL;                                      \
         g_autoptr(GByteArray)  bytearray = NULL;                                  \
                                                                                   \
+        ctx = g_task_get_task_data (task);                                        \
         bytearray = MM_BASE_SIM_GET_CLASS (self)->load_##NAME##_finish (self, res, &error); \
-        mm_gdbus_sim_set_##NAME (MM_GDBUS_SIM (self),                             \
-                                 (bytearray ?                                     \
-                                  g_variant_new_fixed_array (G_VARIANT_TYPE_BYTE, \
-                                                             bytearray->data,     \
-                                                             bytearray->len,      \
-                                                             sizeof (guint8)) :   \
-                                  NULL));                                         \
+        if (!error || !ctx->revalidate)                                           \
+            mm_gdbus_sim_set_##NAME (MM_GDBUS_SIM (self),                         \
+                                     (bytearray ?                                 \
+                                      g_variant_new_fixed_array (G_VARIANT_TYPE_BYTE, \
+                                                                 bytearray->data, \
+                                                                 bytearray->len,  \
+                                                                 sizeof (guint8)) : \
+                                      NULL));                                     \
                                                                                   \
-        if (error)                                                                \
+        if (error) {                                                              \
             mm_obj_dbg (self, "couldn't load %s: %s", DISPLAY, error->message);   \
-        else {                                                                    \
+            ctx->load_failed = TRUE;                                              \
+        } else {                                                                  \
             g_autofree gchar *bytearray_str = NULL;                               \
                                                                                   \
             bytearray_str = mm_utils_bin2hexstr (bytearray->data, bytearray->len); \
@@ -2542,7 +2606,6 @@ initable_init_finish (GAsyncInitable  *initable,
         }                                                                         \
                                                                                   \
         /* Go on to next step */                                                  \
-        ctx = g_task_get_task_data (task);                                        \
         ctx->step++;                                                              \
         interface_initialization_step (task);                                     \
     }
@@ -2561,10 +2624,12 @@ init_load_preferred_networks_ready (MMBaseSim    *self,
     g_autoptr(GError)  error = NULL;
     GList             *preferred_nets_list;
 
+    ctx = g_task_get_task_data (task);
     preferred_nets_list = MM_BASE_SIM_GET_CLASS (self)->load_preferred_networks_finish (self, res, &error);
-    if (error)
+    if (error) {
         mm_obj_dbg (self, "couldn't load list of preferred networks: %s", error->message);
-    else {
+        ctx->load_failed = TRUE;
+    } else {
         g_autoptr(GString)  str = NULL;
         GList              *l;
 
@@ -2581,13 +2646,13 @@ init_load_preferred_networks_ready (MMBaseSim    *self,
         mm_obj_info (self, "loaded list of preferred networks: %s", str->str);
     }
 
-    mm_gdbus_sim_set_preferred_networks (MM_GDBUS_SIM (self),
-                                         mm_sim_preferred_network_list_get_variant (preferred_nets_list));
+    if (!error || !ctx->revalidate)
+        mm_gdbus_sim_set_preferred_networks (MM_GDBUS_SIM (self),
+                                             mm_sim_preferred_network_list_get_variant (preferred_nets_list));
 
     g_list_free_full (preferred_nets_list, (GDestroyNotify) mm_sim_preferred_network_free);
 
     /* Go on to next step */
-    ctx = g_task_get_task_data (task);
     ctx->step++;
     interface_initialization_step (task);
 }
@@ -2601,10 +2666,12 @@ init_load_emergency_numbers_ready (MMBaseSim    *self,
     g_autoptr(GError)  error = NULL;
     g_auto(GStrv)      str_list = NULL;
 
+    ctx = g_task_get_task_data (task);
     str_list = MM_BASE_SIM_GET_CLASS (self)->load_emergency_numbers_finish (self, res, &error);
-    if (error)
+    if (error) {
         mm_obj_dbg (self, "couldn't load list of emergency numbers: %s", error->message);
-    else {
+        ctx->load_failed = TRUE;
+    } else {
         g_autoptr(GString) str = NULL;
         guint              i;
 
@@ -2614,10 +2681,10 @@ init_load_emergency_numbers_ready (MMBaseSim    *self,
         mm_obj_info (self, "loaded list of emergency numbers: %s", str->str);
     }
 
-    mm_gdbus_sim_set_emergency_numbers (MM_GDBUS_SIM (self), (const gchar *const *) str_list);
+    if (!error || !ctx->revalidate)
+        mm_gdbus_sim_set_emergency_numbers (MM_GDBUS_SIM (self), (const gchar *const *) str_list);
 
     /* Go on to next step */
-    ctx = g_task_get_task_data (task);
     ctx->step++;
     interface_initialization_step (task);
 }
@@ -2683,6 +2750,164 @@ init_wait_sim_ready (MMBaseSim    *self,
     interface_initialization_step (task);
 }
 
+static void
+sim_contents_revalidate_ready (MMBaseSim    *self,
+                               GAsyncResult *res)
+{
+    g_autoptr(GError) error = NULL;
+
+    if (!g_task_propagate_boolean (G_TASK (res), &error))
+        mm_obj_dbg (self, "couldn't revalidate SIM contents: %s", error->message);
+    else
+        mm_obj_dbg (self, "SIM contents revalidated");
+}
+
+static void
+sim_contents_revalidate (MMBaseSim *self)
+{
+    InitAsyncContext *ctx;
+    GTask            *task;
+
+    /* Reload all the cacheable contents from the card; the last step stores
+     * the new contents in the cache */
+    ctx = g_new0 (InitAsyncContext, 1);
+    ctx->step = INITIALIZATION_STEP_EF_PREFETCH;
+    ctx->revalidate = TRUE;
+
+    task = g_task_new (self, NULL, (GAsyncReadyCallback)sim_contents_revalidate_ready, NULL);
+    g_task_set_task_data (task, ctx, g_free);
+
+    interface_initialization_step (task);
+}
+
+static gboolean
+sim_cache_revalidate_cb (MMBaseSim *self)
+{
+    self->priv->sim_cache_revalidate_id = 0;
+    sim_contents_revalidate (self);
+    return G_SOURCE_REMOVE;
+}
+
+static void
+sim_cache_schedule_revalidate (MMBaseSim *self)
+{
+    if (self->priv->sim_cache_revalidate_id)
+        return;
+
+    self->priv->sim_cache_revalidate_id = g_timeout_add_seconds (SIM_CACHE_REVALIDATE_TIMEOUT_SECS,
+                                                                 (GSourceFunc)sim_cache_revalidate_cb,
+                                                                 self);
+}
+
+void
+mm_base_sim_invalidate_cache (MMBaseSim *self)
+{
+    const gchar *iccid;
+
+    if (self->priv->sim_cache_revalidate_id) {
+        g_source_remove (self->priv->sim_cache_revalidate_id);
+        self->priv->sim_cache_revalidate_id = 0;
+    }
+
+    iccid = mm_gdbus_sim_get_sim_identifier (MM_GDBUS_SIM (self));
+    if (iccid) {
+        mm_obj_dbg (self, "invalidating cached SIM contents");
+        mm_sim_cache_remove (iccid, self);
+    }
+}
+
+void
+mm_base_sim_reload_contents (MMBaseSim *self)
+{
+    if (self->priv->sim_cache_revalidate_id) {
+        g_source_remove (self->priv->sim_cache_revalidate_id);
+        self->priv->sim_cache_revalidate_id = 0;
+    }
+
+    mm_obj_dbg (self, "reloading SIM contents");
+    sim_contents_revalidate (self);
+}
+
+static void
+ef_batch_add (InitAsyncContext *ctx,
+              const gchar      *command)
+{
+    g_assert (ctx->n_ef_batch_commands < G_N_ELEMENTS (ctx->ef_batch_commands) - 1);
+    ctx->ef_batch_commands[ctx->n_ef_batch_commands++] = command;
+}
+
+static void
+ef_batch_collect (MMBaseSim        *self,
+                  InitAsyncContext *ctx)
+{
+    MMBaseSimClass *klass;
+
+    klass = MM_BASE_SIM_GET_CLASS (self);
+
+    memset (ctx->ef_batch_commands, 0, sizeof (ctx->ef_batch_commands));
+    ctx->n_ef_batch_commands = 0;
+
+    /* Only the default AT loaders know about the prefetched responses */
+    if (klass->load_operator_identifier == load_operator_identifier &&
+        NEEDS_LOAD (ctx, mm_gdbus_sim_get_operator_identifier (MM_GDBUS_SIM (self))))
+        ef_batch_add (ctx, EF_AD_READ_COMMAND);
+    if (klass->load_operator_name == load_operator_name &&
+        NEEDS_LOAD (ctx, mm_gdbus_sim_get_operator_name (MM_GDBUS_SIM (self))))
+        ef_batch_add (ctx, EF_SPN_READ_COMMAND);
+    if (klass->load_emergency_numbers == load_emergency_numbers &&
+        NEEDS_LOAD (ctx, mm_gdbus_sim_get_emergency_numbers (MM_GDBUS_SIM (self))))
+        ef_batch_add (ctx, EF_ECC_READ_COMMAND);
+    if (klass->load_gid1 == load_gid1 &&
+        NEEDS_LOAD (ctx, mm_gdbus_sim_get_gid1 (MM_GDBUS_SIM (self))))
+        ef_batch_add (ctx, EF_GID1_READ_COMMAND);
+    if (klass->load_gid2 == load_gid2 &&
+        NEEDS_LOAD (ctx, mm_gdbus_sim_get_gid2 (MM_GDBUS_SIM (self))))
+        ef_batch_add (ctx, EF_GID2_READ_COMMAND);
+}
+
+static void
+init_ef_prefetch_ready (MMBaseModem  *modem,
+                        GAsyncResult *res,
+                        GTask        *task)
+{
+    MMBaseSim         *self;
+    InitAsyncContext  *ctx;
+    const gchar       *response;
+    g_auto(GStrv)      responses = NULL;
+    g_autoptr(GError)  error = NULL;
+    guint              i;
+
+    self = g_task_get_source_object (task);
+    ctx = g_task_get_task_data (task);
+
+    response = mm_base_modem_at_command_finish (modem, res, &error);
+    if (response)
+        responses = mm_3gpp_split_crsm_responses (response, &error);
+
+    if (!responses)
+        mm_obj_dbg (self, "couldn't prefetch EF contents: %s", error->message);
+    else if (g_strv_length (responses) != ctx->n_ef_batch_commands)
+        mm_obj_dbg (self, "couldn't prefetch EF contents: expected %u responses, got %u",
+                    ctx->n_ef_batch_commands, g_strv_length (responses));
+    else {
+        if (!self->priv->ef_prefetched)
+            self->priv->ef_prefetched = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, g_free);
+        for (i = 0; i < ctx->n_ef_batch_commands; i++)
+            g_hash_table_insert (self->priv->ef_prefetched,
+                                 (gpointer) ctx->ef_batch_commands[i],
+                                 g_strdup (responses[i]));
+        mm_obj_dbg (self, "prefetched %u EF contents", ctx->n_ef_batch_commands);
+        ctx->step++;
+        interface_initialization_step (task);
+        return;
+    }
+
+    /* Fallback to one command per EF, and don't try again with this SIM */
+    self->priv->ef_batch_unsupported = TRUE;
+    ctx->step++;
+    interface_initialization_step (task);
+}
+
 static void
 interface_initialization_step (GTask *task)
 {
@@ -2761,13 +2986,52 @@ interface_initialization_step (GTask *task)
         ctx->step++;
         /* Fall through */
 
+    case INITIALIZATION_STEP_SIM_CACHE:
+        /* Contents that never change in the card (i.e. everything loaded in
+         * the next steps) may be served from the cache, keyed by ICCID. Each
+         * step below is skipped if the value is already available. */
+        if (mm_sim_cache_enabled () && mm_gdbus_sim_get_sim_identifier (MM_GDBUS_SIM (self))) {
+            g_autoptr(GError) error = NULL;
+
+            ctx->sim_cache_loaded = mm_sim_cache_load (mm_gdbus_sim_get_sim_identifier (MM_GDBUS_SIM (self)),
+                                                       MM_GDBUS_SIM (self),
+                                                       &error);
+            if (ctx->sim_cache_loaded)
+                mm_obj_info (self, "loaded SIM contents from cache");
+            else
+                mm_obj_dbg (self, "couldn't load SIM contents from cache: %s", error->message);
+        }
+        ctx->step++;
+        /* Fall through */
+
+    case INITIALIZATION_STEP_EF_PREFETCH:
+        /* Read in a single command line all the EFs required by the default
+         * loaders in the next steps, instead of one command each */
+        if (!self->priv->ef_batch_unsupported && !IS_ESIM_WITHOUT_PROFILES (self)) {
+            g_autofree gchar *command = NULL;
+
+            ef_batch_collect (self, ctx);
+            if (ctx->n_ef_batch_commands > 1) {
+                command = g_strjoinv (";", (gchar **) ctx->ef_batch_commands);
+                mm_base_modem_at_command (self->priv->modem,
+                                          command,
+                                          20,
+                                          FALSE,
+                                          (GAsyncReadyCallback)init_ef_prefetch_ready,
+                                          task);
+                return;
+            }
+        }
+        ctx->step++;
+        /* Fall through */
+
     case INITIALIZATION_STEP_IMSI:
         /* Don't load SIM IMSI if the SIM is known to be an eSIM without
          * profiles; otherwise (if physical SIM, or if eSIM with profile, or if
          * SIM type unknown) try to load it. */
         if (IS_ESIM_WITHOUT_PROFILES (self))
             mm_obj_dbg (self, "not loading IMSI in eSIM without profiles");
-        else if (mm_gdbus_sim_get_imsi (MM_GDBUS_SIM (self)) == NULL &&
+        else if (NEEDS_LOAD (ctx, mm_gdbus_sim_get_imsi (MM_GDBUS_SIM (self))) &&
                  MM_BASE_SIM_GET_CLASS (self)->load_imsi &&
                  MM_BASE_SIM_GET_CLASS (self)->load_imsi_finish) {
             MM_BASE_SIM_GET_CLASS (self)->load_imsi (
@@ -2785,7 +3049,7 @@ interface_initialization_step (GTask *task)
          * SIM type unknown) try to load it. */
         if (IS_ESIM_WITHOUT_PROFILES (self))
             mm_obj_dbg (self, "not loading operator ID in eSIM without profiles");
-        else if (mm_gdbus_sim_get_operator_identifier (MM_GDBUS_SIM (self)) == NULL &&
+        else if (NEEDS_LOAD (ctx, mm_gdbus_sim_get_operator_identifier (MM_GDBUS_SIM (self))) &&
                  MM_BASE_SIM_GET_CLASS (self)->load_operator_identifier &&
                  MM_BASE_SIM_GET_CLASS (self)->load_operator_identifier_finish) {
             MM_BASE_SIM_GET_CLASS (self)->load_operator_identifier (
@@ -2803,7 +3067,7 @@ interface_initialization_step (GTask *task)
          * SIM type unknown) try to load it. */
         if (IS_ESIM_WITHOUT_PROFILES (self))
             mm_obj_dbg (self, "not loading operator name in eSIM without profiles");
-        else if (mm_gdbus_sim_get_operator_name (MM_GDBUS_SIM (self)) == NULL &&
+        else if (NEEDS_LOAD (ctx, mm_gdbus_sim_get_operator_name (MM_GDBUS_SIM (self))) &&
                  MM_BASE_SIM_GET_CLASS (self)->load_operator_name &&
                  MM_BASE_SIM_GET_CLASS (self)->load_operator_name_finish) {
             MM_BASE_SIM_GET_CLASS (self)->load_operator_name (
@@ -2821,7 +3085,7 @@ interface_initialization_step (GTask *task)
          * SIM type unknown) try to load it. */
         if (IS_ESIM_WITHOUT_PROFILES (self))
             mm_obj_dbg (self, "not loading emergency numbers in eSIM without profiles");
-        else if (mm_gdbus_sim_get_emergency_numbers (MM_GDBUS_SIM (self)) == NULL &&
+        else if (NEEDS_LOAD (ctx, mm_gdbus_sim_get_emergency_numbers (MM_GDBUS_SIM (self))) &&
                  MM_BASE_SIM_GET_CLASS (self)->load_emergency_numbers &&
                  MM_BASE_SIM_GET_CLASS (self)->load_emergency_numbers_finish) {
             MM_BASE_SIM_GET_CLASS (self)->load_emergency_numbers (
@@ -2839,7 +3103,7 @@ interface_initialization_step (GTask *task)
          * SIM type unknown) try to load it. */
         if (IS_ESIM_WITHOUT_PROFILES (self))
             mm_obj_dbg (self, "not loading preferred networks in eSIM without profiles");
-        else if (mm_gdbus_sim_get_preferred_networks (MM_GDBUS_SIM (self)) == NULL &&
+        else if (NEEDS_LOAD (ctx, mm_gdbus_sim_get_preferred_networks (MM_GDBUS_SIM (self))) &&
                  MM_BASE_SIM_GET_CLASS (self)->load_preferred_networks &&
                  MM_BASE_SIM_GET_CLASS (self)->load_preferred_networks_finish) {
             MM_BASE_SIM_GET_CLASS (self)->load_preferred_networks (
@@ -2857,7 +3121,7 @@ interface_initialization_step (GTask *task)
          * SIM type unknown) try to load it. */
         if (IS_ESIM_WITHOUT_PROFILES (self))
             mm_obj_dbg (self, "not loading GID1 in eSIM without profiles");
-        else if (mm_gdbus_sim_get_gid1 (MM_GDBUS_SIM (self)) == NULL &&
+        else if (NEEDS_LOAD (ctx, mm_gdbus_sim_get_gid1 (MM_GDBUS_SIM (self))) &&
                  MM_BASE_SIM_GET_CLASS (self)->load_gid1 &&
                  MM_BASE_SIM_GET_CLASS (self)->load_gid1_finish) {
             MM_BASE_SIM_GET_CLASS (self)->load_gid1 (
@@ -2875,7 +3139,7 @@ interface_initialization_step (GTask *task)
          * SIM type unknown) try to load it. */
         if (IS_ESIM_WITHOUT_PROFILES (self))
             mm_obj_dbg (self, "not loading GID2 in eSIM without profiles");
-        else if (mm_gdbus_sim_get_gid2 (MM_GDBUS_SIM (self)) == NULL &&
+        else if (NEEDS_LOAD (ctx, mm_gdbus_sim_get_gid2 (MM_GDBUS_SIM (self))) &&
                  MM_BASE_SIM_GET_CLASS (self)->load_gid2 &&
                  MM_BASE_SIM_GET_CLASS (self)->load_gid2_finish) {
             MM_BASE_SIM_GET_CLASS (self)->load_gid2 (
@@ -2892,7 +3156,7 @@ interface_initialization_step (GTask *task)
          * (if eSIM with or without profiles) try to load it. */
         if (IS_PSIM (self))
             mm_obj_dbg (self, "not loading EID in physical SIM");
-        else if (mm_gdbus_sim_get_eid (MM_GDBUS_SIM (self)) == NULL &&
+        else if (NEEDS_LOAD (ctx, mm_gdbus_sim_get_eid (MM_GDBUS_SIM (self))) &&
                  MM_BASE_SIM_GET_CLASS (self)->load_eid &&
                  MM_BASE_SIM_GET_CLASS (self)->load_eid_finish) {
             MM_BASE_SIM_GET_CLASS (self)->load_eid (
@@ -2920,6 +3184,27 @@ interface_initialization_step (GTask *task)
         /* Fall through */
 
     case INITIALIZATION_STEP_LAST:
+        /* Prefetched responses not consumed by any loader are no longer needed */
+        if (self->priv->ef_prefetched)
+            g_hash_table_remove_all (self->priv->ef_prefetched);
+
+        /* Contents served from the cache are reloaded in the background;
+         * otherwise, store in the cache whatever we just loaded, unless
+         * something failed to load, as we don't want to cache partial
+         * contents */
+        if (ctx->sim_cache_loaded)
+            sim_cache_schedule_revalidate (self);
+        else if (ctx->load_failed)
+            mm_obj_dbg (self, "not storing SIM contents in cache: some contents couldn't be loaded");
+        else if (mm_sim_cache_enabled () && mm_gdbus_sim_get_sim_identifier (MM_GDBUS_SIM (self))) {
+            g_autoptr(GError) error = NULL;
+
+            if (!mm_sim_cache_store (mm_gdbus_sim_get_sim_identifier (MM_GDBUS_SIM (self)),
+                                     MM_GDBUS_SIM (self),
+                                     &error))
+                mm_obj_dbg (self, "couldn't store SIM contents in cache: %s", error->message);
+        }
+
         /* We are done without errors! */
         g_task_return_boolean (task, TRUE);
         g_object_unref (task);
@@ -2945,9 +3230,8 @@ common_init_async (GAsyncInitable *initable,
 
     self = MM_BASE_SIM (initable);
 
-    ctx = g_new (InitAsyncContext, 1);
+    ctx = g_new0 (InitAsyncContext, 1);
     ctx->step = INITIALIZATION_STEP_FIRST;
-    ctx->sim_identifier_tries = 0;
 
     task = g_task_new (self, cancellable, callback, user_data);
     g_task_set_task_data (task, ctx, g_free);
@@ -3117,6 +3401,8 @@ finalize (GObject *object)
     MMBaseSim *self = MM_BASE_SIM (object);
 
     g_free (self->priv->path);
+    if (self->priv->ef_prefetched)
+        g_hash_table_unref (self->priv->ef_prefetched);
 
     G_OBJECT_CLASS (mm_base_sim_parent_class)->finalize (object);
 }
@@ -3135,6 +3421,11 @@ dispose (GObject *object)
 
     g_clear_object (&self->priv->modem);
 
+    if (self->priv->sim_cache_revalidate_id) {
+        g_source_remove (self->priv->sim_cache_revalidate_id);
+        self->priv->sim_cache_revalidate_id = 0;
+    }
+
     G_OBJECT_CLASS (mm_base_sim_parent_class)->dispose (object);
 }
 
@@ -272,4 +272,13 @@ gboolean     mm_base_sim_is_emergency_number (MMBaseSim   *self,
 
 gboolean     mm_base_sim_is_esim_without_profiles (MMBaseSim *self);
 
+/* Drop the cached contents of the SIM, e.g. when the card notifies that
+ * its files have changed */
+void         mm_base_sim_invalidate_cache (MMBaseSim *self);
+
+/* Reload from the card the contents exposed in the SIM object, e.g. once
+ * the card has finished updating its files. Values that fail to load are
+ * kept as they were. */
+void         mm_base_sim_reload_contents  (MMBaseSim *self);
+
 #endif /* MM_BASE_SIM_H */
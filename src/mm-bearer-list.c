@@ -279,20 +279,6 @@ mm_bearer_list_disconnect_all_bearers (MMBearerList *self,
 
 #if defined WITH_SUSPEND_RESUME
 
-typedef struct {
-    GList        *pending;
-    MMBaseBearer *current;
-} SyncAllContext;
-
-static void
-sync_all_context_free (SyncAllContext *ctx)
-{
-    if (ctx->current)
-        g_object_unref (ctx->current);
-    g_list_free_full (ctx->pending, g_object_unref);
-    g_free (ctx);
-}
-
 gboolean
 mm_bearer_list_sync_all_bearers_finish (MMBearerList  *self,
                                         GAsyncResult  *res,
@@ -301,41 +287,22 @@ mm_bearer_list_sync_all_bearers_finish (MMBearerList  *self,
     return g_task_propagate_boolean (G_TASK (res), error);
 }
 
-static void sync_next_bearer (GTask *task);
-
 static void
 sync_ready (MMBaseBearer *bearer,
             GAsyncResult *res,
             GTask        *task)
 {
-    g_autoptr(GError) error = NULL;
+    g_autoptr(GError)  error = NULL;
+    guint             *n_pending;
 
     if (!mm_base_bearer_sync_finish (bearer, res, &error))
         mm_obj_warn (bearer, "failed synchronizing state: %s", error->message);
 
-    sync_next_bearer (task);
-}
-
-static void
-sync_next_bearer (GTask *task)
-{
-    SyncAllContext *ctx;
-
-    ctx = g_task_get_task_data (task);
-    if (ctx->current)
-        g_clear_object (&ctx->current);
-
-    /* No more bearers? all done! */
-    if (!ctx->pending) {
+    n_pending = g_task_get_task_data (task);
+    g_assert (*n_pending > 0);
+    if (--(*n_pending) == 0)
         g_task_return_boolean (task, TRUE);
-        g_object_unref (task);
-        return;
-    }
-
-    ctx->current = MM_BASE_BEARER (ctx->pending->data);
-    ctx->pending = g_list_delete_link (ctx->pending, ctx->pending);
-
-    mm_base_bearer_sync (ctx->current, (GAsyncReadyCallback)sync_ready, task);
+    g_object_unref (task);
 }
 
 void
@@ -343,20 +310,34 @@ mm_bearer_list_sync_all_bearers (MMBearerList        *self,
                                  GAsyncReadyCallback  callback,
                                  gpointer             user_data)
 {
-    SyncAllContext *ctx;
-    GTask          *task;
+    GTask *task;
+    guint *n_pending;
+    GList *bearers;
+    GList *l;
 
-    ctx = g_new0 (SyncAllContext, 1);
+    task = g_task_new (self, NULL, callback, user_data);
 
-    /* Get a copy of the list */
-    ctx->pending = g_list_copy_deep (self->priv->bearers,
-                                     (GCopyFunc)g_object_ref,
-                                     NULL);
+    /* No bearers? all done! */
+    if (!self->priv->bearers) {
+        g_task_return_boolean (task, TRUE);
+        g_object_unref (task);
+        return;
+    }
 
-    task = g_task_new (self, NULL, callback, user_data);
-    g_task_set_task_data (task, ctx, (GDestroyNotify)sync_all_context_free);
+    /* Bearers are independent from each other, so synchronize all of them
+     * at the same time; each operation holds a full task reference */
+    bearers = g_list_copy_deep (self->priv->bearers, (GCopyFunc)g_object_ref, NULL);
+    n_pending = g_new0 (guint, 1);
+    *n_pending = g_list_length (bearers);
+    g_task_set_task_data (task, n_pending, g_free);
+
+    for (l = bearers; l; l = g_list_next (l))
+        mm_base_bearer_sync (MM_BASE_BEARER (l->data),
+                             (GAsyncReadyCallback)sync_ready,
+                             g_object_ref (task));
 
-    sync_next_bearer (task);
+    g_list_free_full (bearers, g_object_unref);
+    g_object_unref (task);
 }
 
 #endif
@@ -475,6 +475,7 @@ typedef enum {
     CONNECT_STEP_SETUP_LINK,
     CONNECT_STEP_SETUP_LINK_MAIN_UP,
     CONNECT_STEP_IP_METHOD,
+    CONNECT_STEP_WDS_CLIENTS,
     CONNECT_STEP_IPV4,
     CONNECT_STEP_WDS_CLIENT_IPV4,
     CONNECT_STEP_BIND_DATA_PORT_IPV4,
@@ -520,6 +521,9 @@ typedef struct {
     gchar                         *link_name;
     MMPort                        *link;
 
+    guint   n_wds_clients_pending;
+    GError *wds_clients_error;
+
     gboolean          ipv4;
     gboolean          running_ipv4;
     QmiClientWds     *client_ipv4;
@@ -775,6 +779,7 @@ connect_context_free (ConnectContext *ctx)
     if (ctx->explicit_qmi_open)
         mm_port_qmi_close (ctx->qmi, NULL, NULL);
 
+    g_clear_error (&ctx->wds_clients_error);
     g_clear_error (&ctx->error_ipv4);
     g_clear_error (&ctx->error_ipv6);
     g_clear_object (&ctx->ipv4_config);
@@ -1713,6 +1718,75 @@ qmi_port_allocate_client_ready (MMPortQmi *qmi,
     connect_context_step (task);
 }
 
+static void
+wds_client_allocate_ready (MMPortQmi    *qmi,
+                           GAsyncResult *res,
+                           GTask        *task,
+                           const gchar  *family)
+{
+    ConnectContext *ctx;
+    GError         *error = NULL;
+
+    ctx = g_task_get_task_data (task);
+
+    if (!mm_port_qmi_allocate_client_finish (qmi, res, &error)) {
+        g_prefix_error (&error, "Couldn't allocate %s client in QMI port %s: ",
+                        family, mm_port_get_device (MM_PORT (qmi)));
+        if (!ctx->wds_clients_error)
+            ctx->wds_clients_error = error;
+        else
+            g_error_free (error);
+    }
+
+    g_assert (ctx->n_wds_clients_pending > 0);
+    if (--ctx->n_wds_clients_pending > 0)
+        return;
+
+    if (ctx->wds_clients_error) {
+        complete_connect (task, NULL, g_steal_pointer (&ctx->wds_clients_error));
+        return;
+    }
+
+    /* Keep on; the per-family steps will pick the new clients */
+    connect_context_step (task);
+}
+
+static void
+wds_client_ipv4_allocate_ready (MMPortQmi    *qmi,
+                                GAsyncResult *res,
+                                GTask        *task)
+{
+    wds_client_allocate_ready (qmi, res, task, "IPv4");
+}
+
+static void
+wds_client_ipv6_allocate_ready (MMPortQmi    *qmi,
+                                GAsyncResult *res,
+                                GTask        *task)
+{
+    wds_client_allocate_ready (qmi, res, task, "IPv6");
+}
+
+static void
+wds_client_allocate (GTask               *task,
+                     MMPortQmiFlag        flag,
+                     GAsyncReadyCallback  callback)
+{
+    ConnectContext *ctx;
+
+    ctx = g_task_get_task_data (task);
+    if (mm_port_qmi_peek_client (ctx->qmi, QMI_SERVICE_WDS, MM_BEARER_QMI_PORT_FLAG (flag, ctx)))
+        return;
+
+    ctx->n_wds_clients_pending++;
+    mm_port_qmi_allocate_client (ctx->qmi,
+                                 QMI_SERVICE_WDS,
+                                 MM_BEARER_QMI_PORT_FLAG (flag, ctx),
+                                 g_task_get_cancellable (task),
+                                 callback,
+                                 task);
+}
+
 static void
 main_interface_up_ready (MMPortNet    *link,
                          GAsyncResult *res,
@@ -2050,6 +2124,20 @@ connect_context_step (GTask *task)
         ctx->step++;
         /* fall through */
 
+    case CONNECT_STEP_WDS_CLIENTS:
+        /* Allocate the WDS clients of all the IP families requested at once,
+         * instead of one after the other within each IP family setup */
+        ctx->step++;
+        if (ctx->ipv4)
+            wds_client_allocate (task, MM_PORT_QMI_FLAG_WDS_IPV4, (GAsyncReadyCallback)wds_client_ipv4_allocate_ready);
+        if (ctx->ipv6)
+            wds_client_allocate (task, MM_PORT_QMI_FLAG_WDS_IPV6, (GAsyncReadyCallback)wds_client_ipv6_allocate_ready);
+        if (ctx->n_wds_clients_pending > 0) {
+            mm_obj_dbg (self, "allocating %u WDS clients (mux id %u)", ctx->n_wds_clients_pending, ctx->mux_id);
+            return;
+        }
+        /* fall through */
+
     case CONNECT_STEP_IPV4:
         /* If no IPv4 setup needed, jump to IPv6 */
         if (!ctx->ipv4) {
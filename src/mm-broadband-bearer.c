@@ -28,6 +28,7 @@
 #include <libmm-glib.h>
 
 #include "mm-broadband-bearer.h"
+#include "mm-broadband-modem.h"
 #include "mm-iface-modem.h"
 #include "mm-iface-modem-3gpp.h"
 #include "mm-iface-modem-3gpp-profile-manager.h"
@@ -71,6 +72,8 @@ struct _MMBroadbandBearerPrivate {
     /*-- 3GPP specific --*/
     /* CID of the PDP context */
     gint profile_id;
+    /* Profile selected in the last connection attempt */
+    MM3gppProfile *last_profile;
 };
 
 /*****************************************************************************/
@@ -610,11 +613,36 @@ select_profile_3gpp_set_profile_ready (MMIfaceModem3gppProfileManager *modem,
     profile = mm_iface_modem_3gpp_profile_manager_set_profile_finish (modem, res, &error);
     if (!profile)
         g_task_return_error (task, error);
-    else
+    else {
+        MMBroadbandBearer *self;
+
+        /* Keep track of the selected profile so that it may be reused as
+         * is in the next connection attempt */
+        self = g_task_get_source_object (task);
+        g_clear_object (&self->priv->last_profile);
+        self->priv->last_profile = g_object_ref (profile);
         g_task_return_int (task, mm_3gpp_profile_get_profile_id (profile));
+    }
     g_object_unref (task);
 }
 
+static gboolean
+select_profile_3gpp_reuse_last (MMBroadbandBearer *self,
+                                MMBaseModem       *modem)
+{
+    g_autoptr(MM3gppProfile) cached = NULL;
+
+    /* Reuse the profile selected in the last attempt if the modem still has
+     * it defined exactly the same way */
+    if (!self->priv->last_profile)
+        return FALSE;
+
+    cached = mm_iface_modem_3gpp_profile_manager_get_cached_profile (MM_IFACE_MODEM_3GPP_PROFILE_MANAGER (modem),
+                                                                     mm_3gpp_profile_get_profile_id (self->priv->last_profile));
+    return (cached &&
+            mm_3gpp_profile_cmp (cached, self->priv->last_profile, NULL, MM_3GPP_PROFILE_CMP_FLAGS_NO_PROFILE_NAME));
+}
+
 static void
 select_profile_3gpp_get_profile_ready (MMIfaceModem3gppProfileManager *modem,
                                        GAsyncResult                   *res,
@@ -657,9 +685,23 @@ select_profile_3gpp (MMBroadbandBearer   *self,
     g_task_set_task_data (task, ctx, (GDestroyNotify)select_profile_3gpp_context_free);
 
     if (ctx->profile_id == MM_3GPP_PROFILE_ID_UNKNOWN) {
+        MM3gppProfile *requested;
+
+        /* If the cached profile list shows that the modem still has the
+         * context selected in the last attempt, request that exact profile
+         * id instead of running the best profile selection again. The profile
+         * manager still runs the connected bearer and activated profile
+         * checks, and the cached list lets it skip listing and storing. */
+        if (select_profile_3gpp_reuse_last (self, modem)) {
+            mm_obj_dbg (self, "reusing profile '%d' selected in the last attempt",
+                        mm_3gpp_profile_get_profile_id (self->priv->last_profile));
+            requested = self->priv->last_profile;
+        } else
+            requested = mm_bearer_properties_peek_3gpp_profile (bearer_properties);
+
         mm_iface_modem_3gpp_profile_manager_set_profile (
             MM_IFACE_MODEM_3GPP_PROFILE_MANAGER (modem),
-            mm_bearer_properties_peek_3gpp_profile (bearer_properties),
+            requested,
             "profile-id",
             FALSE, /* not strict! */
             (GAsyncReadyCallback)select_profile_3gpp_set_profile_ready,
@@ -1671,9 +1713,9 @@ cgact_periodic_query_ready (MMBaseModem  *modem,
 }
 
 static void
-load_connection_status (MMBaseBearer        *self,
-                        GAsyncReadyCallback  callback,
-                        gpointer             user_data)
+reload_connection_status (MMBaseBearer        *self,
+                          GAsyncReadyCallback  callback,
+                          gpointer             user_data)
 {
     GTask          *task;
     MMBaseModem    *modem = NULL;
@@ -1724,6 +1766,30 @@ out:
     g_clear_object (&modem);
 }
 
+static void
+load_connection_status (MMBaseBearer        *self,
+                        GAsyncReadyCallback  callback,
+                        gpointer             user_data)
+{
+    g_autoptr(MMBaseModem) modem = NULL;
+
+    g_object_get (MM_BASE_BEARER (self),
+                  MM_BASE_BEARER_MODEM, &modem,
+                  NULL);
+
+    /* If context deactivations are reported via +CGEV, we can rely on
+     * those indications and no polling is required */
+    if (MM_IS_BROADBAND_MODEM (modem) &&
+        mm_broadband_modem_get_cgev_reporting_enabled (MM_BROADBAND_MODEM (modem))) {
+        g_task_report_new_error (self, callback, user_data, load_connection_status,
+                                 MM_CORE_ERROR, MM_CORE_ERROR_UNSUPPORTED,
+                                 "Connection status polling not required: +CGEV reporting enabled");
+        return;
+    }
+
+    reload_connection_status (self, callback, user_data);
+}
+
 /*****************************************************************************/
 
 static void
@@ -1744,6 +1810,17 @@ report_connection_status (MMBaseBearer             *self,
 
 /*****************************************************************************/
 
+void
+mm_broadband_bearer_report_context_event (MMBroadbandBearer *self,
+                                          guint              cid,
+                                          gboolean           active)
+{
+    if (MM_BROADBAND_BEARER_GET_CLASS (self)->report_context_event)
+        MM_BROADBAND_BEARER_GET_CLASS (self)->report_context_event (self, cid, active);
+}
+
+/*****************************************************************************/
+
 typedef struct _InitAsyncContext InitAsyncContext;
 static void interface_initialization_step (GTask *task);
 
@@ -2018,6 +2095,7 @@ dispose (GObject *object)
     MMBroadbandBearer *self = MM_BROADBAND_BEARER (object);
 
     reset_bearer_connection (self);
+    g_clear_object (&self->priv->last_profile);
 
     G_OBJECT_CLASS (mm_broadband_bearer_parent_class)->dispose (object);
 }
@@ -2049,7 +2127,7 @@ mm_broadband_bearer_class_init (MMBroadbandBearerClass *klass)
     base_bearer_class->load_connection_status = load_connection_status;
     base_bearer_class->load_connection_status_finish = load_connection_status_finish;
 #if defined WITH_SUSPEND_RESUME
-    base_bearer_class->reload_connection_status = load_connection_status;
+    base_bearer_class->reload_connection_status = reload_connection_status;
     base_bearer_class->reload_connection_status_finish = load_connection_status_finish;
 #endif
 
@@ -127,6 +127,13 @@ struct _MMBroadbandBearerClass {
     gboolean (* disconnect_cdma_finish) (MMBroadbandBearer *self,
                                          GAsyncResult *res,
                                          GError **error);
+
+    /* Context activation or deactivation reported by the modem (e.g. via
+     * +CGEV), which implementations may use to complete pending connection
+     * or disconnection attempts without waiting for the next status check. */
+    void     (* report_context_event) (MMBroadbandBearer *self,
+                                       guint              cid,
+                                       gboolean           active);
 };
 
 GType mm_broadband_bearer_get_type (void);
@@ -141,4 +148,8 @@ void          mm_broadband_bearer_new        (MMBroadbandModem *modem,
 MMBaseBearer *mm_broadband_bearer_new_finish (GAsyncResult *res,
                                               GError **error);
 
+void mm_broadband_bearer_report_context_event (MMBroadbandBearer *self,
+                                               guint              cid,
+                                               gboolean           active);
+
 #endif /* MM_BROADBAND_BEARER_H */
@@ -13279,6 +13279,9 @@ static const QmiService qmi_services[] = {
     QMI_SERVICE_SAR,
 };
 
+/* Number of WDS clients allocated in advance for bearers */
+#define WDS_CLIENT_POOL_SIZE 2
+
 typedef struct {
     MMPortQmi *qmi;
     guint service_index;
@@ -13369,6 +13372,9 @@ allocate_next_client (GTask *task)
     ctx = g_task_get_task_data (task);
 
     if (ctx->service_index == G_N_ELEMENTS (qmi_services)) {
+        /* Bearers allocate their own WDS clients (IPv4 and IPv6 specific ones)
+         * when connecting; have some ready in advance */
+        mm_port_qmi_setup_client_pool (ctx->qmi, QMI_SERVICE_WDS, WDS_CLIENT_POOL_SIZE);
         parent_initialization_started (task);
         return;
     }
@@ -55,6 +55,7 @@
 #include "mm-modem-helpers.h"
 #include "mm-error-helpers.h"
 #include "mm-port-serial-qcdm.h"
+#include "mm-method-stats.h"
 #include "libqcdm/src/errors.h"
 #include "libqcdm/src/commands.h"
 #include "libqcdm/src/logs.h"
@@ -194,6 +195,7 @@ struct _MMBroadbandModemPrivate {
     MM3gppCmerInd modem_cmer_ind;
     gboolean modem_cgerep_support_checked;
     gboolean modem_cgerep_supported;
+    gboolean modem_cgerep_enabled;
     MMFlowControl flow_control;
 
     /*<--- Modem 3GPP interface --->*/
@@ -234,6 +236,7 @@ struct _MMBroadbandModemPrivate {
     gboolean has_spservice;
     gboolean has_speri;
     gint evdo_pilot_rssi;
+    guint evdo_pilot_sets_subscription_id;
 
     /*<--- Modem Simple interface --->*/
     /* Properties */
@@ -2042,9 +2045,9 @@ modem_load_supported_ip_families (MMIfaceModem *self,
 /*****************************************************************************/
 /* Signal quality loading (Modem interface) */
 
-static void
+static gboolean
 qcdm_evdo_pilot_sets_log_handle (MMPortSerialQcdm *port,
-                                 GByteArray *log_buffer,
+                                 const MMPortSerialQcdmLogItem *item,
                                  gpointer user_data)
 {
     MMBroadbandModem *self = MM_BROADBAND_MODEM (user_data);
@@ -2054,17 +2057,17 @@ qcdm_evdo_pilot_sets_log_handle (MMPortSerialQcdm *port,
     uint32_t pilot_energy = 0;
     int32_t rssi_dbm = 0;
 
-    result = qcdm_log_item_evdo_pilot_sets_v2_new ((const char *) log_buffer->data,
-                                                   log_buffer->len,
+    result = qcdm_log_item_evdo_pilot_sets_v2_new ((const char *) item->frame,
+                                                   item->frame_len,
                                                    NULL);
     if (!result)
-        return;
+        return TRUE;
 
     if (!qcdm_log_item_evdo_pilot_sets_v2_get_num (result,
                                                    QCDM_LOG_ITEM_EVDO_PILOT_SETS_V2_TYPE_ACTIVE,
                                                    &num_active)) {
         qcdm_result_unref (result);
-        return;
+        return TRUE;
     }
 
     if (num_active > 0 &&
@@ -2079,6 +2082,7 @@ qcdm_evdo_pilot_sets_log_handle (MMPortSerialQcdm *port,
     }
 
     qcdm_result_unref (result);
+    return TRUE;
 }
 
 typedef struct {
@@ -2928,6 +2932,37 @@ bearer_list_report_disconnections (MMBroadbandModem *self,
         mm_bearer_list_foreach (list, (MMBearerListForeachFunc)bearer_report_disconnected, GINT_TO_POINTER (profile_id));
 }
 
+static void
+bearer_report_context_event (MMBaseBearer *bearer,
+                             gpointer      user_data)
+{
+    gint cid;
+
+    if (!MM_IS_BROADBAND_BEARER (bearer))
+        return;
+
+    /* Positive cid for activations, negative for deactivations */
+    cid = GPOINTER_TO_INT (user_data);
+    mm_broadband_bearer_report_context_event (MM_BROADBAND_BEARER (bearer), (guint) ABS (cid), cid > 0);
+}
+
+static void
+bearer_list_report_context_event (MMBroadbandModem *self,
+                                  guint             cid,
+                                  gboolean          active)
+{
+    g_autoptr(MMBearerList) list = NULL;
+
+    g_object_get (self,
+                  MM_IFACE_MODEM_BEARER_LIST, &list,
+                  NULL);
+
+    if (list)
+        mm_bearer_list_foreach (list,
+                                (MMBearerListForeachFunc)bearer_report_context_event,
+                                GINT_TO_POINTER (active ? (gint) cid : -(gint) cid));
+}
+
 static void
 cgev_process_detach (MMBroadbandModem *self,
                      MM3gppCgev        type)
@@ -2964,16 +2999,20 @@ cgev_process_primary (MMBroadbandModem *self,
     switch (type) {
     case MM_3GPP_CGEV_NW_ACT_PRIMARY:
         mm_obj_msg (self, "network request to activate context (cid %u)", cid);
+        bearer_list_report_context_event (self, cid, TRUE);
         break;
     case MM_3GPP_CGEV_ME_ACT_PRIMARY:
         mm_obj_msg (self, "mobile equipment request to activate context (cid %u)", cid);
+        bearer_list_report_context_event (self, cid, TRUE);
         break;
     case MM_3GPP_CGEV_NW_DEACT_PRIMARY:
         mm_obj_msg (self, "network request to deactivate context (cid %u)", cid);
+        bearer_list_report_context_event (self, cid, FALSE);
         bearer_list_report_disconnections (self, (gint)cid);
         break;
     case MM_3GPP_CGEV_ME_DEACT_PRIMARY:
         mm_obj_msg (self, "mobile equipment request to deactivate context (cid %u)", cid);
+        bearer_list_report_context_event (self, cid, FALSE);
         bearer_list_report_disconnections (self, (gint)cid);
         break;
     case MM_3GPP_CGEV_UNKNOWN:
@@ -3078,6 +3117,7 @@ cgev_process_pdp (MMBroadbandModem *self,
     case MM_3GPP_CGEV_NW_DEACT_PDP:
         if (cid) {
             mm_obj_msg (self, "network request to deactivate context (type %s, address %s, cid %u)", pdp_type, pdp_addr, cid);
+            bearer_list_report_context_event (self, cid, FALSE);
             bearer_list_report_disconnections (self, (gint)cid);
         } else
             mm_obj_msg (self, "network request to deactivate context (type %s, address %s, cid unknown)", pdp_type, pdp_addr);
@@ -3085,6 +3125,7 @@ cgev_process_pdp (MMBroadbandModem *self,
     case MM_3GPP_CGEV_ME_DEACT_PDP:
         if (cid) {
             mm_obj_msg (self, "mobile equipment request to deactivate context (type %s, address %s, cid %u)", pdp_type, pdp_addr, cid);
+            bearer_list_report_context_event (self, cid, FALSE);
             bearer_list_report_disconnections (self, (gint)cid);
         } else
             mm_obj_msg (self, "mobile equipment request to deactivate context (type %s, address %s, cid unknown)", pdp_type, pdp_addr);
@@ -3522,6 +3563,7 @@ typedef struct {
     gchar          *cgerep_command;
     gboolean        cgerep_primary_done;
     gboolean        cgerep_secondary_done;
+    gboolean        cgerep_running;
 } UnsolicitedEventsContext;
 
 static void
@@ -3561,7 +3603,8 @@ unsolicited_events_setup_ready (MMBroadbandModem *self,
                     ctx->enable ? "enable" : "disable",
                     error->message);
         g_error_free (error);
-    }
+    } else if (ctx->cgerep_running && ctx->enable)
+        self->priv->modem_cgerep_enabled = TRUE;
 
     /* Continue on next port/command */
     run_unsolicited_events_setup (task);
@@ -3578,6 +3621,8 @@ run_unsolicited_events_setup (GTask *task)
     self = g_task_get_source_object (task);
     ctx = g_task_get_task_data (task);
 
+    ctx->cgerep_running = FALSE;
+
     /* CMER on primary port */
     if (!ctx->cmer_primary_done && ctx->cmer_command && ctx->primary && !self->priv->modem_cind_disabled) {
         mm_obj_dbg (self, "%s +CIND event reporting in primary port...", ctx->enable ? "enabling" : "disabling");
@@ -3596,6 +3641,7 @@ run_unsolicited_events_setup (GTask *task)
     else if (!ctx->cgerep_primary_done && ctx->cgerep_command && ctx->primary) {
         mm_obj_dbg (self, "%s +CGEV event reporting in primary port...", ctx->enable ? "enabling" : "disabling");
         ctx->cgerep_primary_done = TRUE;
+        ctx->cgerep_running = TRUE;
         command = ctx->cgerep_command;
         port = ctx->primary;
     }
@@ -3603,6 +3649,7 @@ run_unsolicited_events_setup (GTask *task)
     else if (!ctx->cgerep_secondary_done && ctx->cgerep_command && ctx->secondary) {
         mm_obj_dbg (self, "%s +CGEV event reporting in secondary port...", ctx->enable ? "enabling" : "disabling");
         ctx->cgerep_secondary_done = TRUE;
+        ctx->cgerep_running = TRUE;
         port = ctx->secondary;
         command = ctx->cgerep_command;
     }
@@ -3663,6 +3710,9 @@ modem_3gpp_disable_unsolicited_events (MMIfaceModem3gpp *_self,
 
     task = g_task_new (self, NULL, callback, user_data);
 
+    /* Stop relying on +CGEV indications right away */
+    self->priv->modem_cgerep_enabled = FALSE;
+
     ctx = g_new0 (UnsolicitedEventsContext, 1);
     ctx->primary = mm_base_modem_get_port_primary (MM_BASE_MODEM (self));
     ctx->secondary = mm_base_modem_get_port_secondary (MM_BASE_MODEM (self));
@@ -8745,59 +8795,29 @@ cdma_unsolicited_events_context_free (CdmaUnsolicitedEventsContext *ctx)
 }
 
 static void
-logcmd_qcdm_ready (MMPortSerialQcdm *port,
-                   GAsyncResult *res,
-                   GTask *task)
+log_mask_update_ready (MMPortSerialQcdm *port,
+                       GAsyncResult *res,
+                       GTask *task)
 {
-    MMBroadbandModem *self;
     CdmaUnsolicitedEventsContext *ctx;
-    QcdmResult *result;
-    gint err = QCDM_SUCCESS;
-    GByteArray *response;
     GError *error = NULL;
 
-    self = g_task_get_source_object (task);
     ctx = g_task_get_task_data (task);
 
-    response = mm_port_serial_qcdm_command_finish (port, res, &error);
-    if (error) {
+    if (!mm_port_serial_qcdm_update_log_mask_finish (port, res, &error)) {
         ctx->close_port = TRUE;
         g_task_return_error (task, error);
         g_object_unref (task);
         return;
     }
 
-    /* Parse the response */
-    result = qcdm_cmd_log_config_set_mask_result ((const gchar *) response->data,
-                                                  response->len,
-                                                  &err);
-    g_byte_array_unref (response);
-    if (!result) {
-        ctx->close_port = TRUE;
-        g_task_return_new_error (task,
-                                 MM_CORE_ERROR,
-                                 MM_CORE_ERROR_FAILED,
-                                 "Failed to parse Log Config Set Mask command result: %d",
-                                 err);
-        g_object_unref (task);
-        return;
-    }
-
-    mm_port_serial_qcdm_add_unsolicited_msg_handler (port,
-                                                     DM_LOG_ITEM_EVDO_PILOT_SETS_V2,
-                                                     ctx->setup ? qcdm_evdo_pilot_sets_log_handle : NULL,
-                                                     self,
-                                                     NULL);
-
-    qcdm_result_unref (result);
-
     /* Balance the mm_port_seral_open() from modem_cdma_setup_cleanup_unsolicited_events().
      * We want to close it in either case:
      *  (a) we're cleaning up and setup opened the port
      *  (b) if it was unexpectedly closed before cleanup and thus cleanup opened it
      *
      * Setup should leave the port open to allow log messages to be received
-     * and sent to handlers.
+     * and sent to subscribers.
      */
     ctx->close_port = ctx->setup ? FALSE : TRUE;
     g_task_return_boolean (task, TRUE);
@@ -8812,12 +8832,11 @@ modem_cdma_setup_cleanup_unsolicited_events (MMBroadbandModem *self,
 {
     CdmaUnsolicitedEventsContext *ctx;
     GTask *task;
-    GByteArray *logcmd;
-    uint16_t log_items[] = { DM_LOG_ITEM_EVDO_PILOT_SETS_V2, 0 };
+    const guint16 log_items[] = { DM_LOG_ITEM_EVDO_PILOT_SETS_V2 };
     GError *error = NULL;
 
     ctx = g_new0 (CdmaUnsolicitedEventsContext, 1);
-    ctx->setup = TRUE;
+    ctx->setup = setup;
 
     task = g_task_new (self, NULL, callback, user_data);
     g_task_set_task_data (task, ctx, (GDestroyNotify)cdma_unsolicited_events_context_free);
@@ -8841,20 +8860,24 @@ modem_cdma_setup_cleanup_unsolicited_events (MMBroadbandModem *self,
         }
     }
 
-    logcmd = g_byte_array_sized_new (512);
-    logcmd->len = qcdm_cmd_log_config_set_mask_new ((char *) logcmd->data,
-                                                    512,
-                                                    0x01,  /* Equipment ID */
-                                                    setup ? log_items : NULL);
-    assert (logcmd->len);
+    if (setup && !self->priv->evdo_pilot_sets_subscription_id)
+        self->priv->evdo_pilot_sets_subscription_id =
+            mm_port_serial_qcdm_add_log_subscription (ctx->qcdm,
+                                                      log_items,
+                                                      G_N_ELEMENTS (log_items),
+                                                      qcdm_evdo_pilot_sets_log_handle,
+                                                      self,
+                                                      NULL);
+    else if (!setup && self->priv->evdo_pilot_sets_subscription_id) {
+        mm_port_serial_qcdm_remove_log_subscription (ctx->qcdm, self->priv->evdo_pilot_sets_subscription_id);
+        self->priv->evdo_pilot_sets_subscription_id = 0;
+    }
 
-    mm_port_serial_qcdm_command (ctx->qcdm,
-                                 logcmd,
-                                 5,
-                                 NULL,
-                                 (GAsyncReadyCallback)logcmd_qcdm_ready,
-                                 task);
-    g_byte_array_unref (logcmd);
+    /* The log mask in the device is updated to match the subscriptions */
+    mm_port_serial_qcdm_update_log_mask (ctx->qcdm,
+                                         NULL,
+                                         (GAsyncReadyCallback)log_mask_update_ready,
+                                         task);
 }
 
 static gboolean
@@ -12124,21 +12147,42 @@ enable (MMBaseModem *self,
 
 #if defined WITH_SUSPEND_RESUME
 
+/* Maximum time allowed for the whole resume synchronization of a modem;
+ * if reached, the operation is reported as failed even if some of the
+ * interface synchronizations are still ongoing. */
+#define SYNCING_DEADLINE_SECS 30
+
 typedef enum {
     SYNCING_STEP_FIRST,
     SYNCING_STEP_NOTIFY,
     SYNCING_STEP_IFACE_MODEM,
-    SYNCING_STEP_IFACE_3GPP,
-    SYNCING_STEP_IFACE_TIME,
+    SYNCING_STEP_INTERFACES,
     SYNCING_STEP_LAST,
 } SyncingStep;
 
 typedef struct {
-    SyncingStep step;
+    SyncingStep  step;
+    /* Interface synchronizations running concurrently; the 'usable' ones are
+     * those required before the modem can be considered usable again
+     * (bearer connection status and registration status) */
+    guint        n_pending;
+    guint        n_pending_usable;
+    /* Resume latency tracking and deadline */
+    GTimer      *timer;
+    guint        deadline_id;
+    gboolean     completed;
 } SyncingContext;
 
 static void syncing_step (GTask *task);
 
+static void
+syncing_context_free (SyncingContext *ctx)
+{
+    g_assert (!ctx->deadline_id);
+    g_timer_destroy (ctx->timer);
+    g_free (ctx);
+}
+
 static gboolean
 synchronize_finish (MMBaseModem   *self,
                     GAsyncResult  *res,
@@ -12147,22 +12191,106 @@ synchronize_finish (MMBaseModem   *self,
     return g_task_propagate_boolean (G_TASK (res), error);
 }
 
+/* Completes the task unless already completed by the deadline, and
+ * consumes the reference of the synchronization flow */
+static void
+syncing_complete (GTask  *task,
+                  GError *error)
+{
+    MMBroadbandModem *self;
+    SyncingContext   *ctx;
+
+    self = g_task_get_source_object (task);
+    ctx  = g_task_get_task_data (task);
+
+    if (!ctx->completed) {
+        ctx->completed = TRUE;
+        if (ctx->deadline_id) {
+            g_source_remove (ctx->deadline_id);
+            ctx->deadline_id = 0;
+        }
+        mm_method_stats_record_operation (mm_method_stats_get (),
+                                          "modem-resume-sync",
+                                          (gint64) (g_timer_elapsed (ctx->timer, NULL) * G_USEC_PER_SEC),
+                                          !!error);
+        if (error)
+            g_task_return_error (task, error);
+        else {
+            mm_obj_msg (self, "resume synchronization finished in %.3lf seconds",
+                        g_timer_elapsed (ctx->timer, NULL));
+            g_task_return_boolean (task, TRUE);
+        }
+    } else if (error)
+        g_error_free (error);
+
+    g_object_unref (task);
+}
+
+static gboolean
+syncing_deadline_cb (GTask *task)
+{
+    SyncingContext *ctx;
+
+    ctx = g_task_get_task_data (task);
+    ctx->deadline_id = 0;
+
+    /* The flow reference is still held by the ongoing operations, which will
+     * find the task completed once they finish */
+    g_assert (!ctx->completed);
+    ctx->completed = TRUE;
+    mm_method_stats_record_operation (mm_method_stats_get (),
+                                      "modem-resume-sync",
+                                      (gint64) (g_timer_elapsed (ctx->timer, NULL) * G_USEC_PER_SEC),
+                                      TRUE);
+    g_task_return_new_error (task, MM_CORE_ERROR, MM_CORE_ERROR_ABORTED,
+                             "Synchronization deadline reached after %u seconds",
+                             SYNCING_DEADLINE_SECS);
+    return G_SOURCE_REMOVE;
+}
+
+static void
+sync_interfaces_operation_done (GTask    *task,
+                                gboolean  usable)
+{
+    MMBroadbandModem *self;
+    SyncingContext   *ctx;
+
+    self = g_task_get_source_object (task);
+    ctx  = g_task_get_task_data (task);
+
+    if (usable) {
+        g_assert (ctx->n_pending_usable > 0);
+        if (--ctx->n_pending_usable == 0 && !ctx->completed) {
+            mm_obj_msg (self, "resume synchronization: modem usable after %.3lf seconds",
+                        g_timer_elapsed (ctx->timer, NULL));
+            mm_method_stats_record_operation (mm_method_stats_get (),
+                                              "modem-resume-usable",
+                                              (gint64) (g_timer_elapsed (ctx->timer, NULL) * G_USEC_PER_SEC),
+                                              FALSE);
+        }
+    }
+
+    /* Once all concurrent operations are done, continue the flow
+     * with a new reference */
+    g_assert (ctx->n_pending > 0);
+    if (--ctx->n_pending == 0) {
+        ctx->step++;
+        syncing_step (g_object_ref (task));
+    }
+}
+
 static void
 iface_modem_time_sync_ready (MMIfaceModemTime *self,
                              GAsyncResult     *res,
                              GTask            *task)
 {
-    SyncingContext    *ctx;
-    g_autoptr(GError)  error = NULL;
-
-    ctx = g_task_get_task_data (task);
+    g_autoptr(GError) error = NULL;
 
     if (!mm_iface_modem_time_sync_finish (self, res, &error))
         mm_obj_warn (self, "time interface synchronization failed: %s", error->message);
 
-    /* Go on to next step */
-    ctx->step++;
-    syncing_step (task);
+    sync_interfaces_operation_done (task, FALSE);
+    g_object_unref (task);
 }
 
 static void
@@ -12170,17 +12298,84 @@ iface_modem_3gpp_sync_ready (MMIfaceModem3gpp *self,
                              GAsyncResult     *res,
                              GTask            *task)
 {
-    SyncingContext    *ctx;
     g_autoptr(GError) error = NULL;
 
-    ctx = g_task_get_task_data (task);
-
     if (!mm_iface_modem_3gpp_sync_finish (self, res, &error))
         mm_obj_warn (self, "3GPP interface synchronization failed: %s", error->message);
 
-    /* Go on to next step */
-    ctx->step++;
-    syncing_step (task);
+    sync_interfaces_operation_done (task, TRUE);
+    g_object_unref (task);
+}
+
+static void
+iface_modem_sync_bearers_ready (MMIfaceModem *self,
+                                GAsyncResult *res,
+                                GTask        *task)
+{
+    g_autoptr(GError) error = NULL;
+
+    if (!mm_iface_modem_sync_bearers_finish (self, res, &error))
+        mm_obj_warn (self, "bearer synchronization failed: %s", error->message);
+
+    sync_interfaces_operation_done (task, TRUE);
+    g_object_unref (task);
+}
+
+static void
+sync_interfaces (GTask *task)
+{
+    MMBroadbandModem *self;
+    SyncingContext   *ctx;
+    gboolean          enabled;
+
+    self = g_task_get_source_object (task);
+    ctx  = g_task_get_task_data (task);
+
+    enabled = (self->priv->modem_state >= MM_MODEM_STATE_ENABLED);
+
+    /* Once the SIM is known to be unchanged and unlocked, the synchronization
+     * of the different interfaces can be run concurrently. Operations are
+     * launched in priority order, so that when they share the same port the
+     * bearer connection status requests are queued first, then the
+     * registration checks, and last the signal quality and time ones.
+     *
+     * The flow reference acts as an additional pending operation while
+     * launching all the others, so that the step isn't completed early. */
+    ctx->n_pending = 1;
+    ctx->n_pending_usable = 0;
+
+    mm_obj_msg (self, "resume synchronization state (%d/%d): bearers, registration, signal and time sync",
+                ctx->step, SYNCING_STEP_LAST);
+
+    ctx->n_pending++;
+    ctx->n_pending_usable++;
+    mm_iface_modem_sync_bearers (MM_IFACE_MODEM (self),
+                                 (GAsyncReadyCallback)iface_modem_sync_bearers_ready,
+                                 g_object_ref (task));
+
+    /* 3GPP interface synchronization, only if modem was enabled */
+    if (self->priv->modem_3gpp_dbus_skeleton && enabled) {
+        ctx->n_pending++;
+        ctx->n_pending_usable++;
+        mm_iface_modem_3gpp_sync (MM_IFACE_MODEM_3GPP (self),
+                                  (GAsyncReadyCallback)iface_modem_3gpp_sync_ready,
+                                  g_object_ref (task));
+    }
+
+    /* Restart the signal strength and access technologies refresh sequence,
+     * which runs on its own and isn't waited for */
+    mm_iface_modem_refresh_signal (MM_IFACE_MODEM (self));
+
+    /* Time interface synchronization, only if modem was enabled */
+    if (self->priv->modem_time_dbus_skeleton && enabled) {
+        ctx->n_pending++;
+        mm_iface_modem_time_sync (MM_IFACE_MODEM_TIME (self),
+                                  (GAsyncReadyCallback)iface_modem_time_sync_ready,
+                                  g_object_ref (task));
+    }
+
+    sync_interfaces_operation_done (task, FALSE);
+    g_object_unref (task);
 }
 
 static void
@@ -12205,9 +12400,9 @@ iface_modem_sync_ready (MMIfaceModem *self,
         /* Abort the sync() operation right away, and report a new SIM event that will
          * disable the modem and trigger a full reprobe */
         mm_obj_warn (self, "SIM is locked... synchronization aborted");
-        g_task_return_new_error (task, MM_CORE_ERROR, MM_CORE_ERROR_ABORTED,
-                                 "Locked SIM found during modem interface synchronization");
-        g_object_unref (task);
+        syncing_complete (task,
+                          g_error_new (MM_CORE_ERROR, MM_CORE_ERROR_ABORTED,
+                                       "Locked SIM found during modem interface synchronization"));
         return;
     }
 
@@ -12227,6 +12422,12 @@ syncing_step (GTask *task)
     self = g_task_get_source_object (task);
     ctx = g_task_get_task_data (task);
 
+    /* If the deadline was reached, don't go on with any other step */
+    if (ctx->completed) {
+        g_object_unref (task);
+        return;
+    }
+
     switch (ctx->step) {
     case SYNCING_STEP_FIRST:
         ctx->step++;
@@ -12244,9 +12445,9 @@ syncing_step (GTask *task)
          * synchronizing other interfaces.
          */
         if (!self->priv->modem_dbus_skeleton) {
-            g_task_return_new_error (task, MM_CORE_ERROR, MM_CORE_ERROR_ABORTED,
-                                     "Synchronization aborted: no modem exposed in DBus");
-            g_object_unref (task);
+            syncing_complete (task,
+                              g_error_new (MM_CORE_ERROR, MM_CORE_ERROR_ABORTED,
+                                           "Synchronization aborted: no modem exposed in DBus"));
             return;
         }
         mm_obj_msg (self, "resume synchronization state (%d/%d): modem interface sync",
@@ -12256,40 +12457,15 @@ syncing_step (GTask *task)
                              task);
         return;
 
-    case SYNCING_STEP_IFACE_3GPP:
-        /* Start 3GPP interface synchronization, only if modem was enabled.
-         * We hardly depend on the registration and bearer status,
-         * therefore we cannot continue with the other steps until
-         * this one is finished.
-         */
-        if (self->priv->modem_3gpp_dbus_skeleton &&
-            (self->priv->modem_state >= MM_MODEM_STATE_ENABLED)) {
-            mm_obj_msg (self, "resume synchronization state (%d/%d): 3GPP interface sync",
-                        ctx->step, SYNCING_STEP_LAST);
-            mm_iface_modem_3gpp_sync (MM_IFACE_MODEM_3GPP (self), (GAsyncReadyCallback)iface_modem_3gpp_sync_ready, task);
-            return;
-        }
-        ctx->step++;
-        /* fall through */
-
-    case SYNCING_STEP_IFACE_TIME:
-        /* Start Time interface synchronization, only if modem was enabled */
-        if (self->priv->modem_time_dbus_skeleton &&
-            (self->priv->modem_state >= MM_MODEM_STATE_ENABLED)) {
-            mm_obj_msg (self, "resume synchronization state (%d/%d): time interface sync",
-                        ctx->step, SYNCING_STEP_LAST);
-            mm_iface_modem_time_sync (MM_IFACE_MODEM_TIME (self), (GAsyncReadyCallback)iface_modem_time_sync_ready, task);
-            return;
-        }
-        ctx->step++;
-        /* fall through */
+    case SYNCING_STEP_INTERFACES:
+        sync_interfaces (task);
+        return;
 
     case SYNCING_STEP_LAST:
         mm_obj_msg (self, "resume synchronization state (%d/%d): all done",
                     ctx->step, SYNCING_STEP_LAST);
         /* We are done without errors! */
-        g_task_return_boolean (task, TRUE);
-        g_object_unref (task);
+        syncing_complete (task, NULL);
         return;
 
     default:
@@ -12313,7 +12489,14 @@ synchronize (MMBaseModem         *self,
     /* Create SyncingContext */
     ctx = g_new0 (SyncingContext, 1);
     ctx->step = SYNCING_STEP_FIRST;
-    g_task_set_task_data (task, ctx, (GDestroyNotify)g_free);
+    ctx->timer = g_timer_new ();
+    g_task_set_task_data (task, ctx, (GDestroyNotify)syncing_context_free);
+
+    /* The deadline source doesn't hold a task reference, it is always
+     * removed before the flow reference is released */
+    ctx->deadline_id = g_timeout_add_seconds (SYNCING_DEADLINE_SECS,
+                                              (GSourceFunc)syncing_deadline_cb,
+                                              task);
 
     syncing_step (task);
 }
@@ -12852,6 +13035,14 @@ mm_broadband_modem_get_current_charset (MMBroadbandModem *self)
 
 /*****************************************************************************/
 
+gboolean
+mm_broadband_modem_get_cgev_reporting_enabled (MMBroadbandModem *self)
+{
+    return self->priv->modem_cgerep_enabled;
+}
+
+/*****************************************************************************/
+
 gchar *
 mm_broadband_modem_create_device_identifier (MMBroadbandModem  *self,
                                              const gchar       *ati,
@@ -110,6 +110,10 @@ MMBroadbandModem *mm_broadband_modem_new (const gchar *device,
 
 MMModemCharset mm_broadband_modem_get_current_charset (MMBroadbandModem *self);
 
+/* Whether +CGEV packet domain event reporting is enabled, so that bearers
+ * are notified about context deactivations without polling */
+gboolean mm_broadband_modem_get_cgev_reporting_enabled (MMBroadbandModem *self);
+
 /* Create a unique device identifier string using the ATI and ATI1 replies and some
  * additional internal info */
 gchar *mm_broadband_modem_create_device_identifier (MMBroadbandModem  *self,
@@ -41,6 +41,8 @@ static gboolean      debug;
 static MMFilterRule  filter_policy = MM_FILTER_POLICY_STRICT;
 static gboolean      no_auto_scan = NO_AUTO_SCAN_DEFAULT;
 static const gchar  *initial_kernel_events;
+static const gchar  *sim_cache_dir;
+static gboolean      regex_warm_up;
 
 static gboolean
 filter_policy_option_arg (const gchar  *option_name,
@@ -84,6 +86,16 @@ static const GOptionEntry entries[] = {
         "Path to initial kernel events file",
         "[PATH]"
     },
+    {
+        "sim-cache-dir", 0, 0, G_OPTION_ARG_FILENAME, &sim_cache_dir,
+        "Path to the directory where SIM card contents are cached",
+        "[PATH]"
+    },
+    {
+        "regex-warm-up", 0, 0, G_OPTION_ARG_NONE, &regex_warm_up,
+        "Compile all known response parser regular expressions on startup",
+        NULL
+    },
     {
         "debug", 0, 0, G_OPTION_ARG_NONE, &debug,
         "Run with extended debugging capabilities",
@@ -120,6 +132,18 @@ mm_context_get_no_auto_scan (void)
     return no_auto_scan;
 }
 
+const gchar *
+mm_context_get_sim_cache_dir (void)
+{
+    return sim_cache_dir;
+}
+
+gboolean
+mm_context_get_regex_warm_up (void)
+{
+    return regex_warm_up;
+}
+
 MMFilterRule
 mm_context_get_filter_policy (void)
 {
@@ -28,11 +28,13 @@
 #include "mm-log-object.h"
 #include "mm-log-helpers.h"
 
-#define SUPPORT_CHECKED_TAG "3gpp-profile-manager-support-checked-tag"
-#define SUPPORTED_TAG       "3gpp-profile-manager-supported-tag"
+#define SUPPORT_CHECKED_TAG    "3gpp-profile-manager-support-checked-tag"
+#define SUPPORTED_TAG          "3gpp-profile-manager-supported-tag"
+#define PROFILE_LIST_CACHE_TAG "3gpp-profile-manager-profile-list-cache-tag"
 
 static GQuark support_checked_quark;
 static GQuark supported_quark;
+static GQuark profile_list_cache_quark;
 
 /*****************************************************************************/
 
@@ -43,6 +45,119 @@ mm_iface_modem_3gpp_profile_manager_bind_simple_status (MMIfaceModem3gppProfileM
     /* Nothing shown in simple status */
 }
 
+/*****************************************************************************/
+/* Profile list cache
+ *
+ * Listing profiles may be expensive (e.g. one request per profile in QMI), and
+ * it is done several times during each connection attempt, so the last list is
+ * kept around. The cache is updated with our own profile updates, and it is
+ * invalidated whenever the modem reports that profiles changed, when profiles
+ * are deleted, and when the modem is enabled or disabled.
+ *
+ * Every invalidation bumps the generation counter, so that results of
+ * operations started before the invalidation are never stored. */
+
+typedef struct {
+    gboolean  valid;
+    guint     generation;
+    GList    *profiles;
+} ProfileListCache;
+
+static void
+profile_list_cache_free (ProfileListCache *cache)
+{
+    mm_3gpp_profile_list_free (cache->profiles);
+    g_slice_free (ProfileListCache, cache);
+}
+
+static ProfileListCache *
+get_profile_list_cache (MMIfaceModem3gppProfileManager *self)
+{
+    ProfileListCache *cache;
+
+    if (G_UNLIKELY (!profile_list_cache_quark))
+        profile_list_cache_quark = g_quark_from_static_string (PROFILE_LIST_CACHE_TAG);
+
+    cache = g_object_get_qdata (G_OBJECT (self), profile_list_cache_quark);
+    if (!cache) {
+        cache = g_slice_new0 (ProfileListCache);
+        g_object_set_qdata_full (G_OBJECT (self), profile_list_cache_quark, cache, (GDestroyNotify)profile_list_cache_free);
+    }
+    return cache;
+}
+
+static MM3gppProfile *
+profile_copy (MM3gppProfile *profile)
+{
+    g_autoptr(GVariant) dict = NULL;
+
+    dict = mm_3gpp_profile_get_dictionary (profile);
+    return mm_3gpp_profile_new_from_dictionary (dict, NULL);
+}
+
+static GList *
+profile_list_copy (GList *profiles)
+{
+    GList *copy = NULL;
+    GList *l;
+
+    for (l = profiles; l; l = g_list_next (l)) {
+        MM3gppProfile *profile;
+
+        profile = profile_copy (MM_3GPP_PROFILE (l->data));
+        if (profile)
+            copy = g_list_prepend (copy, profile);
+    }
+    return g_list_reverse (copy);
+}
+
+static void
+profile_list_cache_store (MMIfaceModem3gppProfileManager *self,
+                          guint                           generation,
+                          GList                          *profiles)
+{
+    ProfileListCache *cache;
+
+    cache = get_profile_list_cache (self);
+    if (cache->generation != generation)
+        return;
+
+    mm_3gpp_profile_list_free (cache->profiles);
+    cache->profiles = profile_list_copy (profiles);
+    cache->valid = TRUE;
+}
+
+MM3gppProfile *
+mm_iface_modem_3gpp_profile_manager_get_cached_profile (MMIfaceModem3gppProfileManager *self,
+                                                        gint                            profile_id)
+{
+    ProfileListCache *cache;
+    GList            *l;
+
+    cache = get_profile_list_cache (self);
+    if (!cache->valid)
+        return NULL;
+
+    for (l = cache->profiles; l; l = g_list_next (l)) {
+        if (mm_3gpp_profile_get_profile_id (MM_3GPP_PROFILE (l->data)) == profile_id)
+            return profile_copy (MM_3GPP_PROFILE (l->data));
+    }
+    return NULL;
+}
+
+void
+mm_iface_modem_3gpp_profile_manager_invalidate_profile_list (MMIfaceModem3gppProfileManager *self)
+{
+    ProfileListCache *cache;
+
+    cache = get_profile_list_cache (self);
+    cache->generation++;
+    if (cache->valid)
+        mm_obj_dbg (self, "profile list cache invalidated");
+    cache->valid = FALSE;
+    g_clear_pointer (&cache->profiles, mm_3gpp_profile_list_free);
+}
+
 /*****************************************************************************/
 
 void
@@ -50,6 +165,9 @@ mm_iface_modem_3gpp_profile_manager_updated (MMIfaceModem3gppProfileManager *sel
 {
     g_autoptr(MmGdbusModem3gppProfileManagerSkeleton) skeleton = NULL;
 
+    /* Profiles changed in the modem, cached list no longer valid */
+    mm_iface_modem_3gpp_profile_manager_invalidate_profile_list (self);
+
     g_object_get (self,
                   MM_IFACE_MODEM_3GPP_PROFILE_MANAGER_DBUS_SKELETON, &skeleton,
                   NULL);
@@ -129,6 +247,8 @@ typedef struct {
     MMBearerApnType        apn_type;
     gchar                 *apn_type_str;
     GList                 *before_list;
+    gboolean               before_list_loaded;
+    guint                  cache_generation;
     MM3gppProfile         *stored;
 } SetProfileContext;
 
@@ -223,6 +343,11 @@ profile_manager_store_profile_ready (MMIfaceModem3gppProfileManager *self,
 
     mm_obj_dbg (self, "stored profile '%s'", ctx->index_field_value_str);
 
+    /* The cached list is no longer valid after our own update; it will be
+     * rebuilt once the stored profile is read back */
+    mm_iface_modem_3gpp_profile_manager_invalidate_profile_list (self);
+    ctx->cache_generation = get_profile_list_cache (self)->generation;
+
     ctx->step++;
     set_profile_step (task);
 }
@@ -490,6 +615,8 @@ profile_manager_list_profiles_before_ready (MMIfaceModem3gppProfileManager *self
 
     if (!mm_iface_modem_3gpp_profile_manager_list_profiles_finish (self, res, &ctx->before_list, &error))
         mm_obj_dbg (self, "failed checking currently defined contexts: %s", error->message);
+    else
+        ctx->before_list_loaded = TRUE;
 
     ctx->step++;
     set_profile_step (task);
@@ -552,6 +679,48 @@ set_profile_step_check_format (GTask *task)
         task);
 }
 
+static gint
+profile_id_cmp (MM3gppProfile *a,
+                MM3gppProfile *b)
+{
+    return mm_3gpp_profile_get_profile_id (a) - mm_3gpp_profile_get_profile_id (b);
+}
+
+static void
+set_profile_update_cache (GTask *task)
+{
+    MMIfaceModem3gppProfileManager *self;
+    SetProfileContext              *ctx;
+    gint                            stored_profile_id;
+    GList                          *l;
+
+    self = g_task_get_source_object (task);
+    ctx  = g_task_get_task_data (task);
+
+    /* Only needed if we did update a profile ourselves; if an existing one was
+     * reused the cache is still valid */
+    if (!ctx->cache_generation)
+        return;
+
+    /* Rebuild the cached list from the one we loaded before the update and
+     * the profile we just stored, unless something invalidated the cache in
+     * the meantime (e.g. a profile changed indication) */
+    stored_profile_id = mm_3gpp_profile_get_profile_id (ctx->stored);
+    if (!ctx->before_list_loaded || stored_profile_id == MM_3GPP_PROFILE_ID_UNKNOWN)
+        return;
+
+    for (l = ctx->before_list; l; l = g_list_next (l)) {
+        if (mm_3gpp_profile_get_profile_id (MM_3GPP_PROFILE (l->data)) == stored_profile_id) {
+            g_object_unref (l->data);
+            ctx->before_list = g_list_delete_link (ctx->before_list, l);
+            break;
+        }
+    }
+    ctx->before_list = g_list_insert_sorted (ctx->before_list, g_object_ref (ctx->stored), (GCompareFunc)profile_id_cmp);
+
+    profile_list_cache_store (self, ctx->cache_generation, ctx->before_list);
+}
+
 static void
 set_profile_step (GTask *task)
 {
@@ -658,6 +827,7 @@ set_profile_step (GTask *task)
         mm_obj_dbg (self, "set profile state (%d/%d): all done",
                     ctx->step, SET_PROFILE_STEP_LAST);
         g_assert (ctx->stored);
+        set_profile_update_cache (task);
         g_task_return_pointer (task, g_steal_pointer (&ctx->stored), g_object_unref);
         g_object_unref (task);
         return;
@@ -735,6 +905,11 @@ mm_iface_modem_3gpp_profile_manager_set_profile (MMIfaceModem3gppProfileManager
 
 /*****************************************************************************/
 
+static void list_profiles (MMIfaceModem3gppProfileManager *self,
+                           gboolean                        use_cache,
+                           GAsyncReadyCallback             callback,
+                           gpointer                        user_data);
+
 MM3gppProfile *
 mm_iface_modem_3gpp_profile_manager_get_profile_finish (MMIfaceModem3gppProfileManager  *self,
                                                         GAsyncResult                    *res,
@@ -755,7 +930,7 @@ get_profile_list_ready (MMIfaceModem3gppProfileManager *self,
 
     profile_id = GPOINTER_TO_INT (g_task_get_task_data (task));
 
-    if (!MM_IFACE_MODEM_3GPP_PROFILE_MANAGER_GET_INTERFACE (self)->list_profiles_finish (self, res, &profiles, &error)) {
+    if (!mm_iface_modem_3gpp_profile_manager_list_profiles_finish (self, res, &profiles, &error)) {
         g_task_return_error (task, error);
         g_object_unref (task);
         return;
@@ -809,18 +984,21 @@ mm_iface_modem_3gpp_profile_manager_get_profile (MMIfaceModem3gppProfileManager
         return;
     }
 
-    /* If there is no way to query one single profile, query all and filter */
+    /* If there is no way to query one single profile, query all and filter.
+     * The cached list is not used, as this is how updates are validated. */
     g_task_set_task_data (task, GINT_TO_POINTER (profile_id), NULL);
 
-    mm_iface_modem_3gpp_profile_manager_list_profiles (self,
-                                                       (GAsyncReadyCallback)get_profile_list_ready,
-                                                       task);
+    list_profiles (self,
+                   FALSE,
+                   (GAsyncReadyCallback)get_profile_list_ready,
+                   task);
 }
 
 /*****************************************************************************/
 
 typedef struct {
     GList *profiles;
+    guint  cache_generation;
 } ListProfilesContext;
 
 static void
@@ -855,24 +1033,40 @@ internal_list_profiles_ready (MMIfaceModem3gppProfileManager *self,
     ListProfilesContext *ctx;
     GError              *error = NULL;
 
-    ctx = g_slice_new0 (ListProfilesContext);
-    g_task_set_task_data (task, ctx, (GDestroyNotify) list_profiles_context_free);
+    ctx = g_task_get_task_data (task);
 
     if (!MM_IFACE_MODEM_3GPP_PROFILE_MANAGER_GET_INTERFACE (self)->list_profiles_finish (self, res, &ctx->profiles, &error))
         g_task_return_error (task, error);
-    else
+    else {
+        profile_list_cache_store (self, ctx->cache_generation, ctx->profiles);
         g_task_return_boolean (task, TRUE);
+    }
     g_object_unref (task);
 }
 
-void
-mm_iface_modem_3gpp_profile_manager_list_profiles (MMIfaceModem3gppProfileManager *self,
-                                                   GAsyncReadyCallback             callback,
-                                                   gpointer                        user_data)
+static void
+list_profiles (MMIfaceModem3gppProfileManager *self,
+               gboolean                        use_cache,
+               GAsyncReadyCallback             callback,
+               gpointer                        user_data)
 {
-    GTask *task;
+    GTask               *task;
+    ListProfilesContext *ctx;
+    ProfileListCache    *cache;
 
     task = g_task_new (self, NULL, callback, user_data);
+    ctx = g_slice_new0 (ListProfilesContext);
+    g_task_set_task_data (task, ctx, (GDestroyNotify) list_profiles_context_free);
+
+    cache = get_profile_list_cache (self);
+    if (use_cache && cache->valid) {
+        mm_obj_dbg (self, "using cached profile list");
+        ctx->profiles = profile_list_copy (cache->profiles);
+        g_task_return_boolean (task, TRUE);
+        g_object_unref (task);
+        return;
+    }
+    ctx->cache_generation = cache->generation;
 
     /* Internal calls to the list profile logic may be performed even if the 3GPP Profile Manager
      * interface is not exposed in DBus, therefore, make sure this logic exits cleanly if there
@@ -891,6 +1085,14 @@ mm_iface_modem_3gpp_profile_manager_list_profiles (MMIfaceModem3gppProfileManage
         task);
 }
 
+void
+mm_iface_modem_3gpp_profile_manager_list_profiles (MMIfaceModem3gppProfileManager *self,
+                                                   GAsyncReadyCallback             callback,
+                                                   gpointer                        user_data)
+{
+    list_profiles (self, TRUE, callback, user_data);
+}
+
 /*****************************************************************************/
 
 typedef struct {
@@ -980,9 +1182,11 @@ handle_list_auth_ready (MMBaseModem       *self,
     mm_obj_info (self, "processing user request to list 3GPP profiles...");
 
     /* Don't call the class callback directly, use the common helper method
-     * that is also used by other internal operations. */
-    mm_iface_modem_3gpp_profile_manager_list_profiles (
+     * that is also used by other internal operations. An explicit user request
+     * always reloads the list from the modem, refreshing the cache. */
+    list_profiles (
         MM_IFACE_MODEM_3GPP_PROFILE_MANAGER (self),
+        FALSE,
         (GAsyncReadyCallback)list_profiles_ready,
         ctx);
 }
@@ -1151,6 +1355,9 @@ delete_profile_ready (MMIfaceModem3gppProfileManager *self,
 {
     GError *error = NULL;
 
+    /* Whatever the result, the cached list may no longer be valid */
+    mm_iface_modem_3gpp_profile_manager_invalidate_profile_list (self);
+
     if (!MM_IFACE_MODEM_3GPP_PROFILE_MANAGER_GET_INTERFACE (self)->delete_profile_finish (self, res, &error)) {
         mm_obj_warn (self, "failed deleting 3GPP profile: %s", error->message);
         g_dbus_method_invocation_take_error (ctx->invocation, error);
@@ -1353,6 +1560,7 @@ interface_disabling_step (GTask *task)
 
     switch (ctx->step) {
     case DISABLING_STEP_FIRST:
+        mm_iface_modem_3gpp_profile_manager_invalidate_profile_list (self);
         ctx->step++;
         /* fall through */
 
@@ -1503,6 +1711,7 @@ interface_enabling_step (GTask *task)
 
     switch (ctx->step) {
     case ENABLING_STEP_FIRST:
+        mm_iface_modem_3gpp_profile_manager_invalidate_profile_list (self);
         ctx->step++;
         /* fall through */
 
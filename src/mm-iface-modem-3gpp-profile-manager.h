@@ -222,9 +222,19 @@ void mm_iface_modem_3gpp_profile_manager_shutdown (MMIfaceModem3gppProfileManage
 void mm_iface_modem_3gpp_profile_manager_bind_simple_status (MMIfaceModem3gppProfileManager *self,
                                                              MMSimpleStatus                 *status);
 
-/* Helper to emit the Updated signal by implementations */
+/* Helper to emit the Updated signal by implementations; this also invalidates
+ * the cached profile list */
 void mm_iface_modem_3gpp_profile_manager_updated (MMIfaceModem3gppProfileManager *self);
 
+/* Invalidate the cached profile list, e.g. if profiles may have been changed
+ * without the modem reporting it */
+void mm_iface_modem_3gpp_profile_manager_invalidate_profile_list (MMIfaceModem3gppProfileManager *self);
+
+/* Get a copy of the given profile from the cached profile list, or NULL if
+ * the cache isn't valid or the profile isn't found in it */
+MM3gppProfile *mm_iface_modem_3gpp_profile_manager_get_cached_profile (MMIfaceModem3gppProfileManager *self,
+                                                                       gint                            profile_id);
+
 /* Internal list profile management */
 void           mm_iface_modem_3gpp_profile_manager_get_profile          (MMIfaceModem3gppProfileManager  *self,
                                                                          gint                             profile_id,
@@ -71,11 +71,22 @@ typedef struct {
     /* Registration checks */
     guint    check_timeout_source;
     gboolean check_running;
+    /* Network scan: last results and requests waiting for the ongoing scan */
+    GVariant *scan_results;
+    gint64    scan_results_time;
+    gint64    scan_results_timestamp;
+    GList    *scan_waiters;
+    /* Bumped whenever the results become invalid, so that a scan started
+     * before that doesn't store its results */
+    guint     scan_results_generation;
 } Private;
 
 static void
 private_free (Private *priv)
 {
+    g_assert (!priv->scan_waiters);
+    if (priv->scan_results)
+        g_variant_unref (priv->scan_results);
     g_free (priv->manual_registration_operator_id);
     if (priv->pending_registration_cancellable) {
         g_cancellable_cancel (priv->pending_registration_cancellable);
@@ -858,6 +869,10 @@ typedef struct {
     MmGdbusModem3gpp      *skeleton;
     GDBusMethodInvocation *invocation;
     MMIfaceModem3gpp      *self;
+    /* Whether it's a ScanWithSettings() request, and its settings */
+    gboolean               with_settings;
+    GVariant              *settings;
+    guint                  max_age;
 } HandleScanContext;
 
 static void
@@ -866,9 +881,22 @@ handle_scan_context_free (HandleScanContext *ctx)
     g_object_unref (ctx->skeleton);
     g_object_unref (ctx->invocation);
     g_object_unref (ctx->self);
+    if (ctx->settings)
+        g_variant_unref (ctx->settings);
     g_slice_free (HandleScanContext, ctx);
 }
 
+static void
+handle_scan_complete (HandleScanContext *ctx,
+                      GVariant          *results,
+                      gint64             timestamp)
+{
+    if (ctx->with_settings)
+        mm_gdbus_modem3gpp_complete_scan_with_settings (ctx->skeleton, ctx->invocation, results, timestamp);
+    else
+        mm_gdbus_modem3gpp_complete_scan (ctx->skeleton, ctx->invocation, results);
+}
+
 static GVariant *
 build_scan_networks_result (MMIfaceModem3gpp *self,
                             GList            *info_list)
@@ -911,37 +939,102 @@ build_scan_networks_result (MMIfaceModem3gpp *self,
 }
 
 static void
-handle_scan_ready (MMIfaceModem3gpp  *self,
-                   GAsyncResult      *res,
-                   HandleScanContext *ctx)
+handle_scan_ready (MMIfaceModem3gpp *self,
+                   GAsyncResult     *res,
+                   gpointer          generation)
 {
-    GError              *error = NULL;
-    GList               *info_list;
-    g_autoptr(GVariant)  dict_array = NULL;
+    g_autoptr(GError)  error = NULL;
+    GList             *info_list;
+    GList             *waiters;
+    GList             *l;
+    Private           *priv;
+
+    priv = get_private (self);
+
+    /* All requests received while the scan was ongoing get the same result */
+    waiters = g_steal_pointer (&priv->scan_waiters);
 
     info_list = MM_IFACE_MODEM_3GPP_GET_INTERFACE (self)->scan_networks_finish (self, res, &error);
     if (error) {
         mm_obj_warn (self, "failed scanning networks: %s", error->message);
-        g_dbus_method_invocation_take_error (ctx->invocation, error);
-        handle_scan_context_free (ctx);
-        return;
+        for (l = waiters; l; l = g_list_next (l))
+            g_dbus_method_invocation_return_gerror (((HandleScanContext *)(l->data))->invocation, error);
+    } else {
+        g_autoptr(GVariant) results = NULL;
+        gint64              timestamp;
+
+        mm_obj_info (self, "network scan performed: %u found", g_list_length (info_list));
+        results = build_scan_networks_result (self, info_list);
+        timestamp = g_get_real_time () / G_USEC_PER_SEC;
+
+        /* Don't keep the results if the modem was disabled in the meantime */
+        if (GPOINTER_TO_UINT (generation) == priv->scan_results_generation) {
+            g_clear_pointer (&priv->scan_results, g_variant_unref);
+            priv->scan_results = g_variant_ref (results);
+            priv->scan_results_time = g_get_monotonic_time ();
+            priv->scan_results_timestamp = timestamp;
+        } else
+            mm_obj_dbg (self, "network scan results not stored: no longer valid");
+
+        for (l = waiters; l; l = g_list_next (l))
+            handle_scan_complete ((HandleScanContext *)(l->data), results, timestamp);
+        mm_3gpp_network_info_list_free (info_list);
     }
 
-    mm_obj_info (self, "network scan performed: %u found", g_list_length (info_list));
-    dict_array = build_scan_networks_result (self, info_list);
-    mm_gdbus_modem3gpp_complete_scan (ctx->skeleton, ctx->invocation, dict_array);
-    mm_3gpp_network_info_list_free (info_list);
-    handle_scan_context_free (ctx);
+    g_list_free_full (waiters, (GDestroyNotify)handle_scan_context_free);
+}
+
+static gboolean
+handle_scan_parse_settings (HandleScanContext  *ctx,
+                            GError            **error)
+{
+    GVariantIter  iter;
+    gchar        *key;
+    GVariant     *value;
+
+    if (!ctx->settings)
+        return TRUE;
+
+    g_variant_iter_init (&iter, ctx->settings);
+    while (g_variant_iter_next (&iter, "{sv}", &key, &value)) {
+        gboolean valid = TRUE;
+
+        if (g_str_equal (key, "max-age")) {
+            if (g_variant_is_of_type (value, G_VARIANT_TYPE_UINT32))
+                ctx->max_age = g_variant_get_uint32 (value);
+            else
+                valid = FALSE;
+        } else
+            valid = FALSE;
+
+        if (!valid)
+            g_set_error (error, MM_CORE_ERROR, MM_CORE_ERROR_INVALID_ARGS,
+                         "Invalid scan setting '%s' (%s)", key, g_variant_get_type_string (value));
+        g_free (key);
+        g_variant_unref (value);
+        if (!valid)
+            return FALSE;
+    }
+
+    return TRUE;
 }
 
 static void
-handle_scan_auth_ready (MMBaseModem       *self,
+handle_scan_auth_ready (MMBaseModem       *_self,
                         GAsyncResult      *res,
                         HandleScanContext *ctx)
 {
-    GError *error = NULL;
+    MMIfaceModem3gpp *self = MM_IFACE_MODEM_3GPP (_self);
+    GError           *error = NULL;
+    Private          *priv;
 
-    if (!mm_base_modem_authorize_finish (self, res, &error)) {
+    if (!mm_base_modem_authorize_finish (_self, res, &error)) {
+        g_dbus_method_invocation_take_error (ctx->invocation, error);
+        handle_scan_context_free (ctx);
+        return;
+    }
+
+    if (!handle_scan_parse_settings (ctx, &error)) {
         g_dbus_method_invocation_take_error (ctx->invocation, error);
         handle_scan_context_free (ctx);
         return;
@@ -965,16 +1058,37 @@ handle_scan_auth_ready (MMBaseModem       *self,
         return;
     }
 
+    priv = get_private (self);
+
+    /* Reuse the last results if recent enough */
+    if (ctx->max_age &&
+        priv->scan_results &&
+        (g_get_monotonic_time () - priv->scan_results_time) <= ((gint64) ctx->max_age * G_USEC_PER_SEC)) {
+        mm_obj_dbg (self, "network scan results reused (%" G_GINT64_FORMAT " seconds old)",
+                    (g_get_monotonic_time () - priv->scan_results_time) / G_USEC_PER_SEC);
+        handle_scan_complete (ctx, priv->scan_results, priv->scan_results_timestamp);
+        handle_scan_context_free (ctx);
+        return;
+    }
+
+    /* Join the ongoing scan, if any */
+    priv->scan_waiters = g_list_append (priv->scan_waiters, ctx);
+    if (priv->scan_waiters->next) {
+        mm_obj_dbg (self, "network scan already in progress: waiting for its results");
+        return;
+    }
+
     MM_IFACE_MODEM_3GPP_GET_INTERFACE (self)->scan_networks (
-        MM_IFACE_MODEM_3GPP (self),
+        self,
         (GAsyncReadyCallback)handle_scan_ready,
-        ctx);
+        GUINT_TO_POINTER (priv->scan_results_generation));
 }
 
-static gboolean
-handle_scan (MmGdbusModem3gpp      *skeleton,
-             GDBusMethodInvocation *invocation,
-             MMIfaceModem3gpp      *self)
+static void
+handle_scan_common (MmGdbusModem3gpp      *skeleton,
+                    GDBusMethodInvocation *invocation,
+                    GVariant              *settings,
+                    MMIfaceModem3gpp      *self)
 {
     HandleScanContext *ctx;
 
@@ -982,12 +1096,34 @@ handle_scan (MmGdbusModem3gpp      *skeleton,
     ctx->skeleton = g_object_ref (skeleton);
     ctx->invocation = g_object_ref (invocation);
     ctx->self = g_object_ref (self);
+    if (settings) {
+        ctx->with_settings = TRUE;
+        ctx->settings = g_variant_ref (settings);
+    }
 
     mm_base_modem_authorize (MM_BASE_MODEM (self),
                              invocation,
                              MM_AUTHORIZATION_DEVICE_CONTROL,
                              (GAsyncReadyCallback)handle_scan_auth_ready,
                              ctx);
+}
+
+static gboolean
+handle_scan (MmGdbusModem3gpp      *skeleton,
+             GDBusMethodInvocation *invocation,
+             MMIfaceModem3gpp      *self)
+{
+    handle_scan_common (skeleton, invocation, NULL, self);
+    return TRUE;
+}
+
+static gboolean
+handle_scan_with_settings (MmGdbusModem3gpp      *skeleton,
+                           GDBusMethodInvocation *invocation,
+                           GVariant              *settings,
+                           MMIfaceModem3gpp      *self)
+{
+    handle_scan_common (skeleton, invocation, settings, self);
     return TRUE;
 }
 
@@ -2571,6 +2707,13 @@ mm_iface_modem_3gpp_disable (MMIfaceModem3gpp *self,
 {
     DisablingContext *ctx;
     GTask *task;
+    Private *priv;
+
+    /* Network scan results are no longer valid once disabled, including
+     * those of any scan still ongoing */
+    priv = get_private (self);
+    g_clear_pointer (&priv->scan_results, g_variant_unref);
+    priv->scan_results_generation++;
 
     ctx = g_new0 (DisablingContext, 1);
     ctx->step = DISABLING_STEP_FIRST;
@@ -3333,6 +3476,10 @@ interface_initialization_step (GTask *task)
                           "handle-scan",
                           G_CALLBACK (handle_scan),
                           self);
+        g_signal_connect (ctx->skeleton,
+                          "handle-scan-with-settings",
+                          G_CALLBACK (handle_scan_with_settings),
+                          self);
         g_signal_connect (ctx->skeleton,
                           "handle-set-eps-ue-mode-operation",
                           G_CALLBACK (handle_set_eps_ue_mode_operation),
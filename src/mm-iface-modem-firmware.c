@@ -43,38 +43,40 @@ typedef struct {
     MMIfaceModemFirmware *self;
     MmGdbusModemFirmware *skeleton;
     GDBusMethodInvocation *invocation;
-    GList *list;
-    MMFirmwareProperties *current;
 } HandleListContext;
 
 static void
 handle_list_context_free (HandleListContext *ctx)
 {
-    if (ctx->list)
-        g_list_free_full (ctx->list, g_object_unref);
-    if (ctx->current)
-        g_object_unref (ctx->current);
     g_object_unref (ctx->skeleton);
     g_object_unref (ctx->invocation);
     g_object_unref (ctx->self);
     g_slice_free (HandleListContext, ctx);
 }
 
+static void
+firmware_list_free (GList *list)
+{
+    g_list_free_full (list, g_object_unref);
+}
+
 static void
 load_current_ready (MMIfaceModemFirmware *self,
                     GAsyncResult *res,
-                    HandleListContext *ctx)
+                    GTask *task)
 {
     GVariantBuilder builder;
+    GList *list;
     GList *l;
+    MMFirmwareProperties *current;
     GError *error = NULL;
 
-    ctx->current = MM_IFACE_MODEM_FIRMWARE_GET_INTERFACE (self)->load_current_finish (self, res, &error);
-    if (!ctx->current) {
+    current = MM_IFACE_MODEM_FIRMWARE_GET_INTERFACE (self)->load_current_finish (self, res, &error);
+    if (!current) {
         /* Not found isn't fatal */
         if (!g_error_matches (error, MM_CORE_ERROR, MM_CORE_ERROR_NOT_FOUND)) {
-            g_dbus_method_invocation_take_error (ctx->invocation, error);
-            handle_list_context_free (ctx);
+            g_task_return_error (task, error);
+            g_object_unref (task);
             return;
         }
         mm_obj_dbg (self, "couldn't load current firmware image: %s", error->message);
@@ -82,8 +84,9 @@ load_current_ready (MMIfaceModemFirmware *self,
     }
 
     /* Build array of dicts */
+    list = g_task_get_task_data (task);
     g_variant_builder_init (&builder, G_VARIANT_TYPE ("aa{sv}"));
-    for (l = ctx->list; l; l = g_list_next (l)) {
+    for (l = list; l; l = g_list_next (l)) {
         GVariant *dict;
 
         dict = mm_firmware_properties_get_dictionary (MM_FIRMWARE_PROPERTIES (l->data));
@@ -91,36 +94,71 @@ load_current_ready (MMIfaceModemFirmware *self,
         g_variant_unref (dict);
     }
 
-    mm_gdbus_modem_firmware_complete_list (
-        ctx->skeleton,
-        ctx->invocation,
-        (ctx->current ? mm_firmware_properties_get_unique_id (ctx->current) : ""),
-        g_variant_builder_end (&builder));
-    handle_list_context_free (ctx);
+    g_task_return_pointer (task,
+                           g_variant_ref_sink (g_variant_new ("(s@aa{sv})",
+                                                              (current ? mm_firmware_properties_get_unique_id (current) : ""),
+                                                              g_variant_builder_end (&builder))),
+                           (GDestroyNotify) g_variant_unref);
+    if (current)
+        g_object_unref (current);
+    g_object_unref (task);
 }
 
 static void
 load_list_ready (MMIfaceModemFirmware *self,
                  GAsyncResult *res,
-                 HandleListContext *ctx)
+                 GTask *task)
 {
+    GList *list;
     GError *error = NULL;
 
-    ctx->list = MM_IFACE_MODEM_FIRMWARE_GET_INTERFACE (self)->load_list_finish (self, res, &error);
-    if (!ctx->list) {
+    list = MM_IFACE_MODEM_FIRMWARE_GET_INTERFACE (self)->load_list_finish (self, res, &error);
+    if (!list) {
         /* Not found isn't fatal */
         if (!g_error_matches (error, MM_CORE_ERROR, MM_CORE_ERROR_NOT_FOUND)) {
-            g_dbus_method_invocation_take_error (ctx->invocation, error);
-            handle_list_context_free (ctx);
+            g_task_return_error (task, error);
+            g_object_unref (task);
             return;
         }
         mm_obj_dbg (self, "couldn't load firmware image list: %s", error->message);
         g_clear_error (&error);
     }
 
+    g_task_set_task_data (task, list, (GDestroyNotify) firmware_list_free);
     MM_IFACE_MODEM_FIRMWARE_GET_INTERFACE (self)->load_current (MM_IFACE_MODEM_FIRMWARE (self),
                                                                 (GAsyncReadyCallback)load_current_ready,
-                                                                ctx);
+                                                                task);
+}
+
+static void
+load_list (MMBaseModem *self,
+           GTask *task)
+{
+    MM_IFACE_MODEM_FIRMWARE_GET_INTERFACE (self)->load_list (MM_IFACE_MODEM_FIRMWARE (self),
+                                                             (GAsyncReadyCallback)load_list_ready,
+                                                             task);
+}
+
+static void
+list_ready (MMBaseModem *self,
+            GAsyncResult *res,
+            HandleListContext *ctx)
+{
+    g_autoptr(GVariant) result = NULL;
+    g_autoptr(GVariant) installed = NULL;
+    const gchar *selected;
+    GError *error = NULL;
+
+    result = mm_base_modem_coalesce_finish (self, res, &error);
+    if (!result) {
+        g_dbus_method_invocation_take_error (ctx->invocation, error);
+        handle_list_context_free (ctx);
+        return;
+    }
+
+    g_variant_get (result, "(&s@aa{sv})", &selected, &installed);
+    mm_gdbus_modem_firmware_complete_list (ctx->skeleton, ctx->invocation, selected, installed);
+    handle_list_context_free (ctx);
 }
 
 static void
@@ -148,9 +186,11 @@ list_auth_ready (MMBaseModem *self,
         return;
     }
 
-    MM_IFACE_MODEM_FIRMWARE_GET_INTERFACE (self)->load_list (MM_IFACE_MODEM_FIRMWARE (self),
-                                                             (GAsyncReadyCallback)load_list_ready,
-                                                             ctx);
+    mm_base_modem_coalesce (self,
+                            "firmware-list",
+                            load_list,
+                            (GAsyncReadyCallback)list_ready,
+                            ctx);
 }
 
 static gboolean
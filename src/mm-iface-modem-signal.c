@@ -34,24 +34,59 @@ static GQuark supported_quark;
 #define PRIVATE_TAG "signal-private-tag"
 static GQuark private_quark;
 
+typedef struct {
+    gint64                  timestamp;
+    MMModemAccessTechnology access_technology;
+    gdouble                 rssi;
+    gdouble                 rsrp;
+    gdouble                 rsrq;
+    gdouble                 sinr;
+} HistorySignalSample;
+
+typedef struct {
+    gint64    timestamp;
+    GVariant *cell_info;
+} HistoryCellInfoSample;
+
 typedef struct {
     /* interface enabled */
     gboolean enabled;
     /* polling-based reporting  */
     guint    rate;
     guint    timeout_source;
+    gboolean polling_running;
+    /* time since last update not triggered by our own polling */
+    GTimer   *indication_timer;
     /* threshold-based reporting */
     guint    rssi_threshold;
     gboolean error_rate_threshold;
     /* info logging control */
     GTimer   *info_log_timer;
+    /* history, as ring buffers of history_size samples */
+    guint                  history_resolution;
+    guint                  history_size;
+    guint                  history_timeout_source;
+    gboolean               history_cell_info_running;
+    HistorySignalSample   *history_signal;
+    guint                  history_signal_first;
+    guint                  history_signal_n;
+    HistoryCellInfoSample *history_cell_info;
+    guint                  history_cell_info_first;
+    guint                  history_cell_info_n;
 } Private;
 
+static void history_clear (Private *priv);
+
 static void
 private_free (Private *priv)
 {
+    history_clear (priv);
+    if (priv->history_timeout_source)
+        g_source_remove (priv->history_timeout_source);
     if (priv->info_log_timer)
         g_timer_destroy (priv->info_log_timer);
+    if (priv->indication_timer)
+        g_timer_destroy (priv->indication_timer);
     if (priv->timeout_source)
         g_source_remove (priv->timeout_source);
     g_slice_free (Private, priv);
@@ -110,6 +145,204 @@ info_log_signal_quality (MMIfaceModemSignal *self,
     mm_obj_info (self, "%s: %s", rat, printable);
 };
 
+/*****************************************************************************/
+/* History
+ *
+ * Samples are stored in fixed-size ring buffers, oldest first. At most one
+ * sample per access technology (or one cell info list) is stored for each
+ * resolution period; newer values reported within the same period replace
+ * the previous ones.
+ */
+
+#define HISTORY_SIZE_DEFAULT 360
+#define HISTORY_SIZE_MAX     86400
+
+static guint
+history_index (guint first,
+               guint i,
+               guint size)
+{
+    return (first + i) % size;
+}
+
+/* Returns the index of the slot to use for a new sample, dropping the
+ * oldest one if the ring buffer is full */
+static guint
+history_push (guint *first,
+              guint *n,
+              guint  size)
+{
+    guint index;
+
+    if (*n < size) {
+        index = history_index (*first, *n, size);
+        (*n)++;
+    } else {
+        index = *first;
+        *first = history_index (*first, 1, size);
+    }
+    return index;
+}
+
+static void
+history_clear (Private *priv)
+{
+    guint i;
+
+    for (i = 0; i < priv->history_cell_info_n; i++)
+        g_variant_unref (priv->history_cell_info[history_index (priv->history_cell_info_first, i, priv->history_size)].cell_info);
+
+    g_clear_pointer (&priv->history_signal, g_free);
+    g_clear_pointer (&priv->history_cell_info, g_free);
+    priv->history_signal_first = 0;
+    priv->history_signal_n = 0;
+    priv->history_cell_info_first = 0;
+    priv->history_cell_info_n = 0;
+    priv->history_size = 0;
+}
+
+/* Resize the ring buffers, keeping the newest samples */
+static void
+history_resize (Private *priv,
+                guint    size)
+{
+    HistorySignalSample   *signal_samples;
+    HistoryCellInfoSample *cell_info_samples;
+    guint                  skip;
+    guint                  i;
+
+    g_assert (size > 0);
+
+    if (size == priv->history_size)
+        return;
+
+    signal_samples = g_new0 (HistorySignalSample, size);
+    skip = (priv->history_signal_n > size) ? (priv->history_signal_n - size) : 0;
+    for (i = skip; i < priv->history_signal_n; i++)
+        signal_samples[i - skip] = priv->history_signal[history_index (priv->history_signal_first, i, priv->history_size)];
+    priv->history_signal_n -= skip;
+    priv->history_signal_first = 0;
+
+    cell_info_samples = g_new0 (HistoryCellInfoSample, size);
+    skip = (priv->history_cell_info_n > size) ? (priv->history_cell_info_n - size) : 0;
+    for (i = 0; i < priv->history_cell_info_n; i++) {
+        HistoryCellInfoSample *sample;
+
+        sample = &priv->history_cell_info[history_index (priv->history_cell_info_first, i, priv->history_size)];
+        if (i < skip)
+            g_variant_unref (sample->cell_info);
+        else
+            cell_info_samples[i - skip] = *sample;
+    }
+    priv->history_cell_info_n -= skip;
+    priv->history_cell_info_first = 0;
+
+    g_free (priv->history_signal);
+    priv->history_signal = signal_samples;
+    g_free (priv->history_cell_info);
+    priv->history_cell_info = cell_info_samples;
+    priv->history_size = size;
+}
+
+static void
+history_add_signal (Private                 *priv,
+                    gint64                   now,
+                    MMModemAccessTechnology  access_technology,
+                    MMSignal                *info)
+{
+    HistorySignalSample *sample = NULL;
+    gint64               period;
+    guint                i;
+
+    if (!info)
+        return;
+
+    /* Look for a sample of the same access technology in the current period */
+    period = now / priv->history_resolution;
+    for (i = priv->history_signal_n; i > 0; i--) {
+        HistorySignalSample *aux;
+
+        aux = &priv->history_signal[history_index (priv->history_signal_first, i - 1, priv->history_size)];
+        if (aux->timestamp / priv->history_resolution != period)
+            break;
+        if (aux->access_technology == access_technology) {
+            sample = aux;
+            break;
+        }
+    }
+
+    if (!sample)
+        sample = &priv->history_signal[history_push (&priv->history_signal_first,
+                                                     &priv->history_signal_n,
+                                                     priv->history_size)];
+
+    sample->timestamp = now;
+    sample->access_technology = access_technology;
+    sample->rssi = mm_signal_get_rssi (info);
+    sample->rsrp = mm_signal_get_rsrp (info);
+    sample->rsrq = mm_signal_get_rsrq (info);
+    sample->sinr = mm_signal_get_sinr (info);
+    if (sample->sinr == MM_SIGNAL_UNKNOWN)
+        sample->sinr = mm_signal_get_snr (info);
+}
+
+static void
+history_update_signal (MMIfaceModemSignal *self,
+                       MMSignal           *cdma,
+                       MMSignal           *evdo,
+                       MMSignal           *gsm,
+                       MMSignal           *umts,
+                       MMSignal           *lte,
+                       MMSignal           *nr5g)
+{
+    Private *priv;
+    gint64   now;
+
+    priv = get_private (self);
+    if (!priv->enabled || !priv->history_resolution)
+        return;
+
+    now = g_get_real_time () / G_USEC_PER_SEC;
+    history_add_signal (priv, now, MM_MODEM_ACCESS_TECHNOLOGY_1XRTT, cdma);
+    history_add_signal (priv, now, MM_MODEM_ACCESS_TECHNOLOGY_EVDO0, evdo);
+    history_add_signal (priv, now, MM_MODEM_ACCESS_TECHNOLOGY_GSM,   gsm);
+    history_add_signal (priv, now, MM_MODEM_ACCESS_TECHNOLOGY_UMTS,  umts);
+    history_add_signal (priv, now, MM_MODEM_ACCESS_TECHNOLOGY_LTE,   lte);
+    history_add_signal (priv, now, MM_MODEM_ACCESS_TECHNOLOGY_5GNR,  nr5g);
+}
+
+void
+mm_iface_modem_signal_update_cell_info_history (MMIfaceModemSignal *self,
+                                                GVariant           *cell_info)
+{
+    HistoryCellInfoSample *sample = NULL;
+    Private               *priv;
+    gint64                 now;
+
+    priv = get_private (self);
+    if (!priv->enabled || !priv->history_resolution)
+        return;
+
+    now = g_get_real_time () / G_USEC_PER_SEC;
+    if (priv->history_cell_info_n > 0) {
+        sample = &priv->history_cell_info[history_index (priv->history_cell_info_first,
+                                                         priv->history_cell_info_n - 1,
+                                                         priv->history_size)];
+        if (sample->timestamp / priv->history_resolution != now / priv->history_resolution)
+            sample = NULL;
+    }
+
+    if (!sample)
+        sample = &priv->history_cell_info[history_push (&priv->history_cell_info_first,
+                                                        &priv->history_cell_info_n,
+                                                        priv->history_size)];
+
+    /* slots are either unused or hold a sample to be replaced */
+    g_clear_pointer (&sample->cell_info, g_variant_unref);
+    sample->cell_info = g_variant_ref (cell_info);
+    sample->timestamp = now;
+}
+
 /*****************************************************************************/
 
 static void
@@ -193,6 +426,19 @@ mm_iface_modem_signal_update (MMIfaceModemSignal *self,
     Private *priv;
 
     priv = get_private (self);
+
+    /* Updates received while our own polling isn't running come from
+     * indications or from other loading operations, and are fresh enough
+     * to skip the next polling iteration */
+    if (!priv->polling_running) {
+        if (G_UNLIKELY (!priv->indication_timer))
+            priv->indication_timer = g_timer_new ();
+        else
+            g_timer_start (priv->indication_timer);
+    }
+
+    history_update_signal (self, cdma, evdo, gsm, umts, lte, nr5g);
+
     if (!priv->enabled || (!priv->rate && !priv->rssi_threshold && !priv->error_rate_threshold)) {
         mm_obj_dbg (self, "skipping extended signal information update...");
         return;
@@ -230,6 +476,9 @@ load_values_ready (MMIfaceModemSignal *self,
     g_autoptr(MMSignal) umts = NULL;
     g_autoptr(MMSignal) lte = NULL;
     g_autoptr(MMSignal) nr5g = NULL;
+    Private            *priv;
+
+    priv = get_private (self);
 
     if (!MM_IFACE_MODEM_SIGNAL_GET_INTERFACE (self)->load_values_finish (
             self,
@@ -242,15 +491,33 @@ load_values_ready (MMIfaceModemSignal *self,
             &nr5g,
             &error)) {
         mm_obj_warn (self, "couldn't reload extended signal information: %s", error->message);
+        priv->polling_running = FALSE;
         return;
     }
 
     mm_iface_modem_signal_update (self, cdma, evdo, gsm, umts, lte, nr5g);
+    priv->polling_running = FALSE;
 }
 
 static gboolean
 polling_context_cb (MMIfaceModemSignal *self)
 {
+    Private *priv;
+
+    priv = get_private (self);
+
+    /* Don't overlap polling operations */
+    if (priv->polling_running)
+        return G_SOURCE_CONTINUE;
+
+    /* No need to wake up the modem if values were already refreshed
+     * during the last polling period */
+    if (priv->indication_timer && g_timer_elapsed (priv->indication_timer, NULL) < priv->rate) {
+        mm_obj_dbg (self, "extended signal information polling skipped: recent values already reported");
+        return G_SOURCE_CONTINUE;
+    }
+
+    priv->polling_running = TRUE;
     MM_IFACE_MODEM_SIGNAL_GET_INTERFACE (self)->load_values (
         self,
         NULL,
@@ -287,7 +554,9 @@ polling_restart (MMIfaceModemSignal *self)
         g_source_remove (priv->timeout_source);
     priv->timeout_source = g_timeout_add_seconds (priv->rate, (GSourceFunc) polling_context_cb, self);
 
-    /* Also launch right away */
+    /* Also launch right away; values reported before this setup may not
+     * have been exposed, so don't rely on them */
+    g_clear_pointer (&priv->indication_timer, g_timer_destroy);
     polling_context_cb (self);
 }
 
@@ -545,6 +814,262 @@ handle_setup_thresholds (MmGdbusModemSignal    *skeleton,
     return TRUE;
 }
 
+/*****************************************************************************/
+/* History setup management */
+
+static void
+history_cell_info_ready (MMIfaceModem *self,
+                         GAsyncResult *res)
+{
+    g_autoptr(GError)   error = NULL;
+    g_autoptr(GVariant) cell_info = NULL;
+    Private            *priv;
+
+    priv = get_private (MM_IFACE_MODEM_SIGNAL (self));
+    priv->history_cell_info_running = FALSE;
+
+    /* The cell info history is updated from the modem interface */
+    cell_info = mm_iface_modem_load_cell_info_finish (self, res, &error);
+    if (!cell_info)
+        mm_obj_dbg (self, "couldn't load cell info for the history: %s", error->message);
+}
+
+static gboolean
+history_context_cb (MMIfaceModemSignal *self)
+{
+    Private *priv;
+
+    priv = get_private (self);
+
+    /* Values are explicitly loaded unless already reported by our own
+     * polling or by indications during the last period */
+    if (!priv->polling_running &&
+        !(priv->rate && priv->rate <= priv->history_resolution) &&
+        !(priv->indication_timer && g_timer_elapsed (priv->indication_timer, NULL) < priv->history_resolution)) {
+        priv->polling_running = TRUE;
+        MM_IFACE_MODEM_SIGNAL_GET_INTERFACE (self)->load_values (
+            self,
+            NULL,
+            (GAsyncReadyCallback)load_values_ready,
+            NULL);
+    }
+
+    /* Same for cell info, which may also have been loaded by user requests
+     * or reported by indications; loads are shared with user requests */
+    if (!priv->history_cell_info_running &&
+        MM_IFACE_MODEM_GET_INTERFACE (self)->get_cell_info &&
+        MM_IFACE_MODEM_GET_INTERFACE (self)->get_cell_info_finish &&
+        !mm_iface_modem_has_recent_cell_info (MM_IFACE_MODEM (self), priv->history_resolution)) {
+        priv->history_cell_info_running = TRUE;
+        mm_iface_modem_load_cell_info (MM_IFACE_MODEM (self),
+                                       (GAsyncReadyCallback)history_cell_info_ready,
+                                       NULL);
+    }
+
+    return G_SOURCE_CONTINUE;
+}
+
+static void
+history_restart (MMIfaceModemSignal *self)
+{
+    Private  *priv;
+    gboolean  history_setup;
+
+    priv = get_private (self);
+    history_setup = (priv->enabled && priv->history_resolution);
+
+    if (priv->history_timeout_source) {
+        g_source_remove (priv->history_timeout_source);
+        priv->history_timeout_source = 0;
+    }
+
+    if (!history_setup) {
+        mm_obj_dbg (self, "cleaning up extended signal information history");
+        return;
+    }
+
+    mm_obj_info (self, "setting up extended signal information history: resolution %u seconds, size %u samples",
+                 priv->history_resolution, priv->history_size);
+    priv->history_timeout_source = g_timeout_add_seconds (priv->history_resolution, (GSourceFunc) history_context_cb, self);
+    history_context_cb (self);
+}
+
+/*****************************************************************************/
+
+typedef struct {
+    GDBusMethodInvocation *invocation;
+    MmGdbusModemSignal    *skeleton;
+    guint                  resolution;
+    guint                  size;
+} HandleSetupHistoryContext;
+
+static void
+handle_setup_history_context_free (HandleSetupHistoryContext *ctx)
+{
+    g_object_unref (ctx->invocation);
+    g_object_unref (ctx->skeleton);
+    g_slice_free (HandleSetupHistoryContext, ctx);
+}
+
+static void
+handle_setup_history_auth_ready (MMBaseModem               *_self,
+                                 GAsyncResult              *res,
+                                 HandleSetupHistoryContext *ctx)
+{
+    MMIfaceModemSignal *self = MM_IFACE_MODEM_SIGNAL (_self);
+    GError             *error = NULL;
+    Private            *priv;
+
+    if (!mm_base_modem_authorize_finish (_self, res, &error)) {
+        g_dbus_method_invocation_take_error (ctx->invocation, error);
+        handle_setup_history_context_free (ctx);
+        return;
+    }
+
+    if (mm_iface_modem_abort_invocation_if_state_not_reached (MM_IFACE_MODEM (self),
+                                                              ctx->invocation,
+                                                              MM_MODEM_STATE_DISABLED)) {
+        handle_setup_history_context_free (ctx);
+        return;
+    }
+
+    if (ctx->size > HISTORY_SIZE_MAX) {
+        g_dbus_method_invocation_return_error (ctx->invocation, MM_CORE_ERROR, MM_CORE_ERROR_INVALID_ARGS,
+                                               "Cannot setup history: size %u exceeds the maximum (%u)",
+                                               ctx->size, HISTORY_SIZE_MAX);
+        handle_setup_history_context_free (ctx);
+        return;
+    }
+
+    priv = get_private (self);
+    if (!ctx->resolution)
+        history_clear (priv);
+    else
+        history_resize (priv, ctx->size ? ctx->size : HISTORY_SIZE_DEFAULT);
+    priv->history_resolution = ctx->resolution;
+    history_restart (self);
+
+    mm_gdbus_modem_signal_set_history_resolution (ctx->skeleton, priv->history_resolution);
+    mm_gdbus_modem_signal_set_history_size (ctx->skeleton, priv->history_size);
+    mm_gdbus_modem_signal_complete_setup_history (ctx->skeleton, ctx->invocation);
+    handle_setup_history_context_free (ctx);
+}
+
+static gboolean
+handle_setup_history (MmGdbusModemSignal    *skeleton,
+                      GDBusMethodInvocation *invocation,
+                      guint                  resolution,
+                      guint                  size,
+                      MMIfaceModemSignal    *self)
+{
+    HandleSetupHistoryContext *ctx;
+
+    ctx = g_slice_new0 (HandleSetupHistoryContext);
+    ctx->invocation = g_object_ref (invocation);
+    ctx->skeleton = g_object_ref (skeleton);
+    ctx->resolution = resolution;
+    ctx->size = size;
+
+    mm_base_modem_authorize (MM_BASE_MODEM (self),
+                             invocation,
+                             MM_AUTHORIZATION_DEVICE_CONTROL,
+                             (GAsyncReadyCallback)handle_setup_history_auth_ready,
+                             ctx);
+    return TRUE;
+}
+
+/*****************************************************************************/
+
+typedef struct {
+    GDBusMethodInvocation *invocation;
+    MmGdbusModemSignal    *skeleton;
+    gint64                 since;
+} HandleGetHistoryContext;
+
+static void
+handle_get_history_context_free (HandleGetHistoryContext *ctx)
+{
+    g_object_unref (ctx->invocation);
+    g_object_unref (ctx->skeleton);
+    g_slice_free (HandleGetHistoryContext, ctx);
+}
+
+static void
+handle_get_history_auth_ready (MMBaseModem             *_self,
+                               GAsyncResult            *res,
+                               HandleGetHistoryContext *ctx)
+{
+    MMIfaceModemSignal *self = MM_IFACE_MODEM_SIGNAL (_self);
+    GError             *error = NULL;
+    Private            *priv;
+    GVariantBuilder     signal_builder;
+    GVariantBuilder     cell_info_builder;
+    guint               i;
+
+    if (!mm_base_modem_authorize_finish (_self, res, &error)) {
+        g_dbus_method_invocation_take_error (ctx->invocation, error);
+        handle_get_history_context_free (ctx);
+        return;
+    }
+
+    priv = get_private (self);
+
+    g_variant_builder_init (&signal_builder, G_VARIANT_TYPE ("a(xudddd)"));
+    for (i = 0; i < priv->history_signal_n; i++) {
+        HistorySignalSample *sample;
+
+        sample = &priv->history_signal[history_index (priv->history_signal_first, i, priv->history_size)];
+        if (sample->timestamp <= ctx->since)
+            continue;
+        g_variant_builder_add (&signal_builder, "(xudddd)",
+                               sample->timestamp,
+                               (guint32) sample->access_technology,
+                               sample->rssi,
+                               sample->rsrp,
+                               sample->rsrq,
+                               sample->sinr);
+    }
+
+    g_variant_builder_init (&cell_info_builder, G_VARIANT_TYPE ("a(xaa{sv})"));
+    for (i = 0; i < priv->history_cell_info_n; i++) {
+        HistoryCellInfoSample *sample;
+
+        sample = &priv->history_cell_info[history_index (priv->history_cell_info_first, i, priv->history_size)];
+        if (sample->timestamp <= ctx->since)
+            continue;
+        g_variant_builder_add (&cell_info_builder, "(x@aa{sv})",
+                               sample->timestamp,
+                               sample->cell_info);
+    }
+
+    mm_gdbus_modem_signal_complete_get_history (ctx->skeleton,
+                                                ctx->invocation,
+                                                g_variant_builder_end (&signal_builder),
+                                                g_variant_builder_end (&cell_info_builder));
+    handle_get_history_context_free (ctx);
+}
+
+static gboolean
+handle_get_history (MmGdbusModemSignal    *skeleton,
+                    GDBusMethodInvocation *invocation,
+                    gint64                 since,
+                    MMIfaceModemSignal    *self)
+{
+    HandleGetHistoryContext *ctx;
+
+    ctx = g_slice_new0 (HandleGetHistoryContext);
+    ctx->invocation = g_object_ref (invocation);
+    ctx->skeleton = g_object_ref (skeleton);
+    ctx->since = since;
+
+    mm_base_modem_authorize (MM_BASE_MODEM (self),
+                             invocation,
+                             MM_AUTHORIZATION_DEVICE_CONTROL,
+                             (GAsyncReadyCallback)handle_get_history_auth_ready,
+                             ctx);
+    return TRUE;
+}
+
 /*****************************************************************************/
 /* Common enable/disable */
 
@@ -588,6 +1113,7 @@ common_enable_disable (MMIfaceModemSignal  *self,
     check_interface_reset (self);
 
     polling_restart (self);
+    history_restart (self);
 
     thresholds_restart (self,
                         (GAsyncReadyCallback)enable_disable_thresholds_restart_ready,
@@ -770,6 +1296,14 @@ interface_initialization_step (GTask *task)
                           "handle-setup-thresholds",
                           G_CALLBACK (handle_setup_thresholds),
                           self);
+        g_signal_connect (ctx->skeleton,
+                          "handle-setup-history",
+                          G_CALLBACK (handle_setup_history),
+                          self);
+        g_signal_connect (ctx->skeleton,
+                          "handle-get-history",
+                          G_CALLBACK (handle_get_history),
+                          self);
         /* Finally, export the new interface */
         mm_gdbus_object_skeleton_set_modem_signal (MM_GDBUS_OBJECT_SKELETON (self),
                                                    MM_GDBUS_MODEM_SIGNAL (ctx->skeleton));
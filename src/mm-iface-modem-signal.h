@@ -115,4 +115,8 @@ void mm_iface_modem_signal_update (MMIfaceModemSignal *self,
                                    MMSignal           *lte,
                                    MMSignal           *nr5g);
 
+/* Store cell info updates in the history, if enabled */
+void mm_iface_modem_signal_update_cell_info_history (MMIfaceModemSignal *self,
+                                                     GVariant           *cell_info);
+
 #endif /* MM_IFACE_MODEM_SIGNAL_H */
@@ -55,19 +55,47 @@ handle_get_network_time_context_free (HandleGetNetworkTimeContext *ctx)
 }
 
 static void
-load_network_time_ready (MMIfaceModemTime            *self,
-                         GAsyncResult                *res,
-                         HandleGetNetworkTimeContext *ctx)
+load_network_time_ready (MMIfaceModemTime *self,
+                         GAsyncResult     *res,
+                         GTask            *task)
 {
-    gchar *time_str;
+    gchar  *time_str;
     GError *error = NULL;
 
     time_str = MM_IFACE_MODEM_TIME_GET_INTERFACE (self)->load_network_time_finish (self, res, &error);
     if (error)
-        g_dbus_method_invocation_take_error (ctx->invocation, error);
+        g_task_return_error (task, error);
     else
-        mm_gdbus_modem_time_complete_get_network_time (ctx->skeleton, ctx->invocation, time_str);
+        g_task_return_pointer (task,
+                               g_variant_ref_sink (g_variant_new_string (time_str ? time_str : "")),
+                               (GDestroyNotify) g_variant_unref);
+    g_object_unref (task);
     g_free (time_str);
+}
+
+static void
+load_network_time (MMBaseModem *self,
+                   GTask       *task)
+{
+    MM_IFACE_MODEM_TIME_GET_INTERFACE (self)->load_network_time (
+        MM_IFACE_MODEM_TIME (self),
+        (GAsyncReadyCallback)load_network_time_ready,
+        task);
+}
+
+static void
+get_network_time_ready (MMBaseModem                 *self,
+                        GAsyncResult                *res,
+                        HandleGetNetworkTimeContext *ctx)
+{
+    g_autoptr(GVariant)  time_variant = NULL;
+    GError              *error = NULL;
+
+    time_variant = mm_base_modem_coalesce_finish (self, res, &error);
+    if (!time_variant)
+        g_dbus_method_invocation_take_error (ctx->invocation, error);
+    else
+        mm_gdbus_modem_time_complete_get_network_time (ctx->skeleton, ctx->invocation, g_variant_get_string (time_variant, NULL));
     handle_get_network_time_context_free (ctx);
 }
 
@@ -111,10 +139,11 @@ handle_get_network_time_auth_ready (MMBaseModem                 *self,
         return;
     }
 
-    MM_IFACE_MODEM_TIME_GET_INTERFACE (self)->load_network_time (
-        ctx->self,
-        (GAsyncReadyCallback)load_network_time_ready,
-        ctx);
+    mm_base_modem_coalesce (self,
+                            "get-network-time",
+                            load_network_time,
+                            (GAsyncReadyCallback)get_network_time_ready,
+                            ctx);
 }
 
 static gboolean
@@ -21,7 +21,9 @@
 #include "mm-modem-helpers.h"
 #include "mm-iface-modem.h"
 #include "mm-iface-modem-3gpp.h"
+#include "mm-iface-modem-3gpp-profile-manager.h"
 #include "mm-iface-modem-cdma.h"
+#include "mm-iface-modem-signal.h"
 #include "mm-base-modem.h"
 #include "mm-base-modem-at.h"
 #include "mm-base-sim.h"
@@ -44,6 +46,9 @@
 #define SIGNAL_CHECK_INITIAL_TIMEOUT_SEC  3
 #define SIGNAL_CHECK_TIMEOUT_SEC          30
 
+#define SIM_READY_CHECK_DELAY_MIN_MS      250
+#define SIM_READY_CHECK_DELAY_MAX_MS      2000
+
 /*****************************************************************************/
 /* Private data context */
 
@@ -71,11 +76,23 @@ typedef struct {
     gboolean signal_check_initial_done;
     gboolean signal_check_running;
 
+    /* Time since the last signal quality update not triggered by our own
+     * polling (e.g. unsolicited messages or modem-side threshold indications) */
+    GTimer *signal_quality_indication_timer;
+
     /* Initialization restart support */
     guint restart_initialize_idle_id;
 
     /* SIM hot swap setup done flag */
     gboolean sim_hot_swap_configured;
+
+    /* SIM readiness reported and tasks waiting for it */
+    gboolean  sim_ready_reported;
+    GList    *sim_ready_waiters;
+
+    /* Last cell info reported, and when it was (monotonic time) */
+    GVariant *cell_info;
+    gint64    cell_info_time;
 } Private;
 
 static void
@@ -87,8 +104,12 @@ private_free (Private *priv)
         g_source_remove (priv->signal_quality_recent_timeout_source);
     if (priv->signal_check_timeout_source)
         g_source_remove (priv->signal_check_timeout_source);
+    if (priv->signal_quality_indication_timer)
+        g_timer_destroy (priv->signal_quality_indication_timer);
     if (priv->restart_initialize_idle_id)
         g_source_remove (priv->restart_initialize_idle_id);
+    if (priv->cell_info)
+        g_variant_unref (priv->cell_info);
     g_slice_free (Private, priv);
 }
 
@@ -1008,6 +1029,10 @@ command_ready (MMIfaceModem         *self,
     GError      *error = NULL;
     const gchar *result;
 
+    /* The user command may have modified profiles behind our back */
+    if (MM_IS_IFACE_MODEM_3GPP_PROFILE_MANAGER (self))
+        mm_iface_modem_3gpp_profile_manager_invalidate_profile_list (MM_IFACE_MODEM_3GPP_PROFILE_MANAGER (self));
+
     result = MM_IFACE_MODEM_GET_INTERFACE (self)->command_finish (self, res, &error);
     if (error) {
         mm_obj_dbg (self, "failed running AT command '%s': %s", ctx->cmd, error->message);
@@ -1331,21 +1356,6 @@ handle_set_primary_sim_slot (MmGdbusModem          *skeleton,
 
 /*****************************************************************************/
 
-typedef struct {
-    MmGdbusModem          *skeleton;
-    GDBusMethodInvocation *invocation;
-    MMIfaceModem          *self;
-} HandleGetCellInfoContext;
-
-static void
-handle_get_cell_info_context_free (HandleGetCellInfoContext *ctx)
-{
-    g_object_unref (ctx->skeleton);
-    g_object_unref (ctx->invocation);
-    g_object_unref (ctx->self);
-    g_slice_free (HandleGetCellInfoContext, ctx);
-}
-
 static GVariant *
 get_cell_info_build_result (GList *info_list)
 {
@@ -1365,9 +1375,85 @@ get_cell_info_build_result (GList *info_list)
 }
 
 static void
-get_cell_info_ready (MMIfaceModem             *self,
-                     GAsyncResult             *res,
-                     HandleGetCellInfoContext *ctx)
+cell_info_update (MMIfaceModem *self,
+                  GVariant     *cell_info)
+{
+    g_autoptr(MmGdbusModemSkeleton)  skeleton = NULL;
+    Private                         *priv;
+
+    priv = get_private (self);
+    priv->cell_info_time = g_get_monotonic_time ();
+
+    if (MM_IS_IFACE_MODEM_SIGNAL (self))
+        mm_iface_modem_signal_update_cell_info_history (MM_IFACE_MODEM_SIGNAL (self), cell_info);
+
+    if (priv->cell_info && g_variant_equal (priv->cell_info, cell_info))
+        return;
+
+    g_clear_pointer (&priv->cell_info, g_variant_unref);
+    priv->cell_info = g_variant_ref (cell_info);
+
+    g_object_get (self,
+                  MM_IFACE_MODEM_DBUS_SKELETON, &skeleton,
+                  NULL);
+    if (skeleton)
+        mm_gdbus_modem_emit_cell_info_updated (MM_GDBUS_MODEM (skeleton), cell_info);
+}
+
+static void
+cell_info_clear (MMIfaceModem *self)
+{
+    Private *priv;
+
+    priv = get_private (self);
+    g_clear_pointer (&priv->cell_info, g_variant_unref);
+    priv->cell_info_time = 0;
+}
+
+void
+mm_iface_modem_update_cell_info (MMIfaceModem *self,
+                                 GList        *info_list)
+{
+    g_autoptr(GVariant) cell_info = NULL;
+
+    cell_info = get_cell_info_build_result (info_list);
+    cell_info_update (self, cell_info);
+}
+
+/*****************************************************************************/
+
+typedef struct {
+    MmGdbusModem          *skeleton;
+    GDBusMethodInvocation *invocation;
+    MMIfaceModem          *self;
+    /* Whether it's a GetRecentCellInfo() request, and its max age (secs) */
+    gboolean               recent;
+    guint                  max_age;
+} HandleGetCellInfoContext;
+
+static void
+handle_get_cell_info_context_free (HandleGetCellInfoContext *ctx)
+{
+    g_object_unref (ctx->skeleton);
+    g_object_unref (ctx->invocation);
+    g_object_unref (ctx->self);
+    g_slice_free (HandleGetCellInfoContext, ctx);
+}
+
+static void
+handle_get_cell_info_complete (HandleGetCellInfoContext *ctx,
+                               GVariant                 *cell_info)
+{
+    if (ctx->recent)
+        mm_gdbus_modem_complete_get_recent_cell_info (ctx->skeleton, ctx->invocation, cell_info);
+    else
+        mm_gdbus_modem_complete_get_cell_info (ctx->skeleton, ctx->invocation, cell_info);
+}
+
+static void
+load_cell_info_ready (MMIfaceModem *self,
+                      GAsyncResult *res,
+                      GTask        *task)
 {
     GError *error = NULL;
     GList  *info_list;
@@ -1375,16 +1461,73 @@ get_cell_info_ready (MMIfaceModem             *self,
     info_list = MM_IFACE_MODEM_GET_INTERFACE (self)->get_cell_info_finish (self, res, &error);
     if (error) {
         mm_obj_dbg (self, "failed retrieving cell info: %s", error->message);
-        g_dbus_method_invocation_take_error (ctx->invocation, error);
+        g_task_return_error (task, error);
     } else {
-        g_autoptr(GVariant) dict_array = NULL;
+        GVariant *dict_array;
 
         mm_obj_dbg (self, "cell info retrieved");
         dict_array = get_cell_info_build_result (info_list);
-        mm_gdbus_modem_complete_get_cell_info (ctx->skeleton, ctx->invocation, dict_array);
+        cell_info_update (self, dict_array);
+        g_task_return_pointer (task, dict_array, (GDestroyNotify) g_variant_unref);
     }
+    g_object_unref (task);
 
     g_list_free_full (info_list, (GDestroyNotify)g_object_unref);
+}
+
+static void
+load_cell_info (MMBaseModem *self,
+                GTask       *task)
+{
+    MM_IFACE_MODEM_GET_INTERFACE (self)->get_cell_info (MM_IFACE_MODEM (self),
+                                                        (GAsyncReadyCallback)load_cell_info_ready,
+                                                        task);
+}
+
+gboolean
+mm_iface_modem_has_recent_cell_info (MMIfaceModem *self,
+                                     guint         max_age)
+{
+    Private *priv;
+
+    priv = get_private (self);
+    return (priv->cell_info &&
+            (g_get_monotonic_time () - priv->cell_info_time) < ((gint64) max_age * G_USEC_PER_SEC));
+}
+
+GVariant *
+mm_iface_modem_load_cell_info_finish (MMIfaceModem  *self,
+                                      GAsyncResult  *res,
+                                      GError       **error)
+{
+    return mm_base_modem_coalesce_finish (MM_BASE_MODEM (self), res, error);
+}
+
+void
+mm_iface_modem_load_cell_info (MMIfaceModem        *self,
+                               GAsyncReadyCallback  callback,
+                               gpointer             user_data)
+{
+    mm_base_modem_coalesce (MM_BASE_MODEM (self),
+                            "get-cell-info",
+                            load_cell_info,
+                            callback,
+                            user_data);
+}
+
+static void
+get_cell_info_ready (MMBaseModem              *self,
+                     GAsyncResult             *res,
+                     HandleGetCellInfoContext *ctx)
+{
+    GError              *error = NULL;
+    g_autoptr(GVariant)  dict_array = NULL;
+
+    dict_array = mm_base_modem_coalesce_finish (self, res, &error);
+    if (!dict_array)
+        g_dbus_method_invocation_take_error (ctx->invocation, error);
+    else
+        handle_get_cell_info_complete (ctx, dict_array);
     handle_get_cell_info_context_free (ctx);
 }
 
@@ -1393,7 +1536,8 @@ handle_get_cell_info_auth_ready (MMBaseModem              *self,
                                  GAsyncResult             *res,
                                  HandleGetCellInfoContext *ctx)
 {
-    GError *error = NULL;
+    GError  *error = NULL;
+    Private *priv;
 
     if (!mm_base_modem_authorize_finish (self, res, &error)) {
         g_dbus_method_invocation_take_error (ctx->invocation, error);
@@ -1415,16 +1559,28 @@ handle_get_cell_info_auth_ready (MMBaseModem              *self,
         return;
     }
 
+    /* Reply with the last cell info known if recent enough */
+    priv = get_private (ctx->self);
+    if (ctx->recent && ctx->max_age > 0 && mm_iface_modem_has_recent_cell_info (ctx->self, ctx->max_age)) {
+        mm_obj_dbg (self, "reusing cell info retrieved %" G_GINT64_FORMAT "ms ago",
+                    (g_get_monotonic_time () - priv->cell_info_time) / 1000);
+        handle_get_cell_info_complete (ctx, priv->cell_info);
+        handle_get_cell_info_context_free (ctx);
+        return;
+    }
+
     mm_obj_info (self, "processing user request to retrieve cell info...");
-    MM_IFACE_MODEM_GET_INTERFACE (self)->get_cell_info (ctx->self,
-                                                        (GAsyncReadyCallback)get_cell_info_ready,
-                                                        ctx);
+    mm_iface_modem_load_cell_info (ctx->self,
+                                   (GAsyncReadyCallback)get_cell_info_ready,
+                                   ctx);
 }
 
-static gboolean
-handle_get_cell_info (MmGdbusModem          *skeleton,
-                      GDBusMethodInvocation *invocation,
-                      MMIfaceModem          *self)
+static void
+handle_get_cell_info_common (MmGdbusModem          *skeleton,
+                             GDBusMethodInvocation *invocation,
+                             MMIfaceModem          *self,
+                             gboolean               recent,
+                             guint                  max_age)
 {
     HandleGetCellInfoContext *ctx;
 
@@ -1432,12 +1588,32 @@ handle_get_cell_info (MmGdbusModem          *skeleton,
     ctx->skeleton = g_object_ref (skeleton);
     ctx->invocation = g_object_ref (invocation);
     ctx->self = g_object_ref (self);
+    ctx->recent = recent;
+    ctx->max_age = max_age;
 
     mm_base_modem_authorize (MM_BASE_MODEM (self),
                              invocation,
                              MM_AUTHORIZATION_DEVICE_CONTROL,
                              (GAsyncReadyCallback)handle_get_cell_info_auth_ready,
                              ctx);
+}
+
+static gboolean
+handle_get_cell_info (MmGdbusModem          *skeleton,
+                      GDBusMethodInvocation *invocation,
+                      MMIfaceModem          *self)
+{
+    handle_get_cell_info_common (skeleton, invocation, self, FALSE, 0);
+    return TRUE;
+}
+
+static gboolean
+handle_get_recent_cell_info (MmGdbusModem          *skeleton,
+                             GDBusMethodInvocation *invocation,
+                             guint                  max_age,
+                             MMIfaceModem          *self)
+{
+    handle_get_cell_info_common (skeleton, invocation, self, TRUE, max_age);
     return TRUE;
 }
 
@@ -1603,9 +1779,32 @@ void
 mm_iface_modem_update_signal_quality (MMIfaceModem *self,
                                       guint         signal_quality)
 {
+    Private *priv;
+
+    priv = get_private (self);
+
+    /* Updates received while our own check isn't running come from
+     * indications, and allow skipping the next polling iteration */
+    if (!priv->signal_check_running) {
+        if (G_UNLIKELY (!priv->signal_quality_indication_timer))
+            priv->signal_quality_indication_timer = g_timer_new ();
+        else
+            g_timer_start (priv->signal_quality_indication_timer);
+    }
+
     update_signal_quality (self, signal_quality, TRUE);
 }
 
+static gboolean
+signal_quality_indication_recent (MMIfaceModem *self)
+{
+    Private *priv;
+
+    priv = get_private (self);
+    return (priv->signal_quality_indication_timer &&
+            g_timer_elapsed (priv->signal_quality_indication_timer, NULL) < SIGNAL_CHECK_TIMEOUT_SEC);
+}
+
 /*****************************************************************************/
 /* Signal info (quality and access technology) polling */
 
@@ -1621,6 +1820,8 @@ typedef struct {
     guint                   signal_quality;
     MMModemAccessTechnology access_technologies;
     guint                   access_technologies_mask;
+    /* Whether signal quality was recently reported via indications */
+    gboolean                signal_quality_indication;
     /* Steps triggered when polling active */
     SignalCheckStep running_step;
 } SignalCheckContext;
@@ -1715,8 +1916,13 @@ periodic_signal_check_step (GTask *task)
         /* fall-through */
 
     case SIGNAL_CHECK_STEP_SIGNAL_QUALITY:
-        if (priv->signal_check_enabled && priv->signal_quality_polling_supported &&
-            (!priv->signal_check_initial_done || !priv->signal_quality_polling_disabled)) {
+        /* No need to wake up the modem if we have a fresh enough value
+         * already reported via indications */
+        if (signal_quality_indication_recent (self)) {
+            mm_obj_dbg (self, "signal quality polling skipped: recent value reported via indications");
+            ctx->signal_quality_indication = TRUE;
+        } else if (priv->signal_check_enabled && priv->signal_quality_polling_supported &&
+                   (!priv->signal_check_initial_done || !priv->signal_quality_polling_disabled)) {
             MM_IFACE_MODEM_GET_INTERFACE (self)->load_signal_quality (
                 self, (GAsyncReadyCallback)load_signal_quality_ready, task);
             return;
@@ -1737,6 +1943,8 @@ periodic_signal_check_step (GTask *task)
     case SIGNAL_CHECK_STEP_LAST:
         /* If we have been disabled while we were running the steps, we don't
          * do anything else. */
+        priv->signal_check_running = FALSE;
+
         if (!priv->signal_check_enabled) {
             mm_obj_dbg (self, "periodic signal quality and access technology checks not rescheduled: disabled");
             g_task_return_boolean (task, FALSE);
@@ -1753,9 +1961,11 @@ periodic_signal_check_step (GTask *task)
             gboolean signal_quality_ready;
             gboolean access_technology_ready;
 
-            /* Signal quality is ready if unsupported or if we got a valid
-             * value reported */
-            signal_quality_ready = (!priv->signal_quality_polling_supported || (ctx->signal_quality != 0));
+            /* Signal quality is ready if unsupported, if we got a valid
+             * value reported, or if it's being reported via indications */
+            signal_quality_ready = (!priv->signal_quality_polling_supported ||
+                                    ctx->signal_quality_indication ||
+                                    (ctx->signal_quality != 0));
 
             /* Access technology is ready if unsupported or if we got a valid
              * value reported */
@@ -1799,6 +2009,8 @@ periodic_signal_check_run (MMIfaceModem *self)
 
     priv = get_private (self);
 
+    priv->signal_check_running = TRUE;
+
     task = g_task_new (self, NULL, NULL, NULL);
 
     ctx = g_new0 (SignalCheckContext, 1);
@@ -1836,7 +2048,6 @@ mm_iface_modem_refresh_signal (MMIfaceModem *self)
     }
 
     mm_obj_dbg (self, "periodic signal check refresh requested");
-    priv->signal_check_running = TRUE;
 
     /* Remove the scheduled timeout as we're going to refresh
      * right away */
@@ -1879,6 +2090,9 @@ periodic_signal_check_disable (MMIfaceModem *self,
         priv->signal_check_timeout_source = 0;
     }
 
+    /* Forget about previous indications */
+    g_clear_pointer (&priv->signal_quality_indication_timer, g_timer_destroy);
+
     priv->signal_check_enabled = FALSE;
     mm_obj_dbg (self, "periodic signal checks disabled");
 }
@@ -1890,6 +2104,14 @@ periodic_signal_check_enable (MMIfaceModem *self)
 
     priv = get_private (self);
 
+    /* Plugins may disable polling once they know unsolicited indications are
+     * enabled, which happens after the private context was created, so reload
+     * the setup every time checks are enabled */
+    g_object_get (self,
+                  MM_IFACE_MODEM_PERIODIC_SIGNAL_CHECK_DISABLED,      &priv->signal_quality_polling_disabled,
+                  MM_IFACE_MODEM_PERIODIC_ACCESS_TECH_CHECK_DISABLED, &priv->access_technology_polling_disabled,
+                  NULL);
+
     /* If polling access technology and signal quality not supported, don't even
      * bother trying. */
     if (!priv->signal_quality_polling_supported && !priv->access_technology_polling_supported) {
@@ -1990,6 +2212,10 @@ update_state_internal (MMIfaceModem             *self,
          * cleanup signal quality retrieval */
         else if (old_state >= MM_MODEM_STATE_REGISTERED && new_state < MM_MODEM_STATE_REGISTERED)
             periodic_signal_check_disable (self, TRUE);
+
+        /* Cell info known while enabled is no longer valid */
+        if (new_state < MM_MODEM_STATE_ENABLED)
+            cell_info_clear (self);
     }
 }
 
@@ -3652,6 +3878,179 @@ update_unlock_retries (MMIfaceModem *self,
     g_object_unref (skeleton);
 }
 
+/*****************************************************************************/
+/* Wait for the SIM to become ready */
+
+typedef struct {
+    MMIfaceModemSimReadyCheckFn       check;
+    MMIfaceModemSimReadyCheckFinishFn check_finish;
+    guint                             check_delay_ms;
+    guint                             check_id;
+    guint                             timeout_id;
+    gboolean                          completed;
+} WaitSimReadyContext;
+
+static void
+wait_sim_ready_context_free (WaitSimReadyContext *ctx)
+{
+    g_assert (!ctx->check_id);
+    g_assert (!ctx->timeout_id);
+    g_slice_free (WaitSimReadyContext, ctx);
+}
+
+gboolean
+mm_iface_modem_wait_sim_ready_finish (MMIfaceModem  *self,
+                                      GAsyncResult  *res,
+                                      GError       **error)
+{
+    return g_task_propagate_boolean (G_TASK (res), error);
+}
+
+static void
+wait_sim_ready_complete (GTask       *task,
+                         const gchar *reason)
+{
+    MMIfaceModem        *self;
+    WaitSimReadyContext *ctx;
+    Private             *priv;
+
+    self = g_task_get_source_object (task);
+    ctx = g_task_get_task_data (task);
+    priv = get_private (self);
+
+    g_assert (!ctx->completed);
+    ctx->completed = TRUE;
+
+    if (ctx->check_id) {
+        g_source_remove (ctx->check_id);
+        ctx->check_id = 0;
+    }
+    if (ctx->timeout_id) {
+        g_source_remove (ctx->timeout_id);
+        ctx->timeout_id = 0;
+    }
+
+    mm_obj_dbg (self, "finished waiting for the SIM to get ready: %s", reason);
+
+    /* The list of waiters holds the task reference */
+    priv->sim_ready_waiters = g_list_remove (priv->sim_ready_waiters, task);
+    g_task_return_boolean (task, TRUE);
+    g_object_unref (task);
+}
+
+static gboolean
+wait_sim_ready_timeout_cb (GTask *task)
+{
+    WaitSimReadyContext *ctx;
+
+    ctx = g_task_get_task_data (task);
+    ctx->timeout_id = 0;
+    wait_sim_ready_complete (task, "maximum wait time elapsed");
+    return G_SOURCE_REMOVE;
+}
+
+static gboolean wait_sim_ready_check_cb (GTask *task);
+
+static void
+wait_sim_ready_check_ready (MMIfaceModem *self,
+                            GAsyncResult *res,
+                            GTask        *task)
+{
+    WaitSimReadyContext *ctx;
+    g_autoptr(GError)    error = NULL;
+    gboolean             ready;
+
+    ctx = g_task_get_task_data (task);
+    ready = ctx->check_finish (self, res, &error);
+
+    if (!ctx->completed) {
+        if (ready)
+            wait_sim_ready_complete (task, "SIM check succeeded");
+        else {
+            if (error)
+                mm_obj_dbg (self, "couldn't check whether the SIM is ready: %s", error->message);
+            /* Back off exponentially, up to a maximum delay between checks */
+            ctx->check_id = g_timeout_add (ctx->check_delay_ms, (GSourceFunc)wait_sim_ready_check_cb, task);
+            ctx->check_delay_ms = MIN (ctx->check_delay_ms * 2, SIM_READY_CHECK_DELAY_MAX_MS);
+        }
+    }
+
+    /* Reference taken when the check was launched */
+    g_object_unref (task);
+}
+
+static gboolean
+wait_sim_ready_check_cb (GTask *task)
+{
+    MMIfaceModem        *self;
+    WaitSimReadyContext *ctx;
+
+    self = g_task_get_source_object (task);
+    ctx = g_task_get_task_data (task);
+    ctx->check_id = 0;
+
+    ctx->check (self,
+                (GAsyncReadyCallback)wait_sim_ready_check_ready,
+                g_object_ref (task));
+    return G_SOURCE_REMOVE;
+}
+
+void
+mm_iface_modem_wait_sim_ready (MMIfaceModem                      *self,
+                               guint                              max_wait_secs,
+                               MMIfaceModemSimReadyCheckFn        check,
+                               MMIfaceModemSimReadyCheckFinishFn  check_finish,
+                               GAsyncReadyCallback                callback,
+                               gpointer                           user_data)
+{
+    WaitSimReadyContext *ctx;
+    Private             *priv;
+    GTask               *task;
+
+    priv = get_private (self);
+    task = g_task_new (self, NULL, callback, user_data);
+
+    if (priv->sim_ready_reported) {
+        mm_obj_dbg (self, "SIM already reported ready");
+        g_task_return_boolean (task, TRUE);
+        g_object_unref (task);
+        return;
+    }
+
+    ctx = g_slice_new0 (WaitSimReadyContext);
+    ctx->check = check;
+    ctx->check_finish = check_finish;
+    ctx->check_delay_ms = SIM_READY_CHECK_DELAY_MIN_MS;
+    g_task_set_task_data (task, ctx, (GDestroyNotify)wait_sim_ready_context_free);
+
+    mm_obj_dbg (self, "waiting up to %u seconds for the SIM to get ready...", max_wait_secs);
+    priv->sim_ready_waiters = g_list_append (priv->sim_ready_waiters, task);
+    ctx->timeout_id = g_timeout_add_seconds (max_wait_secs, (GSourceFunc)wait_sim_ready_timeout_cb, task);
+
+    if (ctx->check && ctx->check_finish)
+        wait_sim_ready_check_cb (task);
+}
+
+void
+mm_iface_modem_report_sim_ready (MMIfaceModem *self,
+                                 gboolean      ready)
+{
+    Private *priv;
+
+    priv = get_private (self);
+    if (priv->sim_ready_reported != ready)
+        mm_obj_dbg (self, "SIM reported %s", ready ? "ready" : "not ready");
+    priv->sim_ready_reported = ready;
+
+    if (!ready)
+        return;
+
+    while (priv->sim_ready_waiters)
+        wait_sim_ready_complete (G_TASK (priv->sim_ready_waiters->data), "SIM reported ready");
+}
+
+/*****************************************************************************/
+
 typedef enum {
     UPDATE_LOCK_INFO_CONTEXT_STEP_FIRST = 0,
     UPDATE_LOCK_INFO_CONTEXT_STEP_LOCK,
@@ -3853,7 +4252,10 @@ update_lock_info_context_step (GTask *task)
 
             /* If no way to run after SIM unlock step, we're done */
             mm_obj_info (self, "SIM is ready, and no need for the after SIM unlock step...");
-        }
+        } else if (ctx->lock != MM_MODEM_LOCK_UNKNOWN && ctx->lock != MM_MODEM_LOCK_NONE)
+            /* A SIM still locked is not ready, regardless of what was
+             * reported earlier */
+            mm_iface_modem_report_sim_ready (self, FALSE);
         ctx->step++;
         /* fall-through */
 
@@ -4494,12 +4896,14 @@ mm_iface_modem_enable (MMIfaceModem *self,
 typedef struct _SyncingContext SyncingContext;
 static void interface_syncing_step (GTask *task);
 
+/* Only the SIM related checks are run as part of the interface sync; the
+ * bearer and signal refreshes are independent, and the caller runs them
+ * concurrently with the sync of other interfaces once the SIM is known to
+ * be unchanged and unlocked. */
 typedef enum {
     SYNCING_STEP_FIRST,
     SYNCING_STEP_DETECT_SIM_SWAP,
     SYNCING_STEP_REFRESH_SIM_LOCK,
-    SYNCING_STEP_REFRESH_SIGNAL_STRENGTH,
-    SYNCING_STEP_REFRESH_BEARERS,
     SYNCING_STEP_LAST
 } SyncingStep;
 
@@ -4515,53 +4919,6 @@ mm_iface_modem_sync_finish (MMIfaceModem  *self,
     return g_task_propagate_boolean (G_TASK (res), error);
 }
 
-static void
-sync_all_bearers_ready (MMBearerList *bearer_list,
-                        GAsyncResult *res,
-                        GTask        *task)
-{
-    MMIfaceModem       *self;
-    SyncingContext     *ctx;
-    g_autoptr (GError)  error = NULL;
-
-    self = g_task_get_source_object (task);
-    ctx  = g_task_get_task_data (task);
-
-    if (!mm_bearer_list_sync_all_bearers_finish (bearer_list, res, &error))
-        mm_obj_warn (self, "synchronizing all bearer status failed: %s", error->message);
-
-    /* Go on to next step */
-    ctx->step++;
-    interface_syncing_step (task);
-}
-
-static void
-reload_bearers (GTask *task)
-{
-    MMIfaceModem            *self;
-    SyncingContext          *ctx;
-    g_autoptr(MMBearerList)  bearer_list = NULL;
-
-    self = g_task_get_source_object (task);
-    ctx  = g_task_get_task_data (task);
-
-    g_object_get (self,
-                  MM_IFACE_MODEM_BEARER_LIST, &bearer_list,
-                  NULL);
-
-    /* If no bearer list (e.g. none created or modem disabled),
-     * go on to next step */
-    if (!bearer_list) {
-        ctx->step++;
-        interface_syncing_step (task);
-        return;
-    }
-
-    mm_bearer_list_sync_all_bearers (bearer_list,
-                                     (GAsyncReadyCallback)sync_all_bearers_ready,
-                                     task);
-}
-
 static void
 sync_sim_lock_ready (MMIfaceModem *self,
                      GAsyncResult *res,
@@ -4637,21 +4994,6 @@ interface_syncing_step (GTask *task)
             task);
         return;
 
-    case SYNCING_STEP_REFRESH_SIGNAL_STRENGTH:
-        /*
-         * Restart the signal strength and access technologies refresh sequence.
-         */
-        mm_iface_modem_refresh_signal (self);
-        ctx->step++;
-        /* fall through */
-
-    case SYNCING_STEP_REFRESH_BEARERS:
-        /*
-         * Refresh bearers.
-         */
-        reload_bearers (task);
-        return;
-
     case SYNCING_STEP_LAST:
         /* We are done without errors! */
         g_task_return_boolean (task, TRUE);
@@ -4683,6 +5025,54 @@ mm_iface_modem_sync (MMIfaceModem        *self,
     interface_syncing_step (task);
 }
 
+gboolean
+mm_iface_modem_sync_bearers_finish (MMIfaceModem  *self,
+                                    GAsyncResult  *res,
+                                    GError       **error)
+{
+    return g_task_propagate_boolean (G_TASK (res), error);
+}
+
+static void
+sync_all_bearers_ready (MMBearerList *bearer_list,
+                        GAsyncResult *res,
+                        GTask        *task)
+{
+    GError *error = NULL;
+
+    if (!mm_bearer_list_sync_all_bearers_finish (bearer_list, res, &error))
+        g_task_return_error (task, error);
+    else
+        g_task_return_boolean (task, TRUE);
+    g_object_unref (task);
+}
+
+void
+mm_iface_modem_sync_bearers (MMIfaceModem        *self,
+                             GAsyncReadyCallback  callback,
+                             gpointer             user_data)
+{
+    GTask                   *task;
+    g_autoptr(MMBearerList)  bearer_list = NULL;
+
+    task = g_task_new (self, NULL, callback, user_data);
+
+    g_object_get (self,
+                  MM_IFACE_MODEM_BEARER_LIST, &bearer_list,
+                  NULL);
+
+    /* If no bearer list (e.g. none created or modem disabled), we're done */
+    if (!bearer_list) {
+        g_task_return_boolean (task, TRUE);
+        g_object_unref (task);
+        return;
+    }
+
+    mm_bearer_list_sync_all_bearers (bearer_list,
+                                     (GAsyncReadyCallback)sync_all_bearers_ready,
+                                     task);
+}
+
 #endif
 
 /*****************************************************************************/
@@ -5979,6 +6369,7 @@ interface_initialization_step (GTask *task)
                           "signal::handle-set-current-modes",        G_CALLBACK (handle_set_current_modes),        self,
                           "signal::handle-set-primary-sim-slot",     G_CALLBACK (handle_set_primary_sim_slot),     self,
                           "signal::handle-get-cell-info",            G_CALLBACK (handle_get_cell_info),            self,
+                          "signal::handle-get-recent-cell-info",     G_CALLBACK (handle_get_recent_cell_info),     self,
                           NULL);
 
         /* Finally, export the new interface, even if we got errors, but only if not
@@ -493,6 +493,14 @@ gboolean mm_iface_modem_sync_finish    (MMIfaceModem *self,
                                         GAsyncResult *res,
                                         GError **error);
 
+/* Sync connection status of all bearers (async) */
+void     mm_iface_modem_sync_bearers        (MMIfaceModem         *self,
+                                             GAsyncReadyCallback   callback,
+                                             gpointer              user_data);
+gboolean mm_iface_modem_sync_bearers_finish (MMIfaceModem         *self,
+                                             GAsyncResult         *res,
+                                             GError              **error);
+
 #endif
 
 /* Allow setting power state */
@@ -516,6 +524,29 @@ MMModemLock mm_iface_modem_update_lock_info_finish (MMIfaceModem *self,
                                                     GAsyncResult *res,
                                                     GError **error);
 
+/* Wait for the SIM to become ready after unlock.
+ * The wait finishes as soon as the SIM is reported ready via
+ * mm_iface_modem_report_sim_ready() (e.g. from URC or indication handlers),
+ * as soon as the optional 'check' reports the SIM ready (run with an
+ * increasing back-off), or after 'max_wait_secs' at most. */
+typedef void     (* MMIfaceModemSimReadyCheckFn)       (MMIfaceModem         *self,
+                                                        GAsyncReadyCallback   callback,
+                                                        gpointer              user_data);
+typedef gboolean (* MMIfaceModemSimReadyCheckFinishFn) (MMIfaceModem         *self,
+                                                        GAsyncResult         *res,
+                                                        GError              **error);
+void     mm_iface_modem_wait_sim_ready        (MMIfaceModem                      *self,
+                                               guint                              max_wait_secs,
+                                               MMIfaceModemSimReadyCheckFn        check,
+                                               MMIfaceModemSimReadyCheckFinishFn  check_finish,
+                                               GAsyncReadyCallback                callback,
+                                               gpointer                           user_data);
+gboolean mm_iface_modem_wait_sim_ready_finish (MMIfaceModem                      *self,
+                                               GAsyncResult                      *res,
+                                               GError                           **error);
+void     mm_iface_modem_report_sim_ready      (MMIfaceModem                      *self,
+                                               gboolean                           ready);
+
 MMModemLock      mm_iface_modem_get_unlock_required (MMIfaceModem *self);
 MMUnlockRetries *mm_iface_modem_get_unlock_retries  (MMIfaceModem *self);
 
@@ -545,6 +576,21 @@ void mm_iface_modem_update_failed_state (MMIfaceModem *self,
 void mm_iface_modem_update_own_numbers (MMIfaceModem *self,
                                         const GStrv own_numbers);
 
+/* Allow reporting cell info updates, e.g. from unsolicited indications */
+void mm_iface_modem_update_cell_info (MMIfaceModem *self,
+                                      GList        *info_list);
+
+/* Cell info loading, shared with any other ongoing load; the result is also
+ * reported as a cell info update */
+gboolean  mm_iface_modem_has_recent_cell_info (MMIfaceModem         *self,
+                                               guint                 max_age);
+void      mm_iface_modem_load_cell_info       (MMIfaceModem         *self,
+                                               GAsyncReadyCallback   callback,
+                                               gpointer              user_data);
+GVariant *mm_iface_modem_load_cell_info_finish (MMIfaceModem        *self,
+                                                GAsyncResult        *res,
+                                                GError             **error);
+
 /* Allow reporting new access tech */
 void mm_iface_modem_update_access_technologies (MMIfaceModem *self,
                                                 MMModemAccessTechnology access_tech,
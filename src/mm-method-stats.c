@@ -0,0 +1,415 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details:
+ *
+ * Copyright (C) 2026 The ModemManager authors
+ */
+
+#include <config.h>
+
+#include "mm-log-object.h"
+#include "mm-utils.h"
+#include "mm-method-stats.h"
+
+/*
+ * Method call latencies are measured in a filter of the D-Bus connection,
+ * from the reception of the method call until the reply or error is sent
+ * back, so the time spent in authorization, waiting in the modem command
+ * queues and doing modem I/O is all included. The authorization time is
+ * additionally recorded on its own by the auth provider.
+ *
+ * Internal daemon operations that don't map to a single method call (e.g.
+ * the synchronization of the modems after a system resume) may also record
+ * their latency explicitly, as named operations.
+ *
+ * The connection filter runs in the GDBus worker thread, so all the
+ * collected data is protected by a mutex.
+ */
+
+/* Latencies are stored in buckets of powers of two, in microseconds */
+#define N_BUCKETS 32
+
+/* Limit of method calls being tracked at the same time, so that missing
+ * replies don't make the pending table grow unbounded */
+#define MAX_PENDING_CALLS 1024
+
+typedef struct {
+    guint   count;
+    guint64 max;
+    guint   buckets[N_BUCKETS];
+} Histogram;
+
+typedef struct {
+    gchar     *interface;
+    gchar     *method;
+    /* Set instead of interface and method for named operations */
+    gchar     *operation;
+    guint      errors;
+    Histogram  latency;
+    Histogram  auth;
+} MethodStats;
+
+typedef struct {
+    MethodStats *stats;
+    gint64       start_time;
+} PendingCall;
+
+struct _MMMethodStats {
+    GObject          parent;
+    GMutex           mutex;
+    GDBusConnection *connection;
+    guint            filter_id;
+    /* Method statistics, keyed by "interface.method" */
+    GHashTable      *methods;
+    /* Named operation statistics, keyed by operation name */
+    GHashTable      *operations;
+    /* Pending method calls, keyed by "sender:serial" */
+    GHashTable      *pending;
+};
+
+struct _MMMethodStatsClass {
+    GObjectClass parent;
+};
+
+static void log_object_iface_init (MMLogObjectInterface *iface);
+
+G_DEFINE_TYPE_EXTENDED (MMMethodStats, mm_method_stats, G_TYPE_OBJECT, 0,
+                        G_IMPLEMENT_INTERFACE (MM_TYPE_LOG_OBJECT, log_object_iface_init))
+
+/*****************************************************************************/
+
+static void
+histogram_add (Histogram *histogram,
+               guint64    value)
+{
+    guint bucket;
+
+    bucket = MIN (g_bit_storage (value), N_BUCKETS - 1);
+    histogram->buckets[bucket]++;
+    histogram->count++;
+    histogram->max = MAX (histogram->max, value);
+}
+
+/* Returns the upper limit of the bucket where the given percentile falls */
+static guint64
+histogram_get_percentile (const Histogram *histogram,
+                          guint            percentile)
+{
+    guint64 target;
+    guint64 accumulated = 0;
+    guint   i;
+
+    if (!histogram->count)
+        return 0;
+
+    target = MAX (((guint64) histogram->count * percentile + 99) / 100, 1);
+    for (i = 0; i < N_BUCKETS; i++) {
+        accumulated += histogram->buckets[i];
+        if (accumulated >= target)
+            return MIN (((guint64) 1 << i) - 1, histogram->max);
+    }
+    return histogram->max;
+}
+
+static void
+method_stats_free (MethodStats *stats)
+{
+    g_free (stats->interface);
+    g_free (stats->method);
+    g_free (stats->operation);
+    g_slice_free (MethodStats, stats);
+}
+
+static MethodStats *
+lookup_method_stats (MMMethodStats *self,
+                     const gchar   *interface,
+                     const gchar   *method)
+{
+    g_autofree gchar *key = NULL;
+    MethodStats      *stats;
+
+    interface = interface ? interface : "";
+    method = method ? method : "";
+
+    key = g_strdup_printf ("%s.%s", interface, method);
+    stats = g_hash_table_lookup (self->methods, key);
+    if (!stats) {
+        stats = g_slice_new0 (MethodStats);
+        stats->interface = g_strdup (interface);
+        stats->method = g_strdup (method);
+        g_hash_table_insert (self->methods, g_steal_pointer (&key), stats);
+    }
+    return stats;
+}
+
+/*****************************************************************************/
+
+static void
+call_started (MMMethodStats *self,
+              GDBusMessage  *message)
+{
+    PendingCall *pending;
+
+    if (g_dbus_message_get_flags (message) & G_DBUS_MESSAGE_FLAGS_NO_REPLY_EXPECTED)
+        return;
+    if (g_hash_table_size (self->pending) >= MAX_PENDING_CALLS)
+        return;
+
+    pending = g_slice_new (PendingCall);
+    pending->start_time = g_get_monotonic_time ();
+    pending->stats = lookup_method_stats (self,
+                                          g_dbus_message_get_interface (message),
+                                          g_dbus_message_get_member (message));
+    g_hash_table_insert (self->pending,
+                         g_strdup_printf ("%s:%u",
+                                          g_dbus_message_get_sender (message),
+                                          g_dbus_message_get_serial (message)),
+                         pending);
+}
+
+static void
+call_finished (MMMethodStats *self,
+               GDBusMessage  *message,
+               gboolean       error)
+{
+    g_autofree gchar *key = NULL;
+    PendingCall      *pending;
+
+    key = g_strdup_printf ("%s:%u",
+                           g_dbus_message_get_destination (message),
+                           g_dbus_message_get_reply_serial (message));
+    pending = g_hash_table_lookup (self->pending, key);
+    if (!pending)
+        return;
+
+    histogram_add (&pending->stats->latency, g_get_monotonic_time () - pending->start_time);
+    if (error)
+        pending->stats->errors++;
+    g_hash_table_remove (self->pending, key);
+}
+
+static GDBusMessage *
+connection_filter (GDBusConnection *connection,
+                   GDBusMessage    *message,
+                   gboolean         incoming,
+                   MMMethodStats   *self)
+{
+    GDBusMessageType type;
+
+    type = g_dbus_message_get_message_type (message);
+
+    g_mutex_lock (&self->mutex);
+    if (incoming && type == G_DBUS_MESSAGE_TYPE_METHOD_CALL)
+        call_started (self, message);
+    else if (!incoming && (type == G_DBUS_MESSAGE_TYPE_METHOD_RETURN || type == G_DBUS_MESSAGE_TYPE_ERROR))
+        call_finished (self, message, type == G_DBUS_MESSAGE_TYPE_ERROR);
+    g_mutex_unlock (&self->mutex);
+
+    return message;
+}
+
+void
+mm_method_stats_monitor_connection (MMMethodStats   *self,
+                                    GDBusConnection *connection)
+{
+    g_assert (!self->connection);
+
+    mm_obj_msg (self, "collecting D-Bus method statistics");
+    self->connection = g_object_ref (connection);
+    self->filter_id = g_dbus_connection_add_filter (connection,
+                                                    (GDBusMessageFilterFunction) connection_filter,
+                                                    self,
+                                                    NULL);
+}
+
+/*****************************************************************************/
+
+void
+mm_method_stats_record_auth (MMMethodStats         *self,
+                             GDBusMethodInvocation *invocation,
+                             gint64                 elapsed_us)
+{
+    MethodStats *stats;
+
+    if (!self->connection)
+        return;
+
+    g_mutex_lock (&self->mutex);
+    stats = lookup_method_stats (self,
+                                 g_dbus_method_invocation_get_interface_name (invocation),
+                                 g_dbus_method_invocation_get_method_name (invocation));
+    histogram_add (&stats->auth, elapsed_us);
+    g_mutex_unlock (&self->mutex);
+}
+
+/*****************************************************************************/
+
+void
+mm_method_stats_record_operation (MMMethodStats *self,
+                                  const gchar   *operation,
+                                  gint64         elapsed_us,
+                                  gboolean       failed)
+{
+    MethodStats *stats;
+
+    if (!self->connection)
+        return;
+
+    g_mutex_lock (&self->mutex);
+    stats = g_hash_table_lookup (self->operations, operation);
+    if (!stats) {
+        stats = g_slice_new0 (MethodStats);
+        stats->operation = g_strdup (operation);
+        g_hash_table_insert (self->operations, g_strdup (operation), stats);
+    }
+    histogram_add (&stats->latency, elapsed_us);
+    if (failed)
+        stats->errors++;
+    g_mutex_unlock (&self->mutex);
+}
+
+/*****************************************************************************/
+
+static void
+builder_add_uint (GVariantBuilder *builder,
+                  const gchar     *key,
+                  guint64          value)
+{
+    g_variant_builder_add (builder, "{sv}", key, g_variant_new_uint32 ((guint32) MIN (value, G_MAXUINT32)));
+}
+
+static void
+builder_add_stats (GVariantBuilder   *builder,
+                   const MethodStats *stats)
+{
+    g_variant_builder_open (builder, G_VARIANT_TYPE ("a{sv}"));
+    if (stats->operation)
+        g_variant_builder_add (builder, "{sv}", "operation", g_variant_new_string (stats->operation));
+    else {
+        g_variant_builder_add (builder, "{sv}", "interface", g_variant_new_string (stats->interface));
+        g_variant_builder_add (builder, "{sv}", "method",    g_variant_new_string (stats->method));
+    }
+    builder_add_uint (builder, "count",       stats->latency.count);
+    builder_add_uint (builder, "errors",      stats->errors);
+    builder_add_uint (builder, "latency-p50", histogram_get_percentile (&stats->latency, 50));
+    builder_add_uint (builder, "latency-p99", histogram_get_percentile (&stats->latency, 99));
+    builder_add_uint (builder, "latency-max", stats->latency.max);
+    if (stats->auth.count) {
+        builder_add_uint (builder, "auth-count",       stats->auth.count);
+        builder_add_uint (builder, "auth-latency-p50", histogram_get_percentile (&stats->auth, 50));
+        builder_add_uint (builder, "auth-latency-p99", histogram_get_percentile (&stats->auth, 99));
+        builder_add_uint (builder, "auth-latency-max", stats->auth.max);
+    }
+    g_variant_builder_close (builder);
+}
+
+GVariant *
+mm_method_stats_build_variant (MMMethodStats *self)
+{
+    GVariantBuilder builder;
+    GHashTableIter  iter;
+    MethodStats    *stats;
+
+    g_variant_builder_init (&builder, G_VARIANT_TYPE ("aa{sv}"));
+
+    g_mutex_lock (&self->mutex);
+    g_hash_table_iter_init (&iter, self->methods);
+    while (g_hash_table_iter_next (&iter, NULL, (gpointer *)&stats))
+        builder_add_stats (&builder, stats);
+    g_hash_table_iter_init (&iter, self->operations);
+    while (g_hash_table_iter_next (&iter, NULL, (gpointer *)&stats))
+        builder_add_stats (&builder, stats);
+    g_mutex_unlock (&self->mutex);
+
+    return g_variant_builder_end (&builder);
+}
+
+void
+mm_method_stats_reset (MMMethodStats *self)
+{
+    mm_obj_dbg (self, "resetting D-Bus method statistics");
+
+    g_mutex_lock (&self->mutex);
+    /* Pending calls refer to the method stats, so remove them as well */
+    g_hash_table_remove_all (self->pending);
+    g_hash_table_remove_all (self->methods);
+    g_hash_table_remove_all (self->operations);
+    g_mutex_unlock (&self->mutex);
+}
+
+/*****************************************************************************/
+
+static gchar *
+log_object_build_id (MMLogObject *_self)
+{
+    return g_strdup ("method-stats");
+}
+
+/*****************************************************************************/
+
+static void
+pending_call_free (PendingCall *pending)
+{
+    g_slice_free (PendingCall, pending);
+}
+
+static void
+mm_method_stats_init (MMMethodStats *self)
+{
+    g_mutex_init (&self->mutex);
+    self->methods = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, (GDestroyNotify) method_stats_free);
+    self->operations = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, (GDestroyNotify) method_stats_free);
+    self->pending = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, (GDestroyNotify) pending_call_free);
+}
+
+static void
+dispose (GObject *object)
+{
+    MMMethodStats *self = MM_METHOD_STATS (object);
+
+    if (self->connection) {
+        g_dbus_connection_remove_filter (self->connection, self->filter_id);
+        self->filter_id = 0;
+        g_clear_object (&self->connection);
+    }
+
+    G_OBJECT_CLASS (mm_method_stats_parent_class)->dispose (object);
+}
+
+static void
+finalize (GObject *object)
+{
+    MMMethodStats *self = MM_METHOD_STATS (object);
+
+    g_hash_table_unref (self->pending);
+    g_hash_table_unref (self->operations);
+    g_hash_table_unref (self->methods);
+    g_mutex_clear (&self->mutex);
+
+    G_OBJECT_CLASS (mm_method_stats_parent_class)->finalize (object);
+}
+
+static void
+log_object_iface_init (MMLogObjectInterface *iface)
+{
+    iface->build_id = log_object_build_id;
+}
+
+static void
+mm_method_stats_class_init (MMMethodStatsClass *klass)
+{
+    GObjectClass *object_class = G_OBJECT_CLASS (klass);
+
+    object_class->dispose  = dispose;
+    object_class->finalize = finalize;
+}
+
+MM_DEFINE_SINGLETON_GETTER (MMMethodStats, mm_method_stats_get, MM_TYPE_METHOD_STATS);
@@ -0,0 +1,59 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details:
+ *
+ * Copyright (C) 2026 The ModemManager authors
+ */
+
+#ifndef MM_METHOD_STATS_H
+#define MM_METHOD_STATS_H
+
+#include <glib-object.h>
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+#define MM_TYPE_METHOD_STATS         (mm_method_stats_get_type ())
+#define MM_METHOD_STATS(o)           (G_TYPE_CHECK_INSTANCE_CAST ((o), MM_TYPE_METHOD_STATS, MMMethodStats))
+#define MM_METHOD_STATS_CLASS(k)     (G_TYPE_CHECK_CLASS_CAST ((k), MM_TYPE_METHOD_STATS, MMMethodStatsClass))
+#define MM_METHOD_STATS_GET_CLASS(o) (G_TYPE_INSTANCE_GET_CLASS ((o), MM_TYPE_METHOD_STATS, MMMethodStatsClass))
+#define MM_IS_METHOD_STATS(o)        (G_TYPE_CHECK_INSTANCE_TYPE ((o), MM_TYPE_METHOD_STATS))
+#define MM_IS_METHOD_STATS_CLASS(k)  (G_TYPE_CHECK_CLASS_TYPE ((k), MM_TYPE_METHOD_STATS))
+
+typedef struct _MMMethodStats      MMMethodStats;
+typedef struct _MMMethodStatsClass MMMethodStatsClass;
+
+GType          mm_method_stats_get_type (void) G_GNUC_CONST;
+MMMethodStats *mm_method_stats_get      (void);
+
+/* Start collecting the latency of all the method calls received in the
+ * given connection. Nothing is recorded until this is called. */
+void      mm_method_stats_monitor_connection (MMMethodStats         *self,
+                                              GDBusConnection       *connection);
+
+/* Record the time spent authorizing the given method call */
+void      mm_method_stats_record_auth        (MMMethodStats         *self,
+                                              GDBusMethodInvocation *invocation,
+                                              gint64                 elapsed_us);
+
+/* Record the latency of a named internal operation */
+void      mm_method_stats_record_operation   (MMMethodStats         *self,
+                                              const gchar           *operation,
+                                              gint64                 elapsed_us,
+                                              gboolean               failed);
+
+/* Build a aa{sv} variant with the statistics of each method and operation */
+GVariant *mm_method_stats_build_variant      (MMMethodStats         *self);
+void      mm_method_stats_reset              (MMMethodStats         *self);
+
+G_END_DECLS
+
+#endif /* MM_METHOD_STATS_H */
@@ -34,6 +34,7 @@
 #include "mm-modem-helpers.h"
 #include "mm-helper-enums-types.h"
 #include "mm-log-object.h"
+#include "mm-regex.h"
 
 /*****************************************************************************/
 
@@ -460,10 +461,9 @@ mm_voice_ring_regex_get (void)
     /* Example:
      * <CR><LF>RING<CR><LF>
      */
-    return g_regex_new ("\\r\\nRING(?:\\r)?\\r\\n",
-                        G_REGEX_RAW | G_REGEX_OPTIMIZE,
-                        0,
-                        NULL);
+    return mm_regex_get ("\\r\\nRING(?:\\r)?\\r\\n",
+                         G_REGEX_RAW | G_REGEX_OPTIMIZE,
+                         0);
 }
 
 GRegex *
@@ -473,10 +473,9 @@ mm_voice_cring_regex_get (void)
      * <CR><LF>+CRING: VOICE<CR><LF>
      * <CR><LF>+CRING: DATA<CR><LF>
      */
-    return g_regex_new ("\\r\\n\\+CRING:\\s*(\\S+)\\r\\n",
-                        G_REGEX_RAW | G_REGEX_OPTIMIZE,
-                        0,
-                        NULL);
+    return mm_regex_get ("\\r\\n\\+CRING:\\s*(\\S+)\\r\\n",
+                         G_REGEX_RAW | G_REGEX_OPTIMIZE,
+                         0);
 }
 
 GRegex *
@@ -490,10 +489,9 @@ mm_voice_clip_regex_get (void)
      *   <CR><LF>+CLIP: "+393351391306",145,,,,0<CR><LF>
      *                   \_ Number      \_ Type
      */
-    return g_regex_new ("\\r\\n\\+CLIP:\\s*([^,\\s]*)\\s*,\\s*(\\d+)\\s*,?(.*)\\r\\n",
-                        G_REGEX_RAW | G_REGEX_OPTIMIZE,
-                        0,
-                        NULL);
+    return mm_regex_get ("\\r\\n\\+CLIP:\\s*([^,\\s]*)\\s*,\\s*(\\d+)\\s*,?(.*)\\r\\n",
+                         G_REGEX_RAW | G_REGEX_OPTIMIZE,
+                         0);
 }
 
 GRegex *
@@ -507,10 +505,9 @@ mm_voice_ccwa_regex_get (void)
      *   <CR><LF>+CCWA: "+393351391306",145,1
      *                   \_ Number      \_ Type
      */
-    return g_regex_new ("\\r\\n\\+CCWA:\\s*([^,\\s]*)\\s*,\\s*(\\d+)\\s*,\\s*(\\d+)\\s*,?(.*)\\r\\n",
-                        G_REGEX_RAW | G_REGEX_OPTIMIZE,
-                        0,
-                        NULL);
+    return mm_regex_get ("\\r\\n\\+CCWA:\\s*([^,\\s]*)\\s*,\\s*(\\d+)\\s*,\\s*(\\d+)\\s*,?(.*)\\r\\n",
+                         G_REGEX_RAW | G_REGEX_OPTIMIZE,
+                         0);
 }
 
 static void
@@ -522,6 +519,14 @@ call_info_free (MMCallInfo *info)
     g_slice_free (MMCallInfo, info);
 }
 
+#define CLCC_REGEX \
+    "\\+CLCC:\\s*(\\d+),\\s*(\\d+),\\s*(\\d+),\\s*(\\d+),\\s*(\\d+)" /* mandatory fields */ \
+    "(?:,\\s*([^,]*),\\s*(\\d+)"                                     /* number and type */ \
+    "(?:,\\s*([^,]*)"                                                /* alpha */ \
+    "(?:,\\s*(\\d*)"                                                 /* priority */ \
+    "(?:,\\s*(\\d*)"                                                 /* CLI validity */ \
+    ")?)?)?)?$"
+
 gboolean
 mm_3gpp_parse_clcc_response (const gchar  *str,
                              gpointer      log_object,
@@ -565,15 +570,9 @@ mm_3gpp_parse_clcc_response (const gchar  *str,
      *  ...
      */
 
-    r = g_regex_new ("\\+CLCC:\\s*(\\d+),\\s*(\\d+),\\s*(\\d+),\\s*(\\d+),\\s*(\\d+)" /* mandatory fields */
-                     "(?:,\\s*([^,]*),\\s*(\\d+)"                                     /* number and type */
-                     "(?:,\\s*([^,]*)"                                                /* alpha */
-                     "(?:,\\s*(\\d*)"                                                 /* priority */
-                     "(?:,\\s*(\\d*)"                                                 /* CLI validity */
-                     ")?)?)?)?$",
-                     G_REGEX_RAW | G_REGEX_MULTILINE | G_REGEX_NEWLINE_CRLF,
-                     G_REGEX_MATCH_NEWLINE_CRLF,
-                     NULL);
+    r = mm_regex_get (CLCC_REGEX,
+                      G_REGEX_RAW | G_REGEX_MULTILINE | G_REGEX_NEWLINE_CRLF,
+                      G_REGEX_MATCH_NEWLINE_CRLF);
     g_assert (r != NULL);
 
     g_regex_match_full (r, str, strlen (str), 0, 0, &match_info, &inner_error);
@@ -728,6 +727,8 @@ out:
     return mask;
 }
 
+#define IFC_TEST_REGEX "(?:\\+IFC:)?\\s*\\((.*)\\),\\((.*)\\)(?:\\r\\n)?"
+
 MMFlowControl
 mm_parse_ifc_test_response (const gchar  *response,
                             gpointer      log_object,
@@ -740,7 +741,7 @@ mm_parse_ifc_test_response (const gchar  *response,
     MMFlowControl          ta_mask     = MM_FLOW_CONTROL_UNKNOWN;
     MMFlowControl          mask        = MM_FLOW_CONTROL_UNKNOWN;
 
-    r = g_regex_new ("(?:\\+IFC:)?\\s*\\((.*)\\),\\((.*)\\)(?:\\r\\n)?", 0, 0, NULL);
+    r = mm_regex_get (IFC_TEST_REGEX, 0, 0);
     g_assert (r != NULL);
 
     g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -867,10 +868,10 @@ mm_3gpp_creg_regex_get (gboolean solicited)
 
         if (solicited) {
             pattern = g_strdup_printf ("%s$", creg_regex[i]);
-            regex = g_regex_new (pattern, G_REGEX_RAW | G_REGEX_OPTIMIZE, 0, NULL);
+            regex = mm_regex_get (pattern, G_REGEX_RAW | G_REGEX_OPTIMIZE, 0);
         } else {
             pattern = g_strdup_printf ("\\r\\n%s\\r\\n", creg_regex[i]);
-            regex = g_regex_new (pattern, G_REGEX_RAW | G_REGEX_OPTIMIZE, 0, NULL);
+            regex = mm_regex_get (pattern, G_REGEX_RAW | G_REGEX_OPTIMIZE, 0);
         }
         g_assert (regex);
         g_ptr_array_add (array, regex);
@@ -890,10 +891,9 @@ mm_3gpp_creg_regex_destroy (GPtrArray *array)
 GRegex *
 mm_3gpp_ciev_regex_get (void)
 {
-    return g_regex_new ("\\r\\n\\+CIEV: (.*),(\\d)\\r\\n",
-                        G_REGEX_RAW | G_REGEX_OPTIMIZE,
-                        0,
-                        NULL);
+    return mm_regex_get ("\\r\\n\\+CIEV: (.*),(\\d)\\r\\n",
+                         G_REGEX_RAW | G_REGEX_OPTIMIZE,
+                         0);
 }
 
 /*************************************************************************/
@@ -901,10 +901,9 @@ mm_3gpp_ciev_regex_get (void)
 GRegex *
 mm_3gpp_cgev_regex_get (void)
 {
-    return g_regex_new ("\\r\\n\\+CGEV:\\s*(.*)\\r\\n",
-                        G_REGEX_RAW | G_REGEX_OPTIMIZE,
-                        0,
-                        NULL);
+    return mm_regex_get ("\\r\\n\\+CGEV:\\s*(.*)\\r\\n",
+                         G_REGEX_RAW | G_REGEX_OPTIMIZE,
+                         0);
 }
 
 /*************************************************************************/
@@ -912,10 +911,9 @@ mm_3gpp_cgev_regex_get (void)
 GRegex *
 mm_3gpp_cusd_regex_get (void)
 {
-    return g_regex_new ("\\r\\n\\+CUSD:\\s*(.*)\\r\\n",
-                        G_REGEX_RAW | G_REGEX_OPTIMIZE,
-                        0,
-                        NULL);
+    return mm_regex_get ("\\r\\n\\+CUSD:\\s*(.*)\\r\\n",
+                         G_REGEX_RAW | G_REGEX_OPTIMIZE,
+                         0);
 }
 
 /*************************************************************************/
@@ -923,10 +921,9 @@ mm_3gpp_cusd_regex_get (void)
 GRegex *
 mm_3gpp_cmti_regex_get (void)
 {
-    return g_regex_new ("\\r\\n\\+CMTI:\\s*\"(\\S+)\",\\s*(\\d+)\\r\\n",
-                        G_REGEX_RAW | G_REGEX_OPTIMIZE,
-                        0,
-                        NULL);
+    return mm_regex_get ("\\r\\n\\+CMTI:\\s*\"(\\S+)\",\\s*(\\d+)\\r\\n",
+                         G_REGEX_RAW | G_REGEX_OPTIMIZE,
+                         0);
 }
 
 GRegex *
@@ -935,10 +932,9 @@ mm_3gpp_cds_regex_get (void)
     /* Example:
      * <CR><LF>+CDS: 24<CR><LF>07914356060013F10659098136395339F6219011707193802190117071938030<CR><LF>
      */
-    return g_regex_new ("\\r\\n\\+CDS:\\s*(\\d+)\\r\\n(.*)\\r\\n",
-                        G_REGEX_RAW | G_REGEX_OPTIMIZE,
-                        0,
-                        NULL);
+    return mm_regex_get ("\\r\\n\\+CDS:\\s*(\\d+)\\r\\n(.*)\\r\\n",
+                         G_REGEX_RAW | G_REGEX_OPTIMIZE,
+                         0);
 }
 
 /*************************************************************************/
@@ -994,6 +990,8 @@ static const Ws46Mode ws46_modes[] = {
     { 42, MM_MODEM_MODE_2G | MM_MODEM_MODE_5G },
 };
 
+#define WS46_TEST_REGEX "(?:\\+WS46:)?\\s*\\((.*)\\)(?:\\r\\n)?"
+
 GArray *
 mm_3gpp_parse_ws46_test_response (const gchar  *response,
                                   gpointer      log_object,
@@ -1015,7 +1013,7 @@ mm_3gpp_parse_ws46_test_response (const gchar  *response,
     gboolean               supported_mode_25 = FALSE;
     gboolean               supported_mode_29 = FALSE;
 
-    r = g_regex_new ("(?:\\+WS46:)?\\s*\\((.*)\\)(?:\\r\\n)?", 0, 0, NULL);
+    r = mm_regex_get (WS46_TEST_REGEX, 0, 0);
     g_assert (r != NULL);
 
     g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -1198,6 +1196,10 @@ get_mm_access_tech_from_etsi_access_tech (guint    val,
     return MM_MODEM_ACCESS_TECHNOLOGY_UNKNOWN;
 }
 
+#define COPS_TEST_REGEX "\\((\\d),\"([^\"\\)]*)\",([^,\\)]*),([^,\\)]*)[\\)]?,(\\d+)\\)"
+
+#define COPS_TEST_PRE_UMTS_REGEX "\\((\\d),([^,\\)]*),([^,\\)]*),([^\\)]*)\\)"
+
 GList *
 mm_3gpp_parse_cops_test_response (const gchar     *reply,
                                   MMModemCharset   cur_charset,
@@ -1236,7 +1238,7 @@ mm_3gpp_parse_cops_test_response (const gchar     *reply,
      *       +COPS: (2,"","T-Mobile","31026",0),(1,"AT&T","AT&T","310410"),0)
      */
 
-    r = g_regex_new ("\\((\\d),\"([^\"\\)]*)\",([^,\\)]*),([^,\\)]*)[\\)]?,(\\d+)\\)", G_REGEX_UNGREEDY, 0, NULL);
+    r = mm_regex_get (COPS_TEST_REGEX, G_REGEX_UNGREEDY, 0);
     g_assert (r);
 
     /* If we didn't get any hits, try the pre-UMTS format match */
@@ -1257,7 +1259,7 @@ mm_3gpp_parse_cops_test_response (const gchar     *reply,
          *       +COPS: (2,"T - Mobile",,"31026"),(1,"Einstein PCS",,"31064"),(1,"Cingular",,"31041"),,(0,1,3),(0,2)
          */
 
-        r = g_regex_new ("\\((\\d),([^,\\)]*),([^,\\)]*),([^\\)]*)\\)", G_REGEX_UNGREEDY, 0, NULL);
+        r = mm_regex_get (COPS_TEST_PRE_UMTS_REGEX, G_REGEX_UNGREEDY, 0);
         g_assert (r);
 
         g_regex_match (r, reply, 0, &match_info);
@@ -1338,6 +1340,8 @@ mm_3gpp_parse_cops_test_response (const gchar     *reply,
 
 /*************************************************************************/
 
+#define COPS_READ_REGEX "\\+COPS:\\s*(\\d+),(\\d+),([^,]*)(?:,(\\d+))?(?:\\r\\n)?"
+
 gboolean
 mm_3gpp_parse_cops_read_response (const gchar              *response,
                                   guint                    *out_mode,
@@ -1363,7 +1367,7 @@ mm_3gpp_parse_cops_read_response (const gchar              *response,
      * or:
      *   +COPS: <mode>,<format>,<oper>,<AcT>
      */
-    r = g_regex_new ("\\+COPS:\\s*(\\d+),(\\d+),([^,]*)(?:,(\\d+))?(?:\\r\\n)?", 0, 0, NULL);
+    r = mm_regex_get (COPS_READ_REGEX, 0, 0);
     g_assert (r != NULL);
 
     g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -1727,6 +1731,8 @@ mm_3gpp_pdp_context_format_list_free (GList *pdp_format_list)
     g_list_free_full (pdp_format_list, (GDestroyNotify) mm_3gpp_pdp_context_format_free);
 }
 
+#define CGDCONT_TEST_REGEX "\\+CGDCONT:\\s*\\(\\s*(\\d+)\\s*-?\\s*(\\d+)?[^\\)]*\\)\\s*,\\s*\\(?\"(\\S+)\""
+
 GList *
 mm_3gpp_parse_cgdcont_test_response (const gchar  *response,
                                      gpointer      log_object,
@@ -1742,9 +1748,9 @@ mm_3gpp_parse_cgdcont_test_response (const gchar  *response,
         return NULL;
     }
 
-    r = g_regex_new ("\\+CGDCONT:\\s*\\(\\s*(\\d+)\\s*-?\\s*(\\d+)?[^\\)]*\\)\\s*,\\s*\\(?\"(\\S+)\"",
-                     G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW,
-                     0, &inner_error);
+    r = mm_regex_get (CGDCONT_TEST_REGEX,
+                      G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW,
+                      0);
     g_assert (r != NULL);
 
     g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -1813,6 +1819,8 @@ mm_3gpp_pdp_context_cmp (MM3gppPdpContext *a,
     return (a->cid - b->cid);
 }
 
+#define CGDCONT_READ_REGEX "\\+CGDCONT:\\s*(\\d+)\\s*,([^, \\)]*)\\s*,([^, \\)]*)\\s*,([^, \\)]*)"
+
 GList *
 mm_3gpp_parse_cgdcont_read_response (const gchar *reply,
                                      GError **error)
@@ -1826,9 +1834,9 @@ mm_3gpp_parse_cgdcont_read_response (const gchar *reply,
         /* No APNs configured, all done */
         return NULL;
 
-    r = g_regex_new ("\\+CGDCONT:\\s*(\\d+)\\s*,([^, \\)]*)\\s*,([^, \\)]*)\\s*,([^, \\)]*)",
-                     G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW,
-                     0, NULL);
+    r = mm_regex_get (CGDCONT_READ_REGEX,
+                      G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW,
+                      0);
     g_assert (r);
 
     g_regex_match_full (r, reply, strlen (reply), 0, 0, &match_info, &inner_error);
@@ -1890,6 +1898,8 @@ mm_3gpp_pdp_context_active_cmp (MM3gppPdpContextActive *a,
     return (a->cid - b->cid);
 }
 
+#define CGACT_READ_REGEX "\\+CGACT:\\s*(\\d+),(\\d+)"
+
 GList *
 mm_3gpp_parse_cgact_read_response (const gchar *reply,
                                    GError **error)
@@ -1903,8 +1913,8 @@ mm_3gpp_parse_cgact_read_response (const gchar *reply,
         /* Nothing configured, all done */
         return NULL;
 
-    r = g_regex_new ("\\+CGACT:\\s*(\\d+),(\\d+)",
-                     G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0, &inner_error);
+    r = mm_regex_get (CGACT_READ_REGEX,
+                      G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0);
     g_assert (r);
 
     g_regex_match_full (r, reply, strlen (reply), 0, 0, &match_info, &inner_error);
@@ -2128,6 +2138,8 @@ mm_3gpp_parse_creg_response (GMatchInfo                    *info,
 
 #define CMGF_TAG "+CMGF:"
 
+#define CMGF_TEST_REGEX "\\(?\\s*(\\d+)\\s*[-,]?\\s*(\\d+)?\\s*\\)?"
+
 gboolean
 mm_3gpp_parse_cmgf_test_response (const gchar *reply,
                                   gboolean *sms_pdu_supported,
@@ -2146,9 +2158,7 @@ mm_3gpp_parse_cmgf_test_response (const gchar *reply,
     while (isspace (*reply))
         reply++;
 
-    r = g_regex_new ("\\(?\\s*(\\d+)\\s*[-,]?\\s*(\\d+)?\\s*\\)?", 0, 0, error);
-    if (!r)
-        return FALSE;
+    r = mm_regex_get (CMGF_TEST_REGEX, 0, 0);
 
     if (!g_regex_match (r, reply, 0, &match_info)) {
         g_set_error (error,
@@ -2180,6 +2190,8 @@ mm_3gpp_parse_cmgf_test_response (const gchar *reply,
 
 /*************************************************************************/
 
+#define CMGR_READ_REGEX "\\+CMGR:\\s*(\\d+)\\s*,([^,]*),\\s*(\\d+)\\s*([^\\r\\n]*)"
+
 MM3gppPduInfo *
 mm_3gpp_parse_cmgr_read_response (const gchar *reply,
                                   guint index,
@@ -2194,7 +2206,7 @@ mm_3gpp_parse_cmgr_read_response (const gchar *reply,
 
     /* +CMGR: <stat>,<alpha>,<length>(whitespace)<pdu> */
     /* The <alpha> and <length> fields are matched, but not currently used */
-    r = g_regex_new ("\\+CMGR:\\s*(\\d+)\\s*,([^,]*),\\s*(\\d+)\\s*([^\\r\\n]*)", 0, 0, NULL);
+    r = mm_regex_get (CMGR_READ_REGEX, 0, 0);
     g_assert (r);
 
     if (!g_regex_match (r, reply, 0, &match_info)) {
@@ -2247,6 +2259,8 @@ mm_3gpp_parse_cmgr_read_response (const gchar *reply,
 /*****************************************************************************/
 /* AT+CRSM response parser */
 
+#define CRSM_REGEX "\\+CRSM:\\s*(\\d+)\\s*,\\s*(\\d+)\\s*,\\s*\"?([0-9a-fA-F]+)\"?"
+
 gboolean
 mm_3gpp_parse_crsm_response (const gchar *reply,
                              guint *sw1,
@@ -2270,8 +2284,8 @@ mm_3gpp_parse_crsm_response (const gchar *reply,
         return FALSE;
     }
 
-    r = g_regex_new ("\\+CRSM:\\s*(\\d+)\\s*,\\s*(\\d+)\\s*,\\s*\"?([0-9a-fA-F]+)\"?",
-                     G_REGEX_RAW, 0, NULL);
+    r = mm_regex_get (CRSM_REGEX,
+                      G_REGEX_RAW, 0);
     g_assert (r != NULL);
 
     if (g_regex_match (r, reply, 0, &match_info) &&
@@ -2292,6 +2306,40 @@ mm_3gpp_parse_crsm_response (const gchar *reply,
     return TRUE;
 }
 
+GStrv
+mm_3gpp_split_crsm_responses (const gchar  *reply,
+                              GError      **error)
+{
+    g_autoptr(GPtrArray) responses = NULL;
+    g_auto(GStrv)        lines = NULL;
+    guint                i;
+
+    responses = g_ptr_array_new_with_free_func (g_free);
+    lines = g_strsplit_set (reply ? reply : "", "\r\n", -1);
+    for (i = 0; lines[i]; i++) {
+        gchar *line;
+
+        line = g_strstrip (lines[i]);
+        if (!line[0])
+            continue;
+        if (!g_str_has_prefix (line, "+CRSM:")) {
+            g_set_error (error, MM_CORE_ERROR, MM_CORE_ERROR_FAILED,
+                         "Unexpected line in CRSM responses: '%s'", line);
+            return NULL;
+        }
+        g_ptr_array_add (responses, g_strdup (line));
+    }
+
+    if (!responses->len) {
+        g_set_error (error, MM_CORE_ERROR, MM_CORE_ERROR_FAILED,
+                     "No CRSM responses found");
+        return NULL;
+    }
+
+    g_ptr_array_add (responses, NULL);
+    return (GStrv) g_ptr_array_free (g_steal_pointer (&responses), FALSE);
+}
+
 /*************************************************************************/
 /* CGCONTRDP=N response parser */
 
@@ -2342,6 +2390,17 @@ split_local_address_and_subnet (const gchar  *str,
     }
 }
 
+#define CGCONTRDP_REGEX \
+    "\\+CGCONTRDP: " \
+    "(\\d+),(\\d+),([^,]*)" /* cid, bearer id, apn */ \
+    "(?:,([^,]*))?" /* (a)ip+mask        or (b)ip */ \
+    "(?:,([^,]*))?" /* (a)gateway        or (b)mask */ \
+    "(?:,([^,]*))?" /* (a)dns1           or (b)gateway */ \
+    "(?:,([^,]*))?" /* (a)dns2           or (b)dns1 */ \
+    "(?:,([^,]*))?" /* (a)p-cscf primary or (b)dns2 */ \
+    "(?:,(.*))?"    /* others, ignored */ \
+    "(?:\\r\\n)?"
+
 gboolean
 mm_3gpp_parse_cgcontrdp_response (const gchar  *response,
                                   guint        *out_cid,
@@ -2382,16 +2441,8 @@ mm_3gpp_parse_cgcontrdp_response (const gchar  *response,
      * The format of the response changed in TS 27.007 v9.4.0, we try to detect
      * both formats ('a' if >= v9.4.0, 'b' if < v9.4.0) with a single regex here.
      */
-    r = g_regex_new ("\\+CGCONTRDP: "
-                     "(\\d+),(\\d+),([^,]*)" /* cid, bearer id, apn */
-                     "(?:,([^,]*))?" /* (a)ip+mask        or (b)ip */
-                     "(?:,([^,]*))?" /* (a)gateway        or (b)mask */
-                     "(?:,([^,]*))?" /* (a)dns1           or (b)gateway */
-                     "(?:,([^,]*))?" /* (a)dns2           or (b)dns1 */
-                     "(?:,([^,]*))?" /* (a)p-cscf primary or (b)dns2 */
-                     "(?:,(.*))?"    /* others, ignored */
-                     "(?:\\r\\n)?",
-                     0, 0, NULL);
+    r = mm_regex_get (CGCONTRDP_REGEX,
+                      0, 0);
     g_assert (r != NULL);
 
     g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -2462,6 +2513,8 @@ mm_3gpp_parse_cgcontrdp_response (const gchar  *response,
 
 /*************************************************************************/
 
+#define CFUN_QUERY_REGEX "\\+CFUN: (\\d+)(?:,(?:\\d+))?(?:\\r\\n)?"
+
 gboolean
 mm_3gpp_parse_cfun_query_response (const gchar  *response,
                                    guint        *out_state,
@@ -2478,7 +2531,7 @@ mm_3gpp_parse_cfun_query_response (const gchar  *response,
      * +CFUN: 1,0
      *   ..but we don't care about the second number
      */
-    r = g_regex_new ("\\+CFUN: (\\d+)(?:,(?:\\d+))?(?:\\r\\n)?", 0, 0, NULL);
+    r = mm_regex_get (CFUN_QUERY_REGEX, 0, 0);
     g_assert (r != NULL);
 
     g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -2511,6 +2564,8 @@ out:
 /*****************************************************************************/
 /* +CESQ response parser */
 
+#define CESQ_REGEX "\\+CESQ: (\\d+),(\\d+),(\\d+),(\\d+),(\\d+),(\\d+)(?:\\r\\n)?"
+
 gboolean
 mm_3gpp_parse_cesq_response (const gchar  *response,
                              guint        *out_rxlev,
@@ -2542,7 +2597,7 @@ mm_3gpp_parse_cesq_response (const gchar  *response,
     /* Response may be e.g.:
      * +CESQ: 99,99,255,255,20,80
      */
-    r = g_regex_new ("\\+CESQ: (\\d+),(\\d+),(\\d+),(\\d+),(\\d+),(\\d+)(?:\\r\\n)?", 0, 0, NULL);
+    r = mm_regex_get (CESQ_REGEX, 0, 0);
     g_assert (r != NULL);
 
     g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -2825,6 +2880,8 @@ mm_3gpp_parse_cemode_query_response (const gchar                    *response,
 /*************************************************************************/
 /* CCWA service query response parser */
 
+#define CCWA_SERVICE_QUERY_REGEX "\\+CCWA:\\s*(\\d+),\\s*(\\d+)$"
+
 gboolean
 mm_3gpp_parse_ccwa_service_query_response (const gchar  *response,
                                            gpointer      log_object,
@@ -2847,10 +2904,9 @@ mm_3gpp_parse_ccwa_service_query_response (const gchar  *response,
      *
      * We're only interested in class 1 (voice)
      */
-    r = g_regex_new ("\\+CCWA:\\s*(\\d+),\\s*(\\d+)$",
-                     G_REGEX_RAW | G_REGEX_MULTILINE | G_REGEX_NEWLINE_CRLF,
-                     G_REGEX_MATCH_NEWLINE_CRLF,
-                     NULL);
+    r = mm_regex_get (CCWA_SERVICE_QUERY_REGEX,
+                      G_REGEX_RAW | G_REGEX_MULTILINE | G_REGEX_NEWLINE_CRLF,
+                      G_REGEX_MATCH_NEWLINE_CRLF);
     g_assert (r != NULL);
 
     g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -2942,6 +2998,8 @@ storage_from_str (const gchar *str)
     return MM_SMS_STORAGE_UNKNOWN;
 }
 
+#define CPMS_TEST_REGEX "\\s*\"([^,\\)]+)\"\\s*"
+
 gboolean
 mm_3gpp_parse_cpms_test_response (const gchar  *reply,
                                   GArray      **mem1,
@@ -2976,7 +3034,7 @@ mm_3gpp_parse_cpms_test_response (const gchar  *reply,
         return FALSE;
     }
 
-    r = g_regex_new ("\\s*\"([^,\\)]+)\"\\s*", 0, 0, NULL);
+    r = mm_regex_get (CPMS_TEST_REGEX, 0, 0);
     g_assert (r);
 
     for (i = 0; i < N_EXPECTED_GROUPS; i++) {
@@ -3047,7 +3105,7 @@ mm_3gpp_parse_cpms_query_response (const gchar *reply,
     g_autoptr(GRegex)     r = NULL;
     g_autoptr(GMatchInfo) match_info = NULL;
 
-    r = g_regex_new (CPMS_QUERY_REGEX, G_REGEX_RAW, 0, NULL);
+    r = mm_regex_get (CPMS_QUERY_REGEX, G_REGEX_RAW, 0);
     g_assert (r);
 
     if (!g_regex_match (r, reply, 0, &match_info)) {
@@ -3096,6 +3154,8 @@ mm_3gpp_get_cpms_storage_match (GMatchInfo *match_info,
 
 /*************************************************************************/
 
+#define CSCS_TEST_REGEX "\\s*([^,\\)]+)\\s*"
+
 gboolean
 mm_3gpp_parse_cscs_test_response (const gchar *reply,
                                   MMModemCharset *out_charsets)
@@ -3126,7 +3186,7 @@ mm_3gpp_parse_cscs_test_response (const gchar *reply,
     }
 
     /* Now parse each charset */
-    r = g_regex_new ("\\s*([^,\\)]+)\\s*", 0, 0, NULL);
+    r = mm_regex_get (CSCS_TEST_REGEX, 0, 0);
     g_assert (r);
 
     if (g_regex_match (r, p, 0, &match_info)) {
@@ -3148,6 +3208,8 @@ mm_3gpp_parse_cscs_test_response (const gchar *reply,
 
 /*************************************************************************/
 
+#define CLCK_TEST_REGEX "\\s*\"([^,\\)]+)\"\\s*"
+
 gboolean
 mm_3gpp_parse_clck_test_response (const gchar *reply,
                                   MMModem3gppFacility *out_facilities)
@@ -3165,7 +3227,7 @@ mm_3gpp_parse_clck_test_response (const gchar *reply,
     reply = mm_strip_tag (reply, "+CLCK:");
 
     /* Now parse each facility */
-    r = g_regex_new ("\\s*\"([^,\\)]+)\"\\s*", 0, 0, NULL);
+    r = mm_regex_get (CLCK_TEST_REGEX, 0, 0);
     g_assert (r != NULL);
 
     *out_facilities = MM_MODEM_3GPP_FACILITY_NONE;
@@ -3188,6 +3250,8 @@ mm_3gpp_parse_clck_test_response (const gchar *reply,
 
 /*************************************************************************/
 
+#define CLCK_WRITE_REGEX "\\s*([01])\\s*"
+
 gboolean
 mm_3gpp_parse_clck_write_response (const gchar *reply,
                                    gboolean *enabled)
@@ -3200,7 +3264,7 @@ mm_3gpp_parse_clck_write_response (const gchar *reply,
 
     reply = mm_strip_tag (reply, "+CLCK:");
 
-    r = g_regex_new ("\\s*([01])\\s*", 0, 0, NULL);
+    r = mm_regex_get (CLCK_WRITE_REGEX, 0, 0);
     g_assert (r != NULL);
 
     if (g_regex_match (r, reply, 0, &match_info)) {
@@ -3225,6 +3289,8 @@ mm_3gpp_parse_clck_write_response (const gchar *reply,
 
 /*************************************************************************/
 
+#define CNUM_EXEC_REGEX "\\+CNUM:\\s*((\"([^\"]|(\\\"))*\")|([^,]*)),\"(?<num>\\S+)\",\\d"
+
 GStrv
 mm_3gpp_parse_cnum_exec_response (const gchar *reply)
 {
@@ -3236,8 +3302,8 @@ mm_3gpp_parse_cnum_exec_response (const gchar *reply)
     if (!reply || !reply[0])
         return NULL;
 
-    r = g_regex_new ("\\+CNUM:\\s*((\"([^\"]|(\\\"))*\")|([^,]*)),\"(?<num>\\S+)\",\\d",
-                     G_REGEX_UNGREEDY, 0, NULL);
+    r = mm_regex_get (CNUM_EXEC_REGEX,
+                      G_REGEX_UNGREEDY, 0);
     g_assert (r != NULL);
 
     array = g_ptr_array_new ();
@@ -3449,6 +3515,8 @@ mm_3gpp_cind_response_get_max (MM3gppCindResponse *r)
 
 #define CIND_TAG "+CIND:"
 
+#define CIND_TEST_REGEX "\\(([^,]*),\\((\\d+)[-,](\\d+).*\\)"
+
 GHashTable *
 mm_3gpp_parse_cind_test_response (const gchar *reply,
                                   GError **error)
@@ -3466,7 +3534,7 @@ mm_3gpp_parse_cind_test_response (const gchar *reply,
     while (isspace (*reply))
         reply++;
 
-    r = g_regex_new ("\\(([^,]*),\\((\\d+)[-,](\\d+).*\\)", G_REGEX_UNGREEDY, 0, NULL);
+    r = mm_regex_get (CIND_TEST_REGEX, G_REGEX_UNGREEDY, 0);
     g_assert (r);
 
     hash = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, (GDestroyNotify) cind_response_free);
@@ -3502,6 +3570,8 @@ mm_3gpp_parse_cind_test_response (const gchar *reply,
 
 /*************************************************************************/
 
+#define CIND_READ_REGEX "(\\d+)[^0-9]+"
+
 GByteArray *
 mm_3gpp_parse_cind_read_response (const gchar *reply,
                                   GError **error)
@@ -3523,7 +3593,7 @@ mm_3gpp_parse_cind_read_response (const gchar *reply,
 
     reply = mm_strip_tag (reply, CIND_TAG);
 
-    r = g_regex_new ("(\\d+)[^0-9]+", G_REGEX_UNGREEDY, 0, NULL);
+    r = mm_regex_get (CIND_READ_REGEX, G_REGEX_UNGREEDY, 0);
     g_assert (r != NULL);
 
     if (!g_regex_match (r, reply, 0, &match_info)) {
@@ -3655,6 +3725,13 @@ mm_3gpp_parse_cgev_indication_action (const gchar *str)
  * +CGEV: REJECT <PDP_type>, <PDP_addr>
  * +CGEV: NW REACT <PDP_type>, <PDP_addr>, [<cid>]
  */
+#define CGEV_PDP_REGEX \
+    "(?:" \
+    "REJECT|" \
+    "NW REACT|" \
+    "NW DEACT|ME DEACT" \
+    ")\\s*([^,]*),\\s*([^,]*)(?:,\\s*([0-9]+))?"
+
 gboolean
 mm_3gpp_parse_cgev_indication_pdp (const gchar  *str,
                                    MM3gppCgev    type,
@@ -3675,11 +3752,7 @@ mm_3gpp_parse_cgev_indication_pdp (const gchar  *str,
               type == MM_3GPP_CGEV_NW_DEACT_PDP ||
               type == MM_3GPP_CGEV_ME_DEACT_PDP);
 
-    r = g_regex_new ("(?:"
-                     "REJECT|"
-                     "NW REACT|"
-                     "NW DEACT|ME DEACT"
-                     ")\\s*([^,]*),\\s*([^,]*)(?:,\\s*([0-9]+))?", 0, 0, NULL);
+    r = mm_regex_get (CGEV_PDP_REGEX, 0, 0);
     g_assert (r);
 
     str = mm_strip_tag (str, "+CGEV:");
@@ -3734,6 +3807,12 @@ mm_3gpp_parse_cgev_indication_pdp (const gchar  *str,
  * IPv6-only context instead. We are right now ignoring this, and assuming the
  * <cid> that we requested is the one reported as connected.
  */
+#define CGEV_PRIMARY_REGEX \
+    "(?:" \
+    "NW PDN ACT|ME PDN ACT|" \
+    "NW PDN DEACT|ME PDN DEACT|" \
+    ")\\s*([0-9]+)"
+
 gboolean
 mm_3gpp_parse_cgev_indication_primary (const gchar  *str,
                                        MM3gppCgev    type,
@@ -3750,10 +3829,7 @@ mm_3gpp_parse_cgev_indication_primary (const gchar  *str,
               (type == MM_3GPP_CGEV_NW_DEACT_PRIMARY) ||
               (type == MM_3GPP_CGEV_ME_DEACT_PRIMARY));
 
-    r = g_regex_new ("(?:"
-                     "NW PDN ACT|ME PDN ACT|"
-                     "NW PDN DEACT|ME PDN DEACT|"
-                     ")\\s*([0-9]+)", 0, 0, NULL);
+    r = mm_regex_get (CGEV_PRIMARY_REGEX, 0, 0);
 
     str = mm_strip_tag (str, "+CGEV:");
     g_regex_match_full (r, str, strlen (str), 0, 0, &match_info, &inner_error);
@@ -3787,6 +3863,12 @@ out:
  * +CGEV: NW DEACT <p_cid>, <cid>, <event_type>
  * +CGEV: ME DEACT <p_cid>, <cid>, <event_type>
  */
+#define CGEV_SECONDARY_REGEX \
+    "(?:" \
+    "NW ACT|ME ACT|" \
+    "NW DEACT|ME DEACT" \
+    ")\\s*([0-9]+),\\s*([0-9]+),\\s*([0-9]+)"
+
 gboolean
 mm_3gpp_parse_cgev_indication_secondary (const gchar  *str,
                                          MM3gppCgev    type,
@@ -3807,10 +3889,7 @@ mm_3gpp_parse_cgev_indication_secondary (const gchar  *str,
               type == MM_3GPP_CGEV_NW_DEACT_SECONDARY ||
               type == MM_3GPP_CGEV_ME_DEACT_SECONDARY);
 
-    r = g_regex_new ("(?:"
-                     "NW ACT|ME ACT|"
-                     "NW DEACT|ME DEACT"
-                     ")\\s*([0-9]+),\\s*([0-9]+),\\s*([0-9]+)", 0, 0, NULL);
+    r = mm_regex_get (CGEV_SECONDARY_REGEX, 0, 0);
 
     str = mm_strip_tag (str, "+CGEV:");
     g_regex_match_full (r, str, strlen (str), 0, 0, &match_info, &inner_error);
@@ -3867,6 +3946,8 @@ mm_3gpp_pdu_info_list_free (GList *info_list)
     g_list_free_full (info_list, (GDestroyNotify)mm_3gpp_pdu_info_free);
 }
 
+#define CMGL_PDU_REGEX "\\+CMGL:\\s*(\\d+)\\s*,\\s*(\\d+)\\s*,(.*)\\r\\n([^\\r\\n]*)(\\r\\n)?"
+
 GList *
 mm_3gpp_parse_pdu_cmgl_response (const gchar *str,
                                  GError **error)
@@ -3883,8 +3964,8 @@ mm_3gpp_parse_pdu_cmgl_response (const gchar *str,
      *
      * We just read <index>, <stat> and the PDU itself.
      */
-    r = g_regex_new ("\\+CMGL:\\s*(\\d+)\\s*,\\s*(\\d+)\\s*,(.*)\\r\\n([^\\r\\n]*)(\\r\\n)?",
-                     G_REGEX_RAW | G_REGEX_OPTIMIZE, 0, NULL);
+    r = mm_regex_get (CMGL_PDU_REGEX,
+                      G_REGEX_RAW | G_REGEX_OPTIMIZE, 0);
     g_assert (r != NULL);
 
     g_regex_match_full (r, str, strlen (str), 0, 0, &match_info, &inner_error);
@@ -4640,6 +4721,8 @@ mm_cdma_parse_eri (const gchar *reply,
 
 /*************************************************************************/
 
+#define CRM_TEST_REGEX "\\+CRM:\\s*\\((\\d+)-(\\d+)\\)"
+
 gboolean
 mm_cdma_parse_crm_test_response (const gchar *reply,
                                  MMModemCdmaRmProtocol *min,
@@ -4656,9 +4739,9 @@ mm_cdma_parse_crm_test_response (const gchar *reply,
      *   <--- +CRM: (0-2)
      */
 
-    r = g_regex_new ("\\+CRM:\\s*\\((\\d+)-(\\d+)\\)",
-                     G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW,
-                     0, error);
+    r = mm_regex_get (CRM_TEST_REGEX,
+                      G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW,
+                      0);
     g_assert (r != NULL);
 
     if (g_regex_match_full (r, reply, strlen (reply), 0, 0, &match_info, &match_error)) {
@@ -4922,6 +5005,8 @@ mm_parse_gsn (const char *gsn,
 /*****************************************************************************/
 /* +CCLK response parser */
 
+#define CCLK_REGEX "\\+CCLK:\\s*\"?(\\d+)/(\\d+)/(\\d+),(\\d+):(\\d+):(\\d+)([-+]\\d+)?\"?"
+
 gboolean
 mm_parse_cclk_response (const char *response,
                         gchar **iso8601p,
@@ -4945,7 +5030,7 @@ mm_parse_cclk_response (const char *response,
      *  +CCLK: "15/03/05,14:14:26-32"
      *  +CCLK: 17/07/26,11:42:15+01
      */
-    r = g_regex_new ("\\+CCLK:\\s*\"?(\\d+)/(\\d+)/(\\d+),(\\d+):(\\d+):(\\d+)([-+]\\d+)?\"?", 0, 0, NULL);
+    r = mm_regex_get (CCLK_REGEX, 0, 0);
     g_assert (r != NULL);
 
     if (!g_regex_match_full (r, response, -1, 0, 0, &match_info, &match_error)) {
@@ -5022,6 +5107,8 @@ mm_parse_cclk_response (const char *response,
 #define MM_MIN_SIM_RETRY_HEX 0x63C0
 #define MM_MAX_SIM_RETRY_HEX 0x63CF
 
+#define CSIM_REGEX "\\+CSIM:\\s*[0-9]+,\\s*\".*([0-9a-fA-F]{4})\""
+
 gint
 mm_parse_csim_response (const gchar *response,
                               GError **error)
@@ -5033,7 +5120,7 @@ mm_parse_csim_response (const gchar *response,
     guint                  hex_code;
     GError                *inner_error = NULL;
 
-    r = g_regex_new ("\\+CSIM:\\s*[0-9]+,\\s*\".*([0-9a-fA-F]{4})\"", G_REGEX_RAW, 0, NULL);
+    r = mm_regex_get (CSIM_REGEX, G_REGEX_RAW, 0);
     g_regex_match (r, response, 0, &match_info);
 
     if (!g_match_info_matches (match_info)) {
@@ -5158,6 +5245,14 @@ out:
 
 /*****************************************************************************/
 
+#define CPOL_QUERY_REGEX \
+    "\\+CPOL:\\s*(\\d+),\\s*(\\d+),\\s*\"?(\\d+)\"?" \
+    "(?:,\\s*(\\d+))?" /* GSM_AcTn */ \
+    "(?:,\\s*(\\d+))?" /* GSM_Compact_AcTn */ \
+    "(?:,\\s*(\\d+))?" /* UTRAN_AcTn */ \
+    "(?:,\\s*(\\d+))?" /* E-UTRAN_AcTn */ \
+    "(?:,\\s*(\\d+))?" /* NG-RAN_AcTn */
+
 gboolean
 mm_sim_parse_cpol_query_response (const gchar  *response,
                                   guint        *out_index,
@@ -5177,13 +5272,7 @@ mm_sim_parse_cpol_query_response (const gchar  *response,
     guint                  act = 0;
     guint                  match_count;
 
-    r = g_regex_new ("\\+CPOL:\\s*(\\d+),\\s*(\\d+),\\s*\"?(\\d+)\"?"
-                     "(?:,\\s*(\\d+))?"     /* GSM_AcTn */
-                     "(?:,\\s*(\\d+))?"     /* GSM_Compact_AcTn */
-                     "(?:,\\s*(\\d+))?"     /* UTRAN_AcTn */
-                     "(?:,\\s*(\\d+))?"     /* E-UTRAN_AcTn */
-                     "(?:,\\s*(\\d+))?",    /* NG-RAN_AcTn */
-                     G_REGEX_RAW, 0, NULL);
+    r = mm_regex_get (CPOL_QUERY_REGEX, G_REGEX_RAW, 0);
     g_regex_match (r, response, 0, &match_info);
 
     if (!g_match_info_matches (match_info)) {
@@ -5252,6 +5341,8 @@ mm_sim_parse_cpol_query_response (const gchar  *response,
     return TRUE;
 }
 
+#define CPOL_TEST_REGEX "\\+CPOL:\\s*\\((\\d+)\\s*-\\s*(\\d+)\\)"
+
 gboolean
 mm_sim_parse_cpol_test_response (const gchar  *response,
                                  guint        *out_min_index,
@@ -5264,8 +5355,7 @@ mm_sim_parse_cpol_test_response (const gchar  *response,
     guint                  min_index;
     guint                  max_index;
 
-    r = g_regex_new ("\\+CPOL:\\s*\\((\\d+)\\s*-\\s*(\\d+)\\)",
-                     G_REGEX_RAW, 0, NULL);
+    r = mm_regex_get (CPOL_TEST_REGEX, G_REGEX_RAW, 0);
     g_regex_match (r, response, 0, &match_info);
 
     if (!g_match_info_matches (match_info)) {
@@ -5307,3 +5397,68 @@ mm_decode_eid (const gchar *eid, gsize eid_len)
 
     return mm_bcd_to_string ((const guint8 *) eid, eid_len, FALSE /* low_nybble_first */);
 }
+
+/*****************************************************************************/
+
+/* Every constant pattern used by the parsers above, with the exact same flags
+ * as in the call site; the unit tests fail if any of them is never requested
+ * or if a parser has to compile a pattern missing here. */
+static const MMRegexPattern warm_up_patterns[] = {
+    { CLCC_REGEX, G_REGEX_RAW | G_REGEX_MULTILINE | G_REGEX_NEWLINE_CRLF, G_REGEX_MATCH_NEWLINE_CRLF },
+    { IFC_TEST_REGEX, 0, 0 },
+    { WS46_TEST_REGEX, 0, 0 },
+    { COPS_TEST_REGEX, G_REGEX_UNGREEDY, 0 },
+    { COPS_TEST_PRE_UMTS_REGEX, G_REGEX_UNGREEDY, 0 },
+    { COPS_READ_REGEX, 0, 0 },
+    { CGDCONT_TEST_REGEX, G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0 },
+    { CGDCONT_READ_REGEX, G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0 },
+    { CGACT_READ_REGEX, G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0 },
+    { CMGF_TEST_REGEX, 0, 0 },
+    { CMGR_READ_REGEX, 0, 0 },
+    { CRSM_REGEX, G_REGEX_RAW, 0 },
+    { CGCONTRDP_REGEX, 0, 0 },
+    { CFUN_QUERY_REGEX, 0, 0 },
+    { CESQ_REGEX, 0, 0 },
+    { CCWA_SERVICE_QUERY_REGEX, G_REGEX_RAW | G_REGEX_MULTILINE | G_REGEX_NEWLINE_CRLF, G_REGEX_MATCH_NEWLINE_CRLF },
+    { CPMS_TEST_REGEX, 0, 0 },
+    { CPMS_QUERY_REGEX, G_REGEX_RAW, 0 },
+    { CSCS_TEST_REGEX, 0, 0 },
+    { CLCK_TEST_REGEX, 0, 0 },
+    { CLCK_WRITE_REGEX, 0, 0 },
+    { CNUM_EXEC_REGEX, G_REGEX_UNGREEDY, 0 },
+    { CIND_TEST_REGEX, G_REGEX_UNGREEDY, 0 },
+    { CIND_READ_REGEX, G_REGEX_UNGREEDY, 0 },
+    { CGEV_PDP_REGEX, 0, 0 },
+    { CGEV_PRIMARY_REGEX, 0, 0 },
+    { CGEV_SECONDARY_REGEX, 0, 0 },
+    { CMGL_PDU_REGEX, G_REGEX_RAW | G_REGEX_OPTIMIZE, 0 },
+    { CRM_TEST_REGEX, G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0 },
+    { CCLK_REGEX, 0, 0 },
+    { CSIM_REGEX, G_REGEX_RAW, 0 },
+    { CPOL_QUERY_REGEX, G_REGEX_RAW, 0 },
+    { CPOL_TEST_REGEX, G_REGEX_RAW, 0 },
+};
+
+void
+mm_modem_helpers_warm_up (void)
+{
+    static GRegex *(* const urc_regex_getters[]) (void) = {
+        mm_voice_ring_regex_get,
+        mm_voice_cring_regex_get,
+        mm_voice_clip_regex_get,
+        mm_voice_ccwa_regex_get,
+        mm_3gpp_ciev_regex_get,
+        mm_3gpp_cgev_regex_get,
+        mm_3gpp_cusd_regex_get,
+        mm_3gpp_cmti_regex_get,
+        mm_3gpp_cds_regex_get,
+    };
+    guint i;
+
+    mm_regex_warm_up (warm_up_patterns, G_N_ELEMENTS (warm_up_patterns));
+
+    for (i = 0; i < G_N_ELEMENTS (urc_regex_getters); i++)
+        g_regex_unref (urc_regex_getters[i] ());
+    mm_3gpp_creg_regex_destroy (mm_3gpp_creg_regex_get (TRUE));
+    mm_3gpp_creg_regex_destroy (mm_3gpp_creg_regex_get (FALSE));
+}
@@ -359,6 +359,10 @@ gboolean mm_3gpp_parse_crsm_response (const gchar *reply,
                                       gchar **hex,
                                       GError **error);
 
+/* Split the reply of several +CRSM commands sent in the same command line */
+GStrv mm_3gpp_split_crsm_responses (const gchar  *reply,
+                                    GError      **error);
+
 /* AT+CGCONTRDP=N response parser */
 gboolean mm_3gpp_parse_cgcontrdp_response (const gchar  *response,
                                            guint        *out_cid,
@@ -586,4 +590,10 @@ gboolean mm_sim_parse_cpol_test_response (const gchar  *response,
 /* Helper function to decode eid read from esim */
 gchar *mm_decode_eid (const gchar *eid, gsize eid_len);
 
+/*****************************************************************************/
+
+/* Compile in advance all the regular expressions used by the generic
+ * parsers and URC handlers, so that no compilation happens afterwards. */
+void mm_modem_helpers_warm_up (void);
+
 #endif  /* MM_MODEM_HELPERS_H */
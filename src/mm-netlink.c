@@ -17,6 +17,7 @@
  * Copyright (C) 2021 Aleksander Morgado <aleksander@aleksander.es>
  */
 
+#include <errno.h>
 #include <linux/netlink.h>
 #include <linux/rtnetlink.h>
 #include <net/if.h>
@@ -32,11 +33,20 @@
 #include "mm-utils.h"
 #include "mm-netlink.h"
 
+/* Initial size of the receive buffer; grown on demand when larger
+ * datagrams (e.g. the replies to a large batch) are peeked in the socket */
+#define RX_BUFFER_INITIAL_SIZE 4096
+
+/* Timeout for each netlink transaction, in seconds */
+#define TRANSACTION_TIMEOUT_SECS 5
+
 struct _MMNetlink {
     GObject parent;
     /* Netlink socket */
     GSocket *socket;
     GSource *source;
+    /* Reusable receive buffer */
+    GByteArray *rx_buffer;
     /* Netlink state */
     guint       current_sequence_id;
     GHashTable *transactions;
@@ -167,33 +177,46 @@ netlink_message_free (NetlinkMessage *msg)
 }
 
 /*****************************************************************************/
-/* Netlink transactions */
+/* Netlink transactions
+ *
+ * A transaction groups one or more request messages sent in the same
+ * datagram, each one with its own sequence id. The transaction completes
+ * once every request has been acknowledged (NLMSG_ERROR), and the result
+ * of each request is given to the caller as an errno value (0 on success).
+ */
 
 typedef struct {
     MMNetlink *self;
-    guint32    sequence_id;
+    guint32    first_sequence_id;
+    guint      n_requests;
+    guint      n_pending;
+    GArray    *errnos;
     GSource   *timeout_source;
     GTask     *completion_task;
 } Transaction;
 
-static gboolean
-transaction_timed_out (Transaction *tr)
+static void
+transaction_free (Transaction *tr)
 {
-    GTask *task;
-    guint32 sequence_id;
-
-    task = g_steal_pointer (&tr->completion_task);
-    sequence_id = tr->sequence_id;
-
-    g_hash_table_remove (tr->self->transactions,
-                         GUINT_TO_POINTER (tr->sequence_id));
+    g_assert (tr->completion_task == NULL);
+    if (tr->timeout_source) {
+        g_source_destroy (tr->timeout_source);
+        g_source_unref (tr->timeout_source);
+    }
+    g_clear_pointer (&tr->errnos, g_array_unref);
+    g_slice_free (Transaction, tr);
+}
 
-    g_task_return_new_error (task, G_IO_ERROR, G_IO_ERROR_TIMED_OUT,
-                             "Netlink message with sequence ID %u timed out",
-                             sequence_id);
+static void
+transaction_untrack (Transaction *tr)
+{
+    guint i;
 
-    g_object_unref (task);
-    return G_SOURCE_REMOVE;
+    /* requests already completed were untracked individually, so some of
+     * these sequence ids may no longer be in the table */
+    for (i = 0; i < tr->n_requests; i++)
+        g_hash_table_remove (tr->self->transactions,
+                             GUINT_TO_POINTER (tr->first_sequence_id + i));
 }
 
 static void
@@ -203,59 +226,78 @@ transaction_complete_with_error (Transaction *tr,
     GTask *task;
 
     task = g_steal_pointer (&tr->completion_task);
-
-    g_hash_table_remove (tr->self->transactions,
-                         GUINT_TO_POINTER (tr->sequence_id));
-
+    transaction_untrack (tr);
     g_task_return_error (task, error);
     g_object_unref (task);
+    transaction_free (tr);
+}
+
+static gboolean
+transaction_timed_out (Transaction *tr)
+{
+    transaction_complete_with_error (tr,
+                                     g_error_new (G_IO_ERROR, G_IO_ERROR_TIMED_OUT,
+                                                  "Netlink message with sequence ID %u timed out",
+                                                  tr->first_sequence_id + tr->n_requests - tr->n_pending));
+    return G_SOURCE_REMOVE;
 }
 
 static void
-transaction_complete (Transaction *tr,
-                      gint         saved_errno)
+transaction_complete (Transaction *tr)
 {
     GTask *task;
-    guint32 sequence_id;
 
     task = g_steal_pointer (&tr->completion_task);
-    sequence_id = tr->sequence_id;
-
-    g_hash_table_remove (tr->self->transactions,
-                         GUINT_TO_POINTER (tr->sequence_id));
-
-    if (!saved_errno) {
-        g_task_return_boolean (task, TRUE);
-    } else {
-        g_task_return_new_error (task, G_IO_ERROR, g_io_error_from_errno (saved_errno),
-                                 "Netlink message with transaction %u failed",
-                                 sequence_id);
-    }
-
+    transaction_untrack (tr);
+    g_task_return_pointer (task, g_steal_pointer (&tr->errnos), (GDestroyNotify) g_array_unref);
     g_object_unref (task);
+    transaction_free (tr);
 }
 
 static void
-transaction_free (Transaction *tr)
+transaction_request_done (Transaction *tr,
+                          guint32      sequence_id,
+                          gint         saved_errno)
 {
-    g_assert (tr->completion_task == NULL);
-    g_source_destroy (tr->timeout_source);
-    g_source_unref (tr->timeout_source);
-    g_slice_free (Transaction, tr);
+    /* stop listening for this specific request */
+    g_hash_table_remove (tr->self->transactions, GUINT_TO_POINTER (sequence_id));
+
+    g_array_index (tr->errnos, gint, sequence_id - tr->first_sequence_id) = saved_errno;
+
+    g_assert (tr->n_pending > 0);
+    if (--tr->n_pending == 0)
+        transaction_complete (tr);
 }
 
 static Transaction *
-transaction_new (MMNetlink      *self,
-                 NetlinkMessage *msg,
-                 guint           timeout,
-                 GTask          *task)
+transaction_new (MMNetlink *self,
+                 GPtrArray *msgs,
+                 guint      timeout,
+                 GTask     *task)
 {
     Transaction *tr;
+    guint        i;
 
     tr = g_slice_new0 (Transaction);
     tr->self = self;
-    tr->sequence_id = ++self->current_sequence_id;
-    netlink_message_header (msg)->msghdr.nlmsg_seq = tr->sequence_id;
+    tr->n_requests = msgs->len;
+    tr->n_pending = msgs->len;
+    tr->errnos = g_array_new (FALSE, TRUE, sizeof (gint));
+    g_array_set_size (tr->errnos, msgs->len);
+
+    /* Sequence id 0 is reserved for unsolicited notifications */
+    if ((guint32) (self->current_sequence_id + msgs->len) < self->current_sequence_id)
+        self->current_sequence_id = 0;
+    tr->first_sequence_id = self->current_sequence_id + 1;
+
+    for (i = 0; i < msgs->len; i++) {
+        guint32 sequence_id;
+
+        sequence_id = ++self->current_sequence_id;
+        netlink_message_header (g_ptr_array_index (msgs, i))->msghdr.nlmsg_seq = sequence_id;
+        g_hash_table_insert (self->transactions, GUINT_TO_POINTER (sequence_id), tr);
+    }
+
     if (timeout) {
         tr->timeout_source = g_timeout_source_new_seconds (timeout);
         g_source_set_callback (tr->timeout_source,
@@ -267,36 +309,34 @@ transaction_new (MMNetlink      *self,
     }
     tr->completion_task = g_object_ref (task);
 
-    g_hash_table_insert (self->transactions,
-                         GUINT_TO_POINTER (tr->sequence_id),
-                         tr);
     return tr;
 }
 
 /*****************************************************************************/
+/* Generic request: all messages are sent in a single datagram and the
+ * task returns the array of errno values, one per message. */
 
-gboolean
-mm_netlink_setlink_finish (MMNetlink     *self,
-                           GAsyncResult  *res,
-                           GError       **error)
+static GArray *
+netlink_request_finish (MMNetlink     *self,
+                        GAsyncResult  *res,
+                        GError       **error)
 {
-    return g_task_propagate_boolean (G_TASK (res), error);
+    return g_task_propagate_pointer (G_TASK (res), error);
 }
 
-void
-mm_netlink_setlink (MMNetlink           *self,
-                    guint                ifindex,
-                    gboolean             up,
-                    guint                mtu,
-                    GCancellable        *cancellable,
-                    GAsyncReadyCallback  callback,
-                    gpointer             user_data)
+static void
+netlink_request (MMNetlink           *self,
+                 GPtrArray           *msgs,
+                 GCancellable        *cancellable,
+                 GAsyncReadyCallback  callback,
+                 gpointer             user_data)
 {
-    GTask          *task;
-    NetlinkMessage *msg;
-    Transaction    *tr;
-    gssize          bytes_sent;
-    GError         *error = NULL;
+    GTask                *task;
+    Transaction          *tr;
+    g_autoptr(GByteArray) buffer = NULL;
+    gssize                bytes_sent;
+    guint                 i;
+    GError               *error = NULL;
 
     task = g_task_new (self, cancellable, callback, user_data);
 
@@ -307,18 +347,32 @@ mm_netlink_setlink (MMNetlink           *self,
         return;
     }
 
-    msg = netlink_message_new_setlink (ifindex, up, mtu);
-
-    /* The task ownership is transferred to the transaction. */
-    tr = transaction_new (self, msg, 5, task);
+    g_assert (msgs->len > 0);
+
+    /* The task ownership is shared with the transaction. */
+    tr = transaction_new (self, msgs, TRANSACTION_TIMEOUT_SECS, task);
+
+    /* Batch all requests in a single datagram, the kernel processes each
+     * aligned message in order and replies to each one of them. */
+    buffer = g_byte_array_new ();
+    for (i = 0; i < msgs->len; i++) {
+        NetlinkMessage *msg;
+        guint           old_len;
+        guint           pos;
+
+        msg = g_ptr_array_index (msgs, i);
+        old_len = buffer->len;
+        pos = NLMSG_ALIGN (old_len);
+        g_byte_array_set_size (buffer, pos + msg->len);
+        memset (buffer->data + old_len, 0, pos - old_len);
+        memcpy (buffer->data + pos, msg->data, msg->len);
+    }
 
     bytes_sent = g_socket_send (self->socket,
-                                (const gchar *) msg->data,
-                                msg->len,
+                                (const gchar *) buffer->data,
+                                buffer->len,
                                 cancellable,
                                 &error);
-    netlink_message_free (msg);
-
     if (bytes_sent < 0)
         transaction_complete_with_error (tr, error);
 
@@ -327,45 +381,173 @@ mm_netlink_setlink (MMNetlink           *self,
 
 /*****************************************************************************/
 
+GArray *
+mm_netlink_setlink_multiple_finish (MMNetlink     *self,
+                                    GAsyncResult  *res,
+                                    GError       **error)
+{
+    return netlink_request_finish (self, res, error);
+}
+
+void
+mm_netlink_setlink_multiple (MMNetlink                     *self,
+                             const MMNetlinkSetlinkRequest *requests,
+                             guint                          n_requests,
+                             GCancellable                  *cancellable,
+                             GAsyncReadyCallback            callback,
+                             gpointer                       user_data)
+{
+    g_autoptr(GPtrArray) msgs = NULL;
+    guint                i;
+
+    msgs = g_ptr_array_new_with_free_func ((GDestroyNotify) netlink_message_free);
+    for (i = 0; i < n_requests; i++)
+        g_ptr_array_add (msgs, netlink_message_new_setlink (requests[i].ifindex,
+                                                            requests[i].up,
+                                                            requests[i].mtu));
+
+    netlink_request (self, msgs, cancellable, callback, user_data);
+}
+
+gboolean
+mm_netlink_setlink_finish (MMNetlink     *self,
+                           GAsyncResult  *res,
+                           GError       **error)
+{
+    g_autoptr(GArray) errnos = NULL;
+    gint              saved_errno;
+
+    errnos = netlink_request_finish (self, res, error);
+    if (!errnos)
+        return FALSE;
+
+    saved_errno = g_array_index (errnos, gint, 0);
+    if (saved_errno) {
+        g_set_error (error, G_IO_ERROR, g_io_error_from_errno (saved_errno),
+                     "Netlink setlink request failed: %s", g_strerror (saved_errno));
+        return FALSE;
+    }
+    return TRUE;
+}
+
+void
+mm_netlink_setlink (MMNetlink           *self,
+                    guint                ifindex,
+                    gboolean             up,
+                    guint                mtu,
+                    GCancellable        *cancellable,
+                    GAsyncReadyCallback  callback,
+                    gpointer             user_data)
+{
+    MMNetlinkSetlinkRequest request = {
+        .ifindex = ifindex,
+        .up      = up,
+        .mtu     = mtu,
+    };
+
+    mm_netlink_setlink_multiple (self, &request, 1, cancellable, callback, user_data);
+}
+
+/*****************************************************************************/
+
+static void
+process_message (MMNetlink             *self,
+                 const struct nlmsghdr *hdr)
+{
+    Transaction *tr;
+
+    tr = g_hash_table_lookup (self->transactions,
+                              GUINT_TO_POINTER (hdr->nlmsg_seq));
+    if (!tr)
+        return;
+
+    switch (hdr->nlmsg_type) {
+    case NLMSG_ERROR: {
+        const struct nlmsgerr *err;
+
+        if (hdr->nlmsg_len < NLMSG_LENGTH (sizeof (struct nlmsgerr)))
+            return;
+        /* error is reported as a negative errno, 0 on ACK */
+        err = NLMSG_DATA (hdr);
+        transaction_request_done (tr, hdr->nlmsg_seq, -err->error);
+        return;
+    }
+    default:
+        return;
+    }
+}
+
+static gssize
+netlink_receive (MMNetlink *self,
+                 gint       fd)
+{
+    struct iovec  iov;
+    struct msghdr msg;
+    gssize        bytes;
+
+    /* Peek the size of the pending datagram first, so that the receive
+     * buffer can be grown and replies are never truncated. */
+    memset (&msg, 0, sizeof (msg));
+    memset (&iov, 0, sizeof (iov));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+
+    do {
+        bytes = recvmsg (fd, &msg, MSG_PEEK | MSG_TRUNC | MSG_DONTWAIT);
+    } while (bytes < 0 && errno == EINTR);
+    if (bytes < 0)
+        return bytes;
+
+    if ((gsize) bytes > self->rx_buffer->len)
+        g_byte_array_set_size (self->rx_buffer, bytes);
+
+    iov.iov_base = self->rx_buffer->data;
+    iov.iov_len = self->rx_buffer->len;
+    do {
+        bytes = recvmsg (fd, &msg, MSG_DONTWAIT);
+    } while (bytes < 0 && errno == EINTR);
+
+    return bytes;
+}
+
 static gboolean
 netlink_message_cb (GSocket      *socket,
                     GIOCondition  condition,
                     MMNetlink    *self)
 {
-    g_autoptr(GError) error = NULL;
-    gchar             buf[512];
-    gssize            bytes_received;
-    guint             buffer_len;
-    struct nlmsghdr  *hdr;
+    gssize           bytes_received;
+    guint            buffer_len;
+    struct nlmsghdr *hdr;
 
     if (condition & G_IO_HUP || condition & G_IO_ERR) {
         mm_obj_warn (self, "socket connection closed");
         return G_SOURCE_REMOVE;
     }
 
-    bytes_received = g_socket_receive (socket, buf, sizeof (buf), NULL, &error);
+    bytes_received = netlink_receive (self, g_socket_get_fd (socket));
     if (bytes_received < 0) {
-        mm_obj_warn (self, "socket i/o failure: %s", error->message);
+        gint saved_errno = errno;
+
+        if (saved_errno == EAGAIN || saved_errno == EWOULDBLOCK)
+            return G_SOURCE_CONTINUE;
+
+        /* ENOBUFS means the kernel dropped messages because we didn't read
+         * fast enough; not fatal, the affected transactions time out. */
+        if (saved_errno == ENOBUFS) {
+            mm_obj_dbg (self, "socket receive buffer overrun, messages lost");
+            return G_SOURCE_CONTINUE;
+        }
+
+        mm_obj_warn (self, "socket i/o failure: %s", g_strerror (saved_errno));
         return G_SOURCE_REMOVE;
     }
 
     buffer_len = (guint) bytes_received;
-    for (hdr = (struct nlmsghdr *) buf; NLMSG_OK (hdr, buffer_len);
-         NLMSG_NEXT (hdr, buffer_len)) {
-        Transaction     *tr;
-        struct nlmsgerr *err;
+    for (hdr = (struct nlmsghdr *) self->rx_buffer->data;
+         NLMSG_OK (hdr, buffer_len);
+         hdr = NLMSG_NEXT (hdr, buffer_len))
+        process_message (self, hdr);
 
-        if (hdr->nlmsg_type != NLMSG_ERROR)
-            continue;
-
-        tr = g_hash_table_lookup (self->transactions,
-                                  GUINT_TO_POINTER (hdr->nlmsg_seq));
-        if (!tr)
-            continue;
-
-        err = NLMSG_DATA (buf);
-        transaction_complete (tr, err->error);
-    }
     return G_SOURCE_CONTINUE;
 }
 
@@ -415,16 +597,15 @@ mm_netlink_init (MMNetlink *self)
 {
     g_autoptr(GError) error = NULL;
 
+    self->current_sequence_id = 0;
+    self->transactions = g_hash_table_new (g_direct_hash, g_direct_equal);
+    self->rx_buffer = g_byte_array_sized_new (RX_BUFFER_INITIAL_SIZE);
+    g_byte_array_set_size (self->rx_buffer, RX_BUFFER_INITIAL_SIZE);
+
     if (!setup_netlink_socket (self, &error)) {
         mm_obj_warn (self, "couldn't setup netlink socket: %s", error->message);
         return;
     }
-
-    self->current_sequence_id = 0;
-    self->transactions = g_hash_table_new_full (g_direct_hash,
-                                                g_direct_equal,
-                                                NULL,
-                                                (GDestroyNotify) transaction_free);
 }
 
 static void
@@ -432,9 +613,10 @@ dispose (GObject *object)
 {
     MMNetlink *self = MM_NETLINK (object);
 
-    g_assert (g_hash_table_size (self->transactions) == 0);
+    g_assert (!self->transactions || g_hash_table_size (self->transactions) == 0);
 
     g_clear_pointer (&self->transactions, g_hash_table_unref);
+    g_clear_pointer (&self->rx_buffer, g_byte_array_unref);
     if (self->source)
         g_source_destroy (self->source);
     g_clear_pointer (&self->source, g_source_unref);
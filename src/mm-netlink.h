@@ -38,6 +38,13 @@ typedef struct _MMNetlinkClass    MMNetlinkClass;
 GType      mm_netlink_get_type     (void) G_GNUC_CONST;
 MMNetlink *mm_netlink_get          (void);
 
+/* Setlink requests that are sent together in a single batch */
+typedef struct {
+    guint    ifindex;
+    gboolean up;
+    guint    mtu;
+} MMNetlinkSetlinkRequest;
+
 void     mm_netlink_setlink        (MMNetlink           *self,
                                     guint                ifindex,
                                     gboolean             up,
@@ -49,6 +56,17 @@ gboolean mm_netlink_setlink_finish (MMNetlink            *self,
                                     GAsyncResult         *res,
                                     GError              **error);
 
+void     mm_netlink_setlink_multiple        (MMNetlink                      *self,
+                                             const MMNetlinkSetlinkRequest  *requests,
+                                             guint                           n_requests,
+                                             GCancellable                   *cancellable,
+                                             GAsyncReadyCallback             callback,
+                                             gpointer                        user_data);
+/* Returns a GArray with one gint errno value per request, 0 on success */
+GArray  *mm_netlink_setlink_multiple_finish (MMNetlink                      *self,
+                                             GAsyncResult                   *res,
+                                             GError                        **error);
+
 G_END_DECLS
 
 #endif  /* MM_MODEM_HELPERS_NETLINK_H */
@@ -26,8 +26,20 @@ G_DEFINE_TYPE (MMPortNet, mm_port_net, MM_TYPE_PORT)
 
 struct _MMPortNetPrivate {
     guint ifindex;
+
+    /* Link setups, applied one after the other in the same order as
+     * requested; the first one is the ongoing one. Consecutive requests with
+     * the same settings (e.g. multiple multiplexed bearers bringing up the
+     * main interface at the same time) share the same setup. */
+    GList *link_setups;
 };
 
+typedef struct {
+    gboolean  up;
+    guint     mtu;
+    GList    *tasks;
+} LinkSetup;
+
 static void
 ensure_ifindex (MMPortNet *self)
 {
@@ -50,19 +62,139 @@ mm_port_net_link_setup_finish (MMPortNet     *self,
     return g_task_propagate_boolean (G_TASK (res), error);
 }
 
+/* Link setups of different net ports requested in the same main loop
+ * iteration (e.g. when several bearers are connected at the same time) are
+ * sent together in a single netlink batch */
+typedef struct {
+    GPtrArray *ports;
+    GArray    *requests;
+} LinkSetupBatch;
+
+static LinkSetupBatch *pending_batch;
+
+static void
+link_setup_batch_free (LinkSetupBatch *batch)
+{
+    g_ptr_array_unref (batch->ports);
+    g_array_unref (batch->requests);
+    g_slice_free (LinkSetupBatch, batch);
+}
+
+static void link_setup_batch_add (MMPortNet *self);
+
 static void
-netlink_setlink_ready (MMNetlink    *netlink,
-                       GAsyncResult *res,
-                       GTask        *task)
+link_setup_complete (MMPortNet    *self,
+                     const GError *error)
 {
-    GError *error = NULL;
-
-    if (!mm_netlink_setlink_finish (netlink, res, &error)) {
-        g_prefix_error (&error, "netlink operation failed: ");
-        g_task_return_error (task, error);
-    } else
-        g_task_return_boolean (task, TRUE);
-    g_object_unref (task);
+    LinkSetup *setup;
+    GList     *l;
+
+    g_assert (self->priv->link_setups);
+    setup = (LinkSetup *) self->priv->link_setups->data;
+    self->priv->link_setups = g_list_delete_link (self->priv->link_setups, self->priv->link_setups);
+
+    /* the interface may have been removed and re-created, so don't
+     * keep on using the cached interface index */
+    if (error)
+        self->priv->ifindex = 0;
+
+    /* Schedule the next queued setup, if any, before completing the tasks,
+     * as their callbacks may request new setups */
+    if (self->priv->link_setups) {
+        ensure_ifindex (self);
+        link_setup_batch_add (self);
+    }
+
+    for (l = setup->tasks; l; l = g_list_next (l)) {
+        GTask *task = G_TASK (l->data);
+
+        if (error)
+            g_task_return_new_error (task, error->domain, error->code,
+                                     "netlink operation failed: %s", error->message);
+        else
+            g_task_return_boolean (task, TRUE);
+        g_object_unref (task);
+    }
+    g_list_free (setup->tasks);
+    g_slice_free (LinkSetup, setup);
+
+}
+
+static void
+netlink_setlink_multiple_ready (MMNetlink      *netlink,
+                                GAsyncResult   *res,
+                                LinkSetupBatch *batch)
+{
+    g_autoptr(GError)  error = NULL;
+    g_autoptr(GArray)  errnos = NULL;
+    guint              i;
+
+    errnos = mm_netlink_setlink_multiple_finish (netlink, res, &error);
+
+    for (i = 0; i < batch->ports->len; i++) {
+        MMPortNet         *self;
+        g_autoptr(GError)  port_error = NULL;
+        gint               saved_errno;
+
+        self = MM_PORT_NET (g_ptr_array_index (batch->ports, i));
+        if (!errnos) {
+            link_setup_complete (self, error);
+            continue;
+        }
+
+        saved_errno = g_array_index (errnos, gint, i);
+        if (saved_errno)
+            port_error = g_error_new_literal (G_IO_ERROR,
+                                              g_io_error_from_errno (saved_errno),
+                                              g_strerror (saved_errno));
+        link_setup_complete (self, port_error);
+    }
+
+    link_setup_batch_free (batch);
+}
+
+static gboolean
+link_setup_batch_flush (void)
+{
+    LinkSetupBatch *batch;
+
+    batch = g_steal_pointer (&pending_batch);
+    g_assert (batch && batch->ports->len > 0);
+
+    if (batch->ports->len > 1)
+        mm_obj_dbg (g_ptr_array_index (batch->ports, 0), "batching link setup of %u net ports", batch->ports->len);
+
+    /* The netlink operation is shared, so it is not cancelled when any of
+     * the users cancels; each task is completed as cancelled on its own */
+    mm_netlink_setlink_multiple (mm_netlink_get (), /* singleton */
+                                 (const MMNetlinkSetlinkRequest *) batch->requests->data,
+                                 batch->requests->len,
+                                 NULL,
+                                 (GAsyncReadyCallback) netlink_setlink_multiple_ready,
+                                 batch);
+    return G_SOURCE_REMOVE;
+}
+
+static void
+link_setup_batch_add (MMPortNet *self)
+{
+    MMNetlinkSetlinkRequest  request;
+    LinkSetup               *setup;
+
+    setup = (LinkSetup *) self->priv->link_setups->data;
+
+    if (!pending_batch) {
+        pending_batch = g_slice_new0 (LinkSetupBatch);
+        pending_batch->ports = g_ptr_array_new_with_free_func (g_object_unref);
+        pending_batch->requests = g_array_new (FALSE, FALSE, sizeof (MMNetlinkSetlinkRequest));
+        g_idle_add ((GSourceFunc) link_setup_batch_flush, NULL);
+    }
+
+    request.ifindex = self->priv->ifindex;
+    request.up      = setup->up;
+    request.mtu     = setup->mtu;
+    g_array_append_val (pending_batch->requests, request);
+    g_ptr_array_add (pending_batch->ports, g_object_ref (self));
 }
 
 void
@@ -73,7 +205,9 @@ mm_port_net_link_setup (MMPortNet            *self,
                         GAsyncReadyCallback   callback,
                         gpointer              user_data)
 {
-    GTask *task;
+    GTask     *task;
+    GList     *last;
+    LinkSetup *setup;
 
     task = g_task_new (self, cancellable, callback, user_data);
 
@@ -86,13 +220,29 @@ mm_port_net_link_setup (MMPortNet            *self,
         return;
     }
 
-    mm_netlink_setlink (mm_netlink_get (), /* singleton */
-                        self->priv->ifindex,
-                        up,
-                        mtu,
-                        cancellable,
-                        (GAsyncReadyCallback) netlink_setlink_ready,
-                        task);
+    /* If the last requested setup has the same settings, just wait for it;
+     * joining an earlier one would apply the settings out of order */
+    last = g_list_last (self->priv->link_setups);
+    if (last &&
+        ((LinkSetup *) last->data)->up == up &&
+        ((LinkSetup *) last->data)->mtu == mtu) {
+        mm_obj_dbg (self, "same link setup already requested");
+        ((LinkSetup *) last->data)->tasks = g_list_append (((LinkSetup *) last->data)->tasks, task);
+        return;
+    }
+
+    setup = g_slice_new0 (LinkSetup);
+    setup->up = up;
+    setup->mtu = mtu;
+    setup->tasks = g_list_append (NULL, task);
+    self->priv->link_setups = g_list_append (self->priv->link_setups, setup);
+
+    /* Start it in the next batch, unless it needs to wait for a previous
+     * setup with different settings to finish */
+    if (!last)
+        link_setup_batch_add (self);
+    else
+        mm_obj_dbg (self, "link setup queued until the ongoing one finishes");
 }
 
 /*****************************************************************************/
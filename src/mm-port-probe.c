@@ -367,6 +367,15 @@ typedef struct {
     const MMPortProbeAtCommand *at_commands;
     /* Seconds between each AT command sent in the group */
     guint at_commands_wait_secs;
+    /* Time when the last AT command was sent, and when the first data
+     * was received after that (0 if none) */
+    gint64 at_command_sent_time;
+    gint64 at_first_data_time;
+    /* Timeout for the remaining AT commands in the group, if shortened
+     * based on the observed response latency (0 if not shortened) */
+    guint at_adaptive_timeout;
+    /* Reason why the data received is not considered AT, if any */
+    const gchar *at_non_at_reason;
     /* Current AT Result processor */
     void (* at_result_processor) (MMPortProbe *self,
                                   GVariant *result);
@@ -385,8 +394,15 @@ typedef struct {
     gboolean qcdm_required;
 } PortProbeRunContext;
 
+#define AT_PROBE_FLAGS (MM_PORT_PROBE_AT |          \
+                        MM_PORT_PROBE_AT_VENDOR |   \
+                        MM_PORT_PROBE_AT_PRODUCT |  \
+                        MM_PORT_PROBE_AT_ICERA |    \
+                        MM_PORT_PROBE_AT_XMM)
+
 static gboolean serial_probe_at       (MMPortProbe *self);
 static gboolean serial_probe_qcdm     (MMPortProbe *self);
+static gboolean serial_open_at        (MMPortProbe *self);
 static void     serial_probe_schedule (MMPortProbe *self);
 
 static void
@@ -904,6 +920,97 @@ is_non_at_response (const guint8 *data, gsize len)
     return FALSE;
 }
 
+/* Some ports don't talk AT, but may still talk other protocols (e.g. QCDM),
+ * so instead of aborting the whole probing, only the AT probing is stopped as
+ * soon as the first bytes received show that the data is not AT. Ports may
+ * also spew line noise (e.g. bursts of 0x00 or 0xFF while booting) before
+ * replying to AT, so only a complete NMEA sentence or QCDM frame, with a valid
+ * checksum, counts; anything else just lets the AT probing go on. */
+
+/* Enough for a full NMEA sentence (82 chars max) */
+#define NON_AT_DATA_CHECK_LEN 128
+
+static gboolean
+is_nmea_sentence (const guint8 *data, gsize len)
+{
+    gsize  i;
+    guint8 checksum = 0;
+    gint   hi;
+    gint   lo;
+
+    /* e.g. "$GPGGA," or "$GNRMC,": talker ID and sentence type */
+    if (len < 7 || data[0] != '$' || data[1] != 'G')
+        return FALSE;
+    for (i = 2; i < 6; i++) {
+        if (!g_ascii_isupper (data[i]))
+            return FALSE;
+    }
+    if (data[6] != ',')
+        return FALSE;
+
+    /* Then printable data up to the '*' and the two-digit hex checksum,
+     * which is the XOR of all chars between '$' and '*' */
+    for (i = 1; i < len && data[i] != '*'; i++) {
+        if (!g_ascii_isprint (data[i]))
+            return FALSE;
+        checksum ^= data[i];
+    }
+    if (i + 2 >= len)
+        return FALSE;
+
+    hi = g_ascii_xdigit_value (data[i + 1]);
+    lo = g_ascii_xdigit_value (data[i + 2]);
+    return (hi >= 0 && lo >= 0 && checksum == ((hi << 4) | lo));
+}
+
+static gboolean
+has_qcdm_frame (const guint8 *data, gsize len)
+{
+    gchar    buf[NON_AT_DATA_CHECK_LEN];
+    gsize    decap_len;
+    gsize    used;
+    qcdmbool more;
+
+    while (len > 0) {
+        decap_len = 0;
+        used = 0;
+        more = FALSE;
+        if (dm_decapsulate_buffer ((const gchar *) data, len, buf, sizeof (buf), &decap_len, &used, &more)) {
+            if (more)
+                return FALSE;
+            /* CRC-valid frame */
+            if (decap_len > 0)
+                return TRUE;
+        }
+        if (!used)
+            return FALSE;
+        /* Skip the invalid frame and try with the next one */
+        data += used;
+        len -= used;
+    }
+    return FALSE;
+}
+
+static const gchar *
+non_at_data_reason (const guint8 *data, gsize len)
+{
+    gsize    i;
+    gboolean line_start = TRUE;
+
+    len = MIN (len, NON_AT_DATA_CHECK_LEN);
+
+    for (i = 0; i < len; i++) {
+        if (line_start && is_nmea_sentence (&data[i], len - i))
+            return "NMEA sentence received";
+        line_start = (data[i] == '\r' || data[i] == '\n');
+    }
+
+    if (memchr (data, DIAG_CONTROL_CHAR, len) && has_qcdm_frame (data, len))
+        return "QCDM frame received";
+
+    return NULL;
+}
+
 static void
 serial_probe_at_xmm_result_processor (MMPortProbe *self,
                                       GVariant *result)
@@ -1011,6 +1118,30 @@ serial_probe_at_parse_response (MMPortSerialAt *port,
 
     response = mm_port_serial_at_command_finish (port, res, &error);
 
+    /* If the data received isn't AT, end this partial probing right away */
+    if (ctx->at_non_at_reason) {
+        mm_obj_dbg (self, "stopping AT probing: %s", ctx->at_non_at_reason);
+        ctx->at_non_at_reason = NULL;
+        ctx->at_result_processor (self, NULL);
+        serial_probe_schedule (self);
+        goto out;
+    }
+
+    /* If the port sent something back before timing out, it is alive but slow
+     * or not replying to AT; there's no need to wait the full timeout for the
+     * remaining commands, just long enough given the observed latency. */
+    if (g_error_matches (error, MM_SERIAL_ERROR, MM_SERIAL_ERROR_RESPONSE_TIMEOUT) &&
+        ctx->at_first_data_time && !ctx->at_adaptive_timeout) {
+        gint64 latency;
+
+        latency = ctx->at_first_data_time - ctx->at_command_sent_time;
+        ctx->at_adaptive_timeout = (guint) CLAMP ((4 * latency + G_USEC_PER_SEC - 1) / G_USEC_PER_SEC,
+                                                  1, ctx->at_commands->timeout);
+        mm_obj_dbg (self, "port replied in %" G_GINT64_FORMAT "ms without a valid AT response: "
+                    "timeout for the next commands set to %us",
+                    latency / 1000, ctx->at_adaptive_timeout);
+    }
+
     if (!ctx->at_commands->response_processor (ctx->at_commands->command,
                                                response,
                                                !!ctx->at_commands[1].command,
@@ -1085,10 +1216,14 @@ serial_probe_at (MMPortProbe *self)
         return G_SOURCE_REMOVE;
     }
 
+    ctx->at_command_sent_time = g_get_monotonic_time ();
+    ctx->at_first_data_time = 0;
+
     mm_port_serial_at_command (
         MM_PORT_SERIAL_AT (ctx->serial),
         ctx->at_commands->command,
-        ctx->at_commands->timeout,
+        ((ctx->at_adaptive_timeout && ctx->at_adaptive_timeout < ctx->at_commands->timeout) ?
+         ctx->at_adaptive_timeout : ctx->at_commands->timeout),
         FALSE,
         FALSE,
         ctx->at_probing_cancellable,
@@ -1168,6 +1303,19 @@ serial_probe_schedule (MMPortProbe *self)
     if (port_probe_task_return_error_if_cancelled (self))
         return;
 
+    /* If QCDM was probed first and AT probing is still pending, the port
+     * needs to be reopened as AT */
+    if (ctx->serial &&
+        !MM_IS_PORT_SERIAL_AT (ctx->serial) &&
+        (ctx->flags & AT_PROBE_FLAGS & ~self->priv->flags) &&
+        !g_cancellable_is_cancelled (ctx->at_probing_cancellable)) {
+        if (mm_port_serial_is_open (ctx->serial))
+            mm_port_serial_close (ctx->serial);
+        g_clear_object (&ctx->serial);
+        ctx->source_id = g_idle_add ((GSourceFunc) serial_open_at, self);
+        return;
+    }
+
     /* If we got some custom initialization setup requested, go on with it
      * first. We completely ignore the custom initialization if the serial port
      * that we receive in the context isn't an AT port (e.g. if it was flagged
@@ -1188,6 +1336,7 @@ serial_probe_schedule (MMPortProbe *self)
     ctx->at_result_processor   = NULL;
     ctx->at_commands           = NULL;
     ctx->at_commands_wait_secs = 0;
+    ctx->at_adaptive_timeout   = 0;
 
     /* AT check requested and not already probed? */
     if ((ctx->flags & MM_PORT_PROBE_AT) &&
@@ -1285,6 +1434,10 @@ serial_parser_filter_cb (gpointer   filter,
                          GString   *response,
                          GError   **error)
 {
+    MMPortProbe         *self = MM_PORT_PROBE (user_data);
+    PortProbeRunContext *ctx;
+    const gchar         *reason;
+
     if (is_non_at_response ((const guint8 *) response->str, response->len)) {
         g_set_error (error,
                      MM_SERIAL_ERROR,
@@ -1293,9 +1446,36 @@ serial_parser_filter_cb (gpointer   filter,
         return FALSE;
     }
 
+    if (!self->priv->task)
+        return TRUE;
+    ctx = g_task_get_task_data (self->priv->task);
+
+    if (!ctx->at_first_data_time)
+        ctx->at_first_data_time = g_get_monotonic_time ();
+
+    /* Only while probing whether the port is AT */
+    if (ctx->at_result_processor != serial_probe_at_result_processor)
+        return TRUE;
+
+    reason = non_at_data_reason ((const guint8 *) response->str, response->len);
+    if (reason) {
+        ctx->at_non_at_reason = reason;
+        g_set_error (error,
+                     MM_SERIAL_ERROR,
+                     MM_SERIAL_ERROR_PARSE_FAILED,
+                     "Not an AT response: %s", reason);
+        return FALSE;
+    }
+
     return TRUE;
 }
 
+/* Open retries back off from 100ms up to 1s; with 7 tries the port is given
+ * 4.5s overall (100+200+400+800+1000+1000+1000ms), so slow devices get at
+ * least the 4s they always had with the fixed 1s delay */
+#define SERIAL_OPEN_AT_MAX_TRIES         7
+#define SERIAL_OPEN_AT_MAX_RETRY_TIME_MS 1000
+
 static gboolean
 serial_open_at (MMPortProbe *self)
 {
@@ -1345,7 +1525,7 @@ serial_open_at (MMPortProbe *self)
         parser = mm_serial_parser_v1_new ();
         mm_serial_parser_v1_add_filter (parser,
                                         serial_parser_filter_cb,
-                                        NULL);
+                                        self);
         mm_port_serial_at_set_response_parser (MM_PORT_SERIAL_AT (ctx->serial),
                                                mm_serial_parser_v1_parse,
                                                parser,
@@ -1355,21 +1535,24 @@ serial_open_at (MMPortProbe *self)
     /* Try to open the port */
     if (!mm_port_serial_open (ctx->serial, &error)) {
         /* Abort if maximum number of open tries reached */
-        if (++ctx->at_open_tries > 4) {
+        if (++ctx->at_open_tries > SERIAL_OPEN_AT_MAX_TRIES) {
             /* took too long to open the port; give up */
             port_probe_task_return_error (self,
                                           g_error_new (MM_CORE_ERROR,
                                                        MM_CORE_ERROR_FAILED,
-                                                       "(%s/%s) failed to open port after 4 tries",
+                                                       "(%s/%s) failed to open port after %u tries",
                                                        mm_kernel_device_get_subsystem (self->priv->port),
-                                                       mm_kernel_device_get_name (self->priv->port)));
+                                                       mm_kernel_device_get_name (self->priv->port),
+                                                       SERIAL_OPEN_AT_MAX_TRIES));
             g_clear_error (&error);
             return G_SOURCE_REMOVE;
         }
 
         if (g_error_matches (error, MM_SERIAL_ERROR, MM_SERIAL_ERROR_OPEN_FAILED_NO_DEVICE)) {
-            /* this is nozomi being dumb; try again */
-            ctx->source_id = g_timeout_add_seconds (1, (GSourceFunc) serial_open_at, self);
+            /* this is nozomi being dumb; try again, backing off from 100ms */
+            ctx->source_id = g_timeout_add (MIN (50 << ctx->at_open_tries, SERIAL_OPEN_AT_MAX_RETRY_TIME_MS),
+                                            (GSourceFunc) serial_open_at,
+                                            self);
             g_clear_error (&error);
             return G_SOURCE_REMOVE;
         }
@@ -1435,6 +1618,21 @@ mm_port_probe_run_finish (MMPortProbe   *self,
     return g_task_propagate_boolean (G_TASK (result), error);
 }
 
+/* Qualcomm-based devices expose their DIAG interface as vendor-specific
+ * class/subclass with protocol 0x30 */
+#define QUALCOMM_DIAG_INTERFACE_PROTOCOL 0x30
+
+static gboolean
+port_probe_is_likely_qcdm (MMPortProbe *self)
+{
+    if (!g_str_equal (mm_kernel_device_get_subsystem (self->priv->port), "tty"))
+        return FALSE;
+
+    return (mm_kernel_device_get_interface_class (self->priv->port) == 0xFF &&
+            mm_kernel_device_get_interface_subclass (self->priv->port) == 0xFF &&
+            mm_kernel_device_get_interface_protocol (self->priv->port) == QUALCOMM_DIAG_INTERFACE_PROTOCOL);
+}
+
 void
 mm_port_probe_run (MMPortProbe                *self,
                    MMPortProbeFlag             flags,
@@ -1553,11 +1751,7 @@ mm_port_probe_run (MMPortProbe                *self,
     g_free (probe_list_str);
 
     /* If any AT probing is needed, start by opening as AT port */
-    if (ctx->flags & MM_PORT_PROBE_AT ||
-        ctx->flags & MM_PORT_PROBE_AT_VENDOR ||
-        ctx->flags & MM_PORT_PROBE_AT_PRODUCT ||
-        ctx->flags & MM_PORT_PROBE_AT_ICERA ||
-        ctx->flags & MM_PORT_PROBE_AT_XMM) {
+    if (ctx->flags & AT_PROBE_FLAGS) {
         ctx->at_probing_cancellable = g_cancellable_new ();
         /* If the main cancellable is cancelled, so will be the at-probing one */
         if (cancellable)
@@ -1565,6 +1759,16 @@ mm_port_probe_run (MMPortProbe                *self,
                                                                         (GCallback) at_cancellable_cancel,
                                                                         ctx,
                                                                         NULL);
+
+        /* AT and QCDM can't be probed at the same time in the same TTY, so if
+         * the port looks like a QCDM port, probe QCDM first; if it succeeds,
+         * the whole AT probing sequence is skipped. */
+        if ((ctx->flags & MM_PORT_PROBE_QCDM) && ctx->qcdm_required && port_probe_is_likely_qcdm (self)) {
+            mm_obj_dbg (self, "port looks like a QCDM port, probing QCDM first");
+            ctx->source_id = g_idle_add ((GSourceFunc) serial_probe_qcdm, self);
+            return;
+        }
+
         ctx->source_id = g_idle_add ((GSourceFunc) serial_open_at, self);
         return;
     }
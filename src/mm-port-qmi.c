@@ -54,10 +54,20 @@ typedef struct {
     guint       flag;
 } ServiceInfo;
 
+/* Pool of clients allocated in advance for a given service, handed out
+ * when a new client for that service is requested */
+typedef struct {
+    QmiService  service;
+    guint       size;
+    guint       n_pending;
+    GList      *clients;
+} ClientPool;
+
 struct _MMPortQmiPrivate {
     gboolean   in_progress;
     QmiDevice *qmi_device;
     GList     *services;
+    GList     *client_pools;
     gchar     *net_driver;
     gchar     *net_sysfs_path;
 #if defined WITH_QRTR
@@ -259,6 +269,181 @@ mm_port_qmi_release_client (MMPortQmi     *self,
     g_object_unref (client);
 }
 
+/*****************************************************************************/
+/* Client pools */
+
+static ClientPool *
+lookup_client_pool (MMPortQmi  *self,
+                    QmiService  service)
+{
+    GList *l;
+
+    for (l = self->priv->client_pools; l; l = g_list_next (l)) {
+        ClientPool *pool = l->data;
+
+        if (pool->service == service)
+            return pool;
+    }
+    return NULL;
+}
+
+static void
+client_pool_release_clients (ClientPool *pool,
+                             QmiDevice  *qmi_device)
+{
+    GList *l;
+
+    for (l = pool->clients; l; l = g_list_next (l)) {
+        if (qmi_device)
+            qmi_device_release_client (qmi_device,
+                                       QMI_CLIENT (l->data),
+                                       QMI_DEVICE_RELEASE_CLIENT_FLAGS_RELEASE_CID,
+                                       3, NULL, NULL, NULL);
+        g_object_unref (l->data);
+    }
+    g_clear_pointer (&pool->clients, g_list_free);
+}
+
+static void
+client_pool_free (ClientPool *pool)
+{
+    client_pool_release_clients (pool, NULL);
+    g_slice_free (ClientPool, pool);
+}
+
+typedef struct {
+    MMPortQmi  *self;
+    QmiDevice  *qmi_device;
+    QmiService  service;
+} ClientPoolFillContext;
+
+static void
+client_pool_fill_context_free (ClientPoolFillContext *ctx)
+{
+    g_object_unref (ctx->qmi_device);
+    g_object_unref (ctx->self);
+    g_slice_free (ClientPoolFillContext, ctx);
+}
+
+static void client_pool_fill (MMPortQmi  *self,
+                              ClientPool *pool);
+
+static void
+client_pool_allocate_client_ready (QmiDevice             *qmi_device,
+                                   GAsyncResult          *res,
+                                   ClientPoolFillContext *ctx)
+{
+    MMPortQmi         *self = ctx->self;
+    ClientPool        *pool;
+    QmiClient         *client;
+    g_autoptr(GError)  error = NULL;
+
+    client = qmi_device_allocate_client_finish (qmi_device, res, &error);
+
+    pool = lookup_client_pool (self, ctx->service);
+    if (pool) {
+        g_assert (pool->n_pending > 0);
+        pool->n_pending--;
+    }
+
+    if (!client) {
+        /* The pool is refilled on the next miss */
+        mm_obj_dbg (self, "couldn't allocate pooled client for service '%s': %s",
+                    qmi_service_get_string (ctx->service), error->message);
+        client_pool_fill_context_free (ctx);
+        return;
+    }
+
+    /* The port may have been closed (or even reopened) in the meantime; the
+     * CID was allocated in the device the request was sent to, so release it
+     * there, and top up the pool in the current device if there's any */
+    if (!pool || (self->priv->qmi_device != ctx->qmi_device)) {
+        qmi_device_release_client (ctx->qmi_device,
+                                   client,
+                                   QMI_DEVICE_RELEASE_CLIENT_FLAGS_RELEASE_CID,
+                                   3, NULL, NULL, NULL);
+        g_object_unref (client);
+        if (pool)
+            client_pool_fill (self, pool);
+        client_pool_fill_context_free (ctx);
+        return;
+    }
+
+    pool->clients = g_list_append (pool->clients, client);
+    client_pool_fill_context_free (ctx);
+}
+
+static void
+client_pool_fill (MMPortQmi  *self,
+                  ClientPool *pool)
+{
+    if (!self->priv->qmi_device)
+        return;
+
+    while ((g_list_length (pool->clients) + pool->n_pending) < pool->size) {
+        ClientPoolFillContext *ctx;
+
+        ctx = g_slice_new0 (ClientPoolFillContext);
+        ctx->self = g_object_ref (self);
+        ctx->qmi_device = g_object_ref (self->priv->qmi_device);
+        ctx->service = pool->service;
+
+        pool->n_pending++;
+        qmi_device_allocate_client (self->priv->qmi_device,
+                                    pool->service,
+                                    QMI_CID_NONE,
+                                    10,
+                                    NULL,
+                                    (GAsyncReadyCallback)client_pool_allocate_client_ready,
+                                    ctx);
+    }
+}
+
+void
+mm_port_qmi_setup_client_pool (MMPortQmi  *self,
+                               QmiService  service,
+                               guint       size)
+{
+    ClientPool *pool;
+
+    pool = lookup_client_pool (self, service);
+    if (!pool) {
+        pool = g_slice_new0 (ClientPool);
+        pool->service = service;
+        self->priv->client_pools = g_list_prepend (self->priv->client_pools, pool);
+    }
+
+    mm_obj_dbg (self, "setting up pool of %u clients for service '%s'", size, qmi_service_get_string (service));
+    pool->size = size;
+    client_pool_fill (self, pool);
+}
+
+static QmiClient *
+client_pool_take (MMPortQmi  *self,
+                  QmiService  service)
+{
+    ClientPool *pool;
+    QmiClient  *client;
+
+    pool = lookup_client_pool (self, service);
+    if (!pool)
+        return NULL;
+
+    /* On a miss, e.g. if a previous allocation failed, request new clients
+     * so that they're available next time */
+    if (!pool->clients) {
+        client_pool_fill (self, pool);
+        return NULL;
+    }
+
+    client = QMI_CLIENT (pool->clients->data);
+    pool->clients = g_list_delete_link (pool->clients, pool->clients);
+
+    /* Replace the one we just took, in the background */
+    client_pool_fill (self, pool);
+    return client;
+}
+
 /*****************************************************************************/
 
 typedef struct {
@@ -344,6 +529,17 @@ mm_port_qmi_allocate_client (MMPortQmi           *self,
     ctx->info->flag = flag;
     g_task_set_task_data (task, ctx, (GDestroyNotify)allocate_client_context_free);
 
+    /* Use a client from the pool if there's any available, so that no
+     * additional request to the CTL service is needed */
+    ctx->info->client = client_pool_take (self, service);
+    if (ctx->info->client) {
+        mm_obj_dbg (self, "using pooled client for service '%s'", qmi_service_get_string (service));
+        self->priv->services = g_list_prepend (self->priv->services, g_steal_pointer (&ctx->info));
+        g_task_return_boolean (task, TRUE);
+        g_object_unref (task);
+        return;
+    }
+
     qmi_device_allocate_client (self->priv->qmi_device,
                                 service,
                                 QMI_CID_NONE,
@@ -2364,6 +2560,7 @@ port_open_step (GTask *task)
 {
     MMPortQmi       *self;
     PortOpenContext *ctx;
+    GList           *l;
 
     self = g_task_get_source_object (task);
     ctx = g_task_get_task_data (task);
@@ -2541,6 +2738,10 @@ port_open_step (GTask *task)
         self->priv->qmi_device = g_object_ref (ctx->device);
         setup_monitoring (self, ctx->device);
         self->priv->in_progress = FALSE;
+
+        /* Refill the client pools emptied when the port was last closed */
+        for (l = self->priv->client_pools; l; l = g_list_next (l))
+            client_pool_fill (self, (ClientPool *) l->data);
         g_task_return_boolean (task, TRUE);
         g_object_unref (task);
         return;
@@ -2696,6 +2897,10 @@ mm_port_qmi_close (MMPortQmi           *self,
     g_list_free_full (self->priv->services, g_free);
     self->priv->services = NULL;
 
+    /* Release all pooled clients; pools are refilled once reopened */
+    for (l = self->priv->client_pools; l; l = g_list_next (l))
+        client_pool_release_clients ((ClientPool *) l->data, ctx->qmi_device);
+
     /* Cleanup preallocated links, if any */
     if (self->priv->preallocated_links) {
         delete_preallocated_links (ctx->qmi_device, self->priv->preallocated_links);
@@ -2800,6 +3005,10 @@ dispose (GObject *object)
     g_list_free_full (self->priv->services, g_free);
     self->priv->services = NULL;
 
+    /* Deallocate all pooled clients */
+    g_list_free_full (self->priv->client_pools, (GDestroyNotify)client_pool_free);
+    self->priv->client_pools = NULL;
+
     /* Cleanup preallocated links, if any */
     if (self->priv->preallocated_links && self->priv->qmi_device)
         delete_preallocated_links (self->priv->qmi_device, self->priv->preallocated_links);
@@ -114,6 +114,13 @@ void     mm_port_qmi_release_client         (MMPortQmi  *self,
                                              QmiService  service,
                                              guint       flag);
 
+/* Keep the given amount of clients of the given service allocated in
+ * advance, so that mm_port_qmi_allocate_client() doesn't need to wait for
+ * the CTL service to allocate new ones. */
+void     mm_port_qmi_setup_client_pool      (MMPortQmi  *self,
+                                             QmiService  service,
+                                             guint       size);
+
 QmiClient *mm_port_qmi_peek_client (MMPortQmi  *self,
                                     QmiService  service,
                                     guint       flag);
@@ -27,120 +27,84 @@
 #include "libqcdm/src/utils.h"
 #include "libqcdm/src/errors.h"
 #include "libqcdm/src/dm-commands.h"
+#include "libqcdm/src/commands.h"
+#include "libqcdm/src/logs.h"
 #include "mm-log-object.h"
 
 G_DEFINE_TYPE (MMPortSerialQcdm, mm_port_serial_qcdm, MM_TYPE_PORT_SERIAL)
 
 struct _MMPortSerialQcdmPrivate {
     GSList *unsolicited_msg_handlers;
+
+    /* Incremental frame decoder, and the last decoded frame (or error) until
+     * it's processed as a log item or as a command response */
+    DmFrameDecoder            decoder;
+    MMPortSerialResponseType  pending;
+    const guint8             *frame;
+    gsize                     frame_len;
+    GByteArray               *log_buffer;
+
+    /* Log item subscriptions */
+    GPtrArray *log_subscriptions;
+    guint      log_subscription_id;
+    gboolean   log_dispatching;
+    /* Equipment IDs configured with a non-empty log mask */
+    guint16    log_mask_equip_ids;
 };
 
 /*****************************************************************************/
 
-static gboolean
-find_qcdm_start (GByteArray *response, gsize *start)
-{
-    guint i;
-    gint  last = -1;
-
-    /* Look for 3 bytes and a QCDM frame marker, ie enough data for a valid
-     * frame.  There will usually be three cases here; (1) a QCDM frame
-     * starting with data and terminated by 0x7E, and (2) a QCDM frame starting
-     * with 0x7E and ending with 0x7E, and (3) a non-QCDM frame that still
-     * uses HDLC framing (like Sierra CnS) that starts and ends with 0x7E.
-     */
-    for (i = 0; i < response->len; i++) {
-        /* Marker found */
-        if (response->data[i] == 0x7E) {
-            /* If we didn't get an initial marker, count at least 3 bytes since
-             * origin; if we did get an initial marker, count at least 3 bytes
-             * since the marker.
-             */
-            if (((last == -1) && (i >= 3)) || ((last >= 0) && (i > (guint)(last + 3)))) {
-                /* Got a full QCDM frame; 3 non-0x7E bytes and a terminator */
-                if (start)
-                    *start = last + 1;
-                return TRUE;
-            }
-
-            /* Save position of the last QCDM frame marker */
-            last = i;
-        }
-    }
-    return FALSE;
-}
+/* Maximum length of an unescaped QCDM frame, including its CRC */
+#define QCDM_MAX_FRAME_LEN 1024
 
 static MMPortSerialResponseType
-parse_qcdm (GByteArray *response,
-            gboolean want_log,
-            GByteArray **parsed_response,
-            GError **error)
-{
-    gsize start = 0;
-    gsize used = 0;
-    gsize unescaped_len = 0;
-    guint8 *unescaped_buffer;
-    qcdmbool more = FALSE;
-
-    /* Get the offset into the buffer of where the QCDM frame starts */
-    if (!find_qcdm_start (response, &start)) {
-        /* Discard the unparsable data right away, we do need a QCDM
-         * start, and anything that comes before it is unknown data
-         * that we'll never use. */
-        return MM_PORT_SERIAL_RESPONSE_NONE;
-    }
-
-    /* If there is anything before the start marker, remove it */
-    g_byte_array_remove_range (response, 0, start);
-    if (response->len == 0)
-        return MM_PORT_SERIAL_RESPONSE_NONE;
-
-    /* Try to decapsulate the response into a buffer */
-    unescaped_buffer = g_malloc (1024);
-    if (!dm_decapsulate_buffer ((const char *)(response->data),
-                                response->len,
-                                (char *)unescaped_buffer,
-                                1024,
-                                &unescaped_len,
-                                &used,
-                                &more)) {
-        /* Report an error right away. Not being able to decapsulate a QCDM
-         * packet once we got message start marker likely means that this
-         * data that we got is not a QCDM message. */
-        g_set_error (error,
-                     MM_SERIAL_ERROR,
-                     MM_SERIAL_ERROR_PARSE_FAILED,
-                     "Failed to unescape QCDM packet");
-        g_free (unescaped_buffer);
-        return MM_PORT_SERIAL_RESPONSE_ERROR;
-    }
-
-    if (more) {
-        /* Need more data, we leave the original byte array untouched so that
-         * we can retry later when more data arrives. */
-        g_free (unescaped_buffer);
-        return MM_PORT_SERIAL_RESPONSE_NONE;
-    }
+decode_frame (MMPortSerialQcdm *self,
+              GByteArray       *response)
+{
+    DmFrameDecoderStatus  status;
+    const char           *frame = NULL;
+    size_t                frame_len = 0;
+    size_t                used = 0;
+
+    /* Nothing else is decoded until the last frame has been processed */
+    if (self->priv->pending != MM_PORT_SERIAL_RESPONSE_NONE || !response->len)
+        return self->priv->pending;
+
+    /* The decoder keeps the unescaping and CRC state of partial frames, so
+     * all the data fed can be removed from the response buffer right away
+     * and is never decoded twice. Any data that isn't part of a QCDM frame
+     * is discarded by the decoder once the next frame marker is found. */
+    status = dm_frame_decoder_feed (&self->priv->decoder,
+                                    (const char *) response->data,
+                                    response->len,
+                                    &used,
+                                    &frame,
+                                    &frame_len);
+    g_byte_array_remove_range (response, 0, used);
 
-    if (want_log && unescaped_buffer[0] != DIAG_CMD_LOG) {
-        /* If we only want log items and this isn't one, don't remove this
-         * DM packet from the buffer.
-         */
-        g_free (unescaped_buffer);
-        return MM_PORT_SERIAL_RESPONSE_NONE;
+    switch (status) {
+    case DM_FRAME_DECODER_STATUS_FRAME:
+        self->priv->frame = (const guint8 *) frame;
+        self->priv->frame_len = frame_len;
+        self->priv->pending = MM_PORT_SERIAL_RESPONSE_BUFFER;
+        break;
+    case DM_FRAME_DECODER_STATUS_ERROR:
+        self->priv->pending = MM_PORT_SERIAL_RESPONSE_ERROR;
+        break;
+    case DM_FRAME_DECODER_STATUS_NEED_MORE:
+    default:
+        break;
     }
 
-    /* Successfully decapsulated the DM command. We'll build a new byte array
-     * with the response, and leave the input buffer cleaned up. */
-    g_assert (unescaped_len <= 1024);
-    unescaped_buffer = g_realloc (unescaped_buffer, unescaped_len);
-    *parsed_response = g_byte_array_new_take (unescaped_buffer, unescaped_len);
+    return self->priv->pending;
+}
 
-    /* Remove the data we used from the input buffer, leaving out any
-     * additional data that may already been received (e.g. from the following
-     * message). */
-    g_byte_array_remove_range (response, 0, used);
-    return MM_PORT_SERIAL_RESPONSE_BUFFER;
+static void
+frame_processed (MMPortSerialQcdm *self)
+{
+    self->priv->pending = MM_PORT_SERIAL_RESPONSE_NONE;
+    self->priv->frame = NULL;
+    self->priv->frame_len = 0;
 }
 
 static MMPortSerialResponseType
@@ -149,7 +113,31 @@ parse_response (MMPortSerial *port,
                 GByteArray **parsed_response,
                 GError **error)
 {
-    return parse_qcdm (response, FALSE, parsed_response, error);
+    MMPortSerialQcdm         *self = MM_PORT_SERIAL_QCDM (port);
+    MMPortSerialResponseType  type;
+
+    type = decode_frame (self, response);
+    switch (type) {
+    case MM_PORT_SERIAL_RESPONSE_BUFFER:
+        /* Build a new byte array with just the decapsulated frame */
+        *parsed_response = g_byte_array_sized_new (self->priv->frame_len);
+        g_byte_array_append (*parsed_response, self->priv->frame, self->priv->frame_len);
+        break;
+    case MM_PORT_SERIAL_RESPONSE_ERROR:
+        /* Not being able to decapsulate a QCDM packet once we got a message
+         * start marker likely means that this data is not a QCDM message. */
+        g_set_error (error,
+                     MM_SERIAL_ERROR,
+                     MM_SERIAL_ERROR_PARSE_FAILED,
+                     "Failed to unescape QCDM packet");
+        break;
+    case MM_PORT_SERIAL_RESPONSE_NONE:
+    default:
+        return type;
+    }
+
+    frame_processed (self);
+    return type;
 }
 
 /*****************************************************************************/
@@ -296,39 +284,404 @@ mm_port_serial_qcdm_enable_unsolicited_msg_handler (MMPortSerialQcdm *self,
     }
 }
 
+/*****************************************************************************/
+
+typedef struct {
+    guint                      id;
+    guint16                   *log_codes;
+    guint                      n_log_codes;
+    MMPortSerialQcdmLogItemFn  callback;
+    gpointer                   user_data;
+    GDestroyNotify             notify;
+    guint64                    delivered;
+    guint64                    dropped;
+    gboolean                   removed;
+} LogSubscription;
+
 static void
-parse_unsolicited (MMPortSerial *port, GByteArray *response)
+log_subscription_free (LogSubscription *subscription)
 {
-    MMPortSerialQcdm *self = MM_PORT_SERIAL_QCDM (port);
-    GByteArray *log_buffer = NULL;
-    GSList *iter;
+    if (subscription->notify)
+        subscription->notify (subscription->user_data);
+    g_free (subscription->log_codes);
+    g_slice_free (LogSubscription, subscription);
+}
+
+static gboolean
+log_subscription_matches (LogSubscription *subscription,
+                          guint16          log_code)
+{
+    guint i;
+
+    for (i = 0; i < subscription->n_log_codes; i++) {
+        if (subscription->log_codes[i] == log_code)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+static LogSubscription *
+find_log_subscription (MMPortSerialQcdm *self,
+                       guint             subscription_id)
+{
+    guint i;
+
+    for (i = 0; i < self->priv->log_subscriptions->len; i++) {
+        LogSubscription *subscription;
+
+        subscription = g_ptr_array_index (self->priv->log_subscriptions, i);
+        if (subscription->id == subscription_id && !subscription->removed)
+            return subscription;
+    }
+    return NULL;
+}
+
+guint
+mm_port_serial_qcdm_add_log_subscription (MMPortSerialQcdm          *self,
+                                          const guint16             *log_codes,
+                                          guint                      n_log_codes,
+                                          MMPortSerialQcdmLogItemFn  callback,
+                                          gpointer                   user_data,
+                                          GDestroyNotify             notify)
+{
+    LogSubscription *subscription;
+
+    g_return_val_if_fail (MM_IS_PORT_SERIAL_QCDM (self), 0);
+    g_return_val_if_fail (log_codes != NULL && n_log_codes > 0, 0);
+    g_return_val_if_fail (callback != NULL, 0);
+
+    subscription = g_slice_new0 (LogSubscription);
+    subscription->id = ++self->priv->log_subscription_id;
+    subscription->log_codes = g_new (guint16, n_log_codes);
+    memcpy (subscription->log_codes, log_codes, n_log_codes * sizeof (guint16));
+    subscription->n_log_codes = n_log_codes;
+    subscription->callback = callback;
+    subscription->user_data = user_data;
+    subscription->notify = notify;
+    g_ptr_array_add (self->priv->log_subscriptions, subscription);
+
+    mm_obj_dbg (self, "added log subscription %u (%u log codes)", subscription->id, n_log_codes);
+    return subscription->id;
+}
+
+void
+mm_port_serial_qcdm_remove_log_subscription (MMPortSerialQcdm *self,
+                                             guint             subscription_id)
+{
+    LogSubscription *subscription;
 
-    if (parse_qcdm (response,
-                    TRUE,
-                    &log_buffer,
-                    NULL) != MM_PORT_SERIAL_RESPONSE_BUFFER) {
+    g_return_if_fail (MM_IS_PORT_SERIAL_QCDM (self));
+
+    subscription = find_log_subscription (self, subscription_id);
+    if (!subscription)
+        return;
+
+    mm_obj_dbg (self, "removed log subscription %u (%" G_GUINT64_FORMAT " delivered, %" G_GUINT64_FORMAT " dropped)",
+                subscription->id, subscription->delivered, subscription->dropped);
+
+    /* Subscriptions may be removed from within their own callback, so while
+     * dispatching they're only flagged, and purged once dispatching is over */
+    if (self->priv->log_dispatching) {
+        subscription->removed = TRUE;
         return;
     }
+    g_ptr_array_remove (self->priv->log_subscriptions, subscription);
+}
 
-    /* These should be guaranteed by parse_qcdm() */
-    g_return_if_fail (log_buffer);
-    g_return_if_fail (log_buffer->len > 0);
-    g_return_if_fail (log_buffer->data[0] == DIAG_CMD_LOG);
+guint64
+mm_port_serial_qcdm_get_log_subscription_dropped (MMPortSerialQcdm *self,
+                                                  guint             subscription_id)
+{
+    LogSubscription *subscription;
+
+    g_return_val_if_fail (MM_IS_PORT_SERIAL_QCDM (self), 0);
+
+    subscription = find_log_subscription (self, subscription_id);
+    return subscription ? subscription->dropped : 0;
+}
 
-    if (log_buffer->len < sizeof (DMCmdLog))
+static void
+dispatch_log_subscriptions (MMPortSerialQcdm              *self,
+                            const MMPortSerialQcdmLogItem *item)
+{
+    guint i;
+
+    if (!self->priv->log_subscriptions->len)
         return;
 
+    self->priv->log_dispatching = TRUE;
+    for (i = 0; i < self->priv->log_subscriptions->len; i++) {
+        LogSubscription *subscription;
+
+        subscription = g_ptr_array_index (self->priv->log_subscriptions, i);
+        if (subscription->removed || !log_subscription_matches (subscription, item->log_code))
+            continue;
+
+        if (subscription->callback (self, item, subscription->user_data))
+            subscription->delivered++;
+        else if (subscription->dropped++ == 0)
+            mm_obj_dbg (self, "log subscription %u is falling behind: dropping log items", subscription->id);
+    }
+    self->priv->log_dispatching = FALSE;
+
+    for (i = self->priv->log_subscriptions->len; i > 0; i--) {
+        LogSubscription *subscription;
+
+        subscription = g_ptr_array_index (self->priv->log_subscriptions, i - 1);
+        if (subscription->removed)
+            g_ptr_array_remove_index (self->priv->log_subscriptions, i - 1);
+    }
+}
+
+static void
+dispatch_unsolicited_msg_handlers (MMPortSerialQcdm *self,
+                                   guint16           log_code)
+{
+    GSList   *iter;
+    gboolean  log_buffer_ready = FALSE;
+
     for (iter = self->priv->unsolicited_msg_handlers; iter; iter = iter->next) {
         MMQcdmUnsolicitedMsgHandler *handler = (MMQcdmUnsolicitedMsgHandler *) iter->data;
-        DMCmdLog *log_cmd = (DMCmdLog *) log_buffer->data;
 
-        if (!handler->enable)
+        if (!handler->enable || !handler->callback)
+            continue;
+        if (handler->log_code != log_code)
+            continue;
+
+        /* The log buffer given to the handlers is reused for every item */
+        if (!log_buffer_ready) {
+            g_byte_array_set_size (self->priv->log_buffer, 0);
+            g_byte_array_append (self->priv->log_buffer, self->priv->frame, self->priv->frame_len);
+            log_buffer_ready = TRUE;
+        }
+        handler->callback (self, self->priv->log_buffer, handler->user_data);
+    }
+}
+
+static void
+parse_unsolicited (MMPortSerial *port, GByteArray *response)
+{
+    MMPortSerialQcdm *self = MM_PORT_SERIAL_QCDM (port);
+
+    /* Process all the log items available; the first frame that isn't a log
+     * item is left pending, to be processed as a command response */
+    while (decode_frame (self, response) == MM_PORT_SERIAL_RESPONSE_BUFFER) {
+        MMPortSerialQcdmLogItem  item;
+        const char              *payload = NULL;
+        size_t                   payload_len = 0;
+
+        if (self->priv->frame[0] != DIAG_CMD_LOG)
+            break;
+
+        if (self->priv->frame_len >= sizeof (DMCmdLog)) {
+            /* Subscribers get the log item as a view into the decoder buffer */
+            if (qcdm_log_item_parse_header ((const char *) self->priv->frame,
+                                            self->priv->frame_len,
+                                            &item.log_code,
+                                            &item.timestamp,
+                                            &payload,
+                                            &payload_len) == QCDM_SUCCESS) {
+                item.frame = self->priv->frame;
+                item.frame_len = self->priv->frame_len;
+                item.payload = (const guint8 *) payload;
+                item.payload_len = payload_len;
+                dispatch_log_subscriptions (self, &item);
+            }
+
+            dispatch_unsolicited_msg_handlers (self, le16toh (((const DMCmdLog *) self->priv->frame)->log_code));
+        }
+
+        frame_processed (self);
+    }
+}
+
+/*****************************************************************************/
+/* Log mask update */
+
+/* Large enough for a full 4095-item log mask, even if fully escaped */
+#define LOG_CONFIG_COMMAND_MAX_LEN (2 * QCDM_MAX_FRAME_LEN)
+
+#define LOG_CODE_EQUIP_ID(log_code) (((log_code) >> 12) & 0x0F)
+
+typedef struct {
+    guint16 equip_ids;
+    guint   current;
+    GArray *items;
+} UpdateLogMaskContext;
+
+static void
+update_log_mask_context_free (UpdateLogMaskContext *ctx)
+{
+    if (ctx->items)
+        g_array_unref (ctx->items);
+    g_slice_free (UpdateLogMaskContext, ctx);
+}
+
+static void
+collect_log_codes (MMPortSerialQcdm *self,
+                   gint              equip_id,
+                   GArray           *items,
+                   guint16          *equip_ids)
+{
+    GSList *l;
+    guint   i, j;
+
+    for (i = 0; i < self->priv->log_subscriptions->len; i++) {
+        LogSubscription *subscription;
+
+        subscription = g_ptr_array_index (self->priv->log_subscriptions, i);
+        if (subscription->removed)
             continue;
-        if (handler->log_code != le16toh (log_cmd->log_code))
+        for (j = 0; j < subscription->n_log_codes; j++) {
+            if (equip_ids)
+                *equip_ids |= 1 << LOG_CODE_EQUIP_ID (subscription->log_codes[j]);
+            if (items && LOG_CODE_EQUIP_ID (subscription->log_codes[j]) == equip_id)
+                g_array_append_val (items, subscription->log_codes[j]);
+        }
+    }
+
+    for (l = self->priv->unsolicited_msg_handlers; l; l = g_slist_next (l)) {
+        MMQcdmUnsolicitedMsgHandler *handler = (MMQcdmUnsolicitedMsgHandler *) l->data;
+        guint16                      log_code;
+
+        if (!handler->enable || !handler->callback)
             continue;
-        if (handler->callback)
-            handler->callback (self, log_buffer, handler->user_data);
+        log_code = (guint16) handler->log_code;
+        if (equip_ids)
+            *equip_ids |= 1 << LOG_CODE_EQUIP_ID (log_code);
+        if (items && LOG_CODE_EQUIP_ID (log_code) == equip_id)
+            g_array_append_val (items, log_code);
+    }
+}
+
+gboolean
+mm_port_serial_qcdm_update_log_mask_finish (MMPortSerialQcdm  *self,
+                                            GAsyncResult      *res,
+                                            GError           **error)
+{
+    return g_task_propagate_boolean (G_TASK (res), error);
+}
+
+static void update_log_mask_next (GTask *task);
+
+static void
+log_config_set_mask_ready (MMPortSerialQcdm *self,
+                           GAsyncResult     *res,
+                           GTask            *task)
+{
+    UpdateLogMaskContext *ctx;
+    QcdmResult           *result;
+    GByteArray           *response;
+    GError               *error = NULL;
+    gint                  err = QCDM_SUCCESS;
+
+    ctx = g_task_get_task_data (task);
+
+    response = mm_port_serial_qcdm_command_finish (self, res, &error);
+    if (!response) {
+        g_task_return_error (task, error);
+        g_object_unref (task);
+        return;
     }
+
+    result = qcdm_cmd_log_config_set_mask_result ((const gchar *) response->data,
+                                                  response->len,
+                                                  &err);
+    g_byte_array_unref (response);
+    if (!result) {
+        g_task_return_new_error (task,
+                                 MM_CORE_ERROR,
+                                 MM_CORE_ERROR_FAILED,
+                                 "Failed to parse Log Config Set Mask command result: %d",
+                                 err);
+        g_object_unref (task);
+        return;
+    }
+    qcdm_result_unref (result);
+
+    if (ctx->items->len)
+        self->priv->log_mask_equip_ids |= 1 << ctx->current;
+    else
+        self->priv->log_mask_equip_ids &= ~(1 << ctx->current);
+
+    ctx->current++;
+    update_log_mask_next (task);
+}
+
+static void
+update_log_mask_next (GTask *task)
+{
+    MMPortSerialQcdm     *self;
+    UpdateLogMaskContext *ctx;
+    GByteArray           *logcmd;
+
+    self = g_task_get_source_object (task);
+    ctx = g_task_get_task_data (task);
+
+    while (ctx->current < 16 && !(ctx->equip_ids & (1 << ctx->current)))
+        ctx->current++;
+
+    if (ctx->current >= 16) {
+        g_task_return_boolean (task, TRUE);
+        g_object_unref (task);
+        return;
+    }
+
+    /* The items list given to libqcdm is zero-terminated */
+    g_array_set_size (ctx->items, 0);
+    collect_log_codes (self, ctx->current, ctx->items, NULL);
+
+    mm_obj_dbg (self, "setting log mask for equipment ID %u (%u log codes)", ctx->current, ctx->items->len);
+
+    logcmd = g_byte_array_sized_new (LOG_CONFIG_COMMAND_MAX_LEN);
+    logcmd->len = qcdm_cmd_log_config_set_mask_new ((char *) logcmd->data,
+                                                    LOG_CONFIG_COMMAND_MAX_LEN,
+                                                    ctx->current,
+                                                    ctx->items->len ? (uint16_t *) ctx->items->data : NULL);
+    if (!logcmd->len) {
+        g_byte_array_unref (logcmd);
+        g_task_return_new_error (task,
+                                 MM_CORE_ERROR,
+                                 MM_CORE_ERROR_FAILED,
+                                 "Failed to build Log Config Set Mask command for equipment ID %u",
+                                 ctx->current);
+        g_object_unref (task);
+        return;
+    }
+
+    mm_port_serial_qcdm_command (self,
+                                 logcmd,
+                                 5,
+                                 g_task_get_cancellable (task),
+                                 (GAsyncReadyCallback)log_config_set_mask_ready,
+                                 task);
+    g_byte_array_unref (logcmd);
+}
+
+void
+mm_port_serial_qcdm_update_log_mask (MMPortSerialQcdm    *self,
+                                     GCancellable        *cancellable,
+                                     GAsyncReadyCallback  callback,
+                                     gpointer             user_data)
+{
+    UpdateLogMaskContext *ctx;
+    GTask                *task;
+    guint16               equip_ids = 0;
+
+    g_return_if_fail (MM_IS_PORT_SERIAL_QCDM (self));
+
+    task = g_task_new (self, cancellable, callback, user_data);
+
+    /* Configure every equipment ID with log codes requested, and also clear
+     * the ones that were configured before but aren't needed any more */
+    collect_log_codes (self, -1, NULL, &equip_ids);
+
+    ctx = g_slice_new0 (UpdateLogMaskContext);
+    ctx->equip_ids = equip_ids | self->priv->log_mask_equip_ids;
+    ctx->items = g_array_new (TRUE, TRUE, sizeof (guint16));
+    g_task_set_task_data (task, ctx, (GDestroyNotify) update_log_mask_context_free);
+
+    update_log_mask_next (task);
 }
 
 /*****************************************************************************/
@@ -344,9 +697,22 @@ config_fd (MMPortSerial *port, int fd, GError **error)
                      "Failed to open QCDM port: %d", err);
         return FALSE;
     }
+
+    /* Don't mix partial frames received before the port was (re)opened */
+    dm_frame_decoder_reset (&MM_PORT_SERIAL_QCDM (port)->priv->decoder);
+    frame_processed (MM_PORT_SERIAL_QCDM (port));
     return TRUE;
 }
 
+static void
+response_discarded (MMPortSerial *port)
+{
+    /* The partial frame kept by the decoder was built from data the port just
+     * dropped, so don't let it merge with whatever is received next. An
+     * already decoded frame is still valid and stays pending. */
+    dm_frame_decoder_reset (&MM_PORT_SERIAL_QCDM (port)->priv->decoder);
+}
+
 /*****************************************************************************/
 
 MMPortSerialQcdm *
@@ -383,6 +749,11 @@ static void
 mm_port_serial_qcdm_init (MMPortSerialQcdm *self)
 {
     self->priv = G_TYPE_INSTANCE_GET_PRIVATE (self, MM_TYPE_PORT_SERIAL_QCDM, MMPortSerialQcdmPrivate);
+
+    dm_frame_decoder_init (&self->priv->decoder, QCDM_MAX_FRAME_LEN);
+    self->priv->pending = MM_PORT_SERIAL_RESPONSE_NONE;
+    self->priv->log_buffer = g_byte_array_sized_new (QCDM_MAX_FRAME_LEN);
+    self->priv->log_subscriptions = g_ptr_array_new_with_free_func ((GDestroyNotify) log_subscription_free);
 }
 
 static void
@@ -401,6 +772,10 @@ finalize (GObject *object)
                                                                     self->priv->unsolicited_msg_handlers);
     }
 
+    dm_frame_decoder_clear (&self->priv->decoder);
+    g_byte_array_unref (self->priv->log_buffer);
+    g_ptr_array_unref (self->priv->log_subscriptions);
+
     G_OBJECT_CLASS (mm_port_serial_qcdm_parent_class)->finalize (object);
 }
 
@@ -417,5 +792,6 @@ mm_port_serial_qcdm_class_init (MMPortSerialQcdmClass *klass)
     port_class->parse_unsolicited = parse_unsolicited;
     port_class->parse_response = parse_response;
     port_class->config_fd = config_fd;
+    port_class->response_discarded = response_discarded;
     port_class->debug_log = debug_log;
 }
@@ -73,4 +73,47 @@ void     mm_port_serial_qcdm_enable_unsolicited_msg_handler (MMPortSerialQcdm *s
                                                              guint log_code,
                                                              gboolean enable);
 
+/* Log item subscriptions.
+ *
+ * Subscribers get every log item matching any of the log codes given, as a
+ * view into the port's frame buffer; the contents are only valid during the
+ * callback. A subscriber that cannot handle an item (e.g. because its own
+ * queue is full) returns FALSE, and the item is accounted as dropped.
+ */
+
+typedef struct {
+    guint16       log_code;
+    guint64       timestamp;
+    const guint8 *frame;       /* full log item, including the log header */
+    gsize         frame_len;
+    const guint8 *payload;     /* log item data, after the log header */
+    gsize         payload_len;
+} MMPortSerialQcdmLogItem;
+
+typedef gboolean (*MMPortSerialQcdmLogItemFn) (MMPortSerialQcdm              *port,
+                                               const MMPortSerialQcdmLogItem *item,
+                                               gpointer                       user_data);
+
+guint    mm_port_serial_qcdm_add_log_subscription         (MMPortSerialQcdm          *self,
+                                                           const guint16             *log_codes,
+                                                           guint                      n_log_codes,
+                                                           MMPortSerialQcdmLogItemFn  callback,
+                                                           gpointer                   user_data,
+                                                           GDestroyNotify             notify);
+void     mm_port_serial_qcdm_remove_log_subscription      (MMPortSerialQcdm          *self,
+                                                           guint                      subscription_id);
+guint64  mm_port_serial_qcdm_get_log_subscription_dropped (MMPortSerialQcdm          *self,
+                                                           guint                      subscription_id);
+
+/* Configures the log mask in the device so that it includes all the log codes
+ * with subscriptions or enabled unsolicited message handlers, and nothing
+ * else. The port must be open. */
+void     mm_port_serial_qcdm_update_log_mask        (MMPortSerialQcdm     *self,
+                                                     GCancellable         *cancellable,
+                                                     GAsyncReadyCallback   callback,
+                                                     gpointer              user_data);
+gboolean mm_port_serial_qcdm_update_log_mask_finish (MMPortSerialQcdm     *self,
+                                                     GAsyncResult         *res,
+                                                     GError              **error);
+
 #endif /* MM_PORT_SERIAL_QCDM_H */
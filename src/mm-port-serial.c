@@ -940,6 +940,16 @@ parse_response_buffer (MMPortSerial *self)
     }
 }
 
+static void
+port_serial_discard_response (MMPortSerial *self,
+                              guint         len)
+{
+    if (len)
+        g_byte_array_remove_range (self->priv->response, 0, len);
+    if (MM_PORT_SERIAL_GET_CLASS (self)->response_discarded)
+        MM_PORT_SERIAL_GET_CLASS (self)->response_discarded (self);
+}
+
 static gboolean
 common_input_available (MMPortSerial *self,
                         GIOCondition condition)
@@ -954,15 +964,13 @@ common_input_available (MMPortSerial *self,
 
     if (condition & G_IO_HUP) {
         mm_obj_dbg (self, "unexpected port hangup!");
-        if (self->priv->response->len)
-            g_byte_array_remove_range (self->priv->response, 0, self->priv->response->len);
+        port_serial_discard_response (self, self->priv->response->len);
         port_serial_close_force (self);
         return G_SOURCE_REMOVE;
     }
 
     if (condition & G_IO_ERR) {
-        if (self->priv->response->len)
-            g_byte_array_remove_range (self->priv->response, 0, self->priv->response->len);
+        port_serial_discard_response (self, self->priv->response->len);
         return G_SOURCE_CONTINUE;
     }
 
@@ -1027,7 +1035,7 @@ common_input_available (MMPortSerial *self,
             if ((self->priv->response->len > SERIAL_BUF_SIZE) && self->priv->spew_control) {
                 /* Notify listeners and then trim the buffer */
                 g_signal_emit (self, signals[BUFFER_FULL], 0, self->priv->response);
-                g_byte_array_remove_range (self->priv->response, 0, (SERIAL_BUF_SIZE / 2));
+                port_serial_discard_response (self, SERIAL_BUF_SIZE / 2);
             }
 
             parse_response_buffer (self);
@@ -95,6 +95,11 @@ struct _MMPortSerialClass {
      * should get ignored. */
     void (*config)                (MMPortSerial *self);
 
+    /* Called whenever received data is dropped from the response buffer
+     * without being parsed, so that subclasses can also drop any parser state
+     * built from data already consumed. */
+    void (*response_discarded)    (MMPortSerial *self);
+
     void (*debug_log)             (MMPortSerial *self,
                                    const gchar  *prefix,
                                    const gchar  *buf,
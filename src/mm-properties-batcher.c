@@ -0,0 +1,426 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details:
+ *
+ * Copyright (C) 2026 The ModemManager authors
+ */
+
+#include <config.h>
+
+#include <ModemManager.h>
+
+#include "mm-log-object.h"
+#include "mm-utils.h"
+#include "mm-properties-batcher.h"
+
+/*
+ * The batcher runs as a filter in the D-Bus connection of the daemon. While
+ * batching is enabled, the PropertiesChanged signals emitted by the modem and
+ * bearer objects are not sent right away; the changes are merged per object
+ * and interface, and emitted periodically in a single signal per interface.
+ * The property values in the skeletons and the GObject notifications are
+ * not affected, so in-daemon users see every update right away.
+ *
+ * Changes in the modem State and in the bearer Connected properties are not
+ * delayed; the signal reporting them includes all the changes queued for the
+ * same interface. Changes queued for interfaces that are removed from the
+ * bus are discarded.
+ *
+ * The connection filter runs in the GDBus worker thread, so the queued
+ * changes are protected by a mutex.
+ */
+
+#define DBUS_INTERFACE_PROPERTIES     "org.freedesktop.DBus.Properties"
+#define DBUS_INTERFACE_OBJECT_MANAGER "org.freedesktop.DBus.ObjectManager"
+
+typedef struct {
+    gchar      *path;
+    gchar      *interface;
+    /* Changed property values, keyed by property name */
+    GHashTable *changed;
+    /* Invalidated property names */
+    GHashTable *invalidated;
+} PendingChanges;
+
+struct _MMPropertiesBatcher {
+    GObject          parent;
+    GMutex           mutex;
+    GDBusConnection *connection;
+    guint            filter_id;
+    guint            interval_ms;
+    guint            timeout_id;
+    /* Pending changes, keyed by "path interface" */
+    GHashTable      *pending;
+    /* Signals emitted by the batcher itself, not owned */
+    GHashTable      *flushed;
+};
+
+struct _MMPropertiesBatcherClass {
+    GObjectClass parent;
+};
+
+static void log_object_iface_init (MMLogObjectInterface *iface);
+
+G_DEFINE_TYPE_EXTENDED (MMPropertiesBatcher, mm_properties_batcher, G_TYPE_OBJECT, 0,
+                        G_IMPLEMENT_INTERFACE (MM_TYPE_LOG_OBJECT, log_object_iface_init))
+
+/*****************************************************************************/
+
+static void
+pending_changes_free (PendingChanges *changes)
+{
+    g_free (changes->path);
+    g_free (changes->interface);
+    g_hash_table_unref (changes->changed);
+    g_hash_table_unref (changes->invalidated);
+    g_slice_free (PendingChanges, changes);
+}
+
+static PendingChanges *
+pending_changes_new (const gchar *path,
+                     const gchar *interface)
+{
+    PendingChanges *changes;
+
+    changes = g_slice_new0 (PendingChanges);
+    changes->path = g_strdup (path);
+    changes->interface = g_strdup (interface);
+    changes->changed = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, (GDestroyNotify) g_variant_unref);
+    changes->invalidated = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+    return changes;
+}
+
+static void
+pending_changes_merge (PendingChanges *changes,
+                       GVariant       *changed,
+                       GVariant       *invalidated)
+{
+    GVariantIter  iter;
+    const gchar  *name;
+    GVariant     *value;
+
+    g_variant_iter_init (&iter, changed);
+    while (g_variant_iter_next (&iter, "{&sv}", &name, &value)) {
+        g_hash_table_remove (changes->invalidated, name);
+        g_hash_table_insert (changes->changed, g_strdup (name), value);
+    }
+
+    g_variant_iter_init (&iter, invalidated);
+    while (g_variant_iter_next (&iter, "&s", &name)) {
+        g_hash_table_remove (changes->changed, name);
+        g_hash_table_add (changes->invalidated, g_strdup (name));
+    }
+}
+
+static GVariant *
+pending_changes_build_body (PendingChanges *changes)
+{
+    GVariantBuilder changed;
+    GVariantBuilder invalidated;
+    GHashTableIter  iter;
+    gpointer        key;
+    gpointer        value;
+
+    g_variant_builder_init (&changed, G_VARIANT_TYPE ("a{sv}"));
+    g_hash_table_iter_init (&iter, changes->changed);
+    while (g_hash_table_iter_next (&iter, &key, &value))
+        g_variant_builder_add (&changed, "{sv}", (const gchar *) key, (GVariant *) value);
+
+    g_variant_builder_init (&invalidated, G_VARIANT_TYPE ("as"));
+    g_hash_table_iter_init (&iter, changes->invalidated);
+    while (g_hash_table_iter_next (&iter, &key, NULL))
+        g_variant_builder_add (&invalidated, "s", (const gchar *) key);
+
+    return g_variant_new ("(sa{sv}as)", changes->interface, &changed, &invalidated);
+}
+
+/*****************************************************************************/
+
+static gboolean
+is_batched_path (const gchar *path)
+{
+    return (path &&
+            (g_str_has_prefix (path, MM_DBUS_MODEM_PREFIX "/") ||
+             g_str_has_prefix (path, MM_DBUS_BEARER_PREFIX "/")));
+}
+
+static gboolean
+is_urgent_change (const gchar *interface,
+                  GVariant    *changed)
+{
+    g_autoptr(GVariant) value = NULL;
+
+    if (!g_strcmp0 (interface, MM_DBUS_INTERFACE_MODEM))
+        value = g_variant_lookup_value (changed, "State", NULL);
+    else if (!g_strcmp0 (interface, MM_DBUS_INTERFACE_BEARER))
+        value = g_variant_lookup_value (changed, "Connected", NULL);
+    return !!value;
+}
+
+/* Called with the mutex locked */
+static GDBusMessage *
+queue_properties_changed (MMPropertiesBatcher *self,
+                          GDBusMessage        *message)
+{
+    GVariant            *body;
+    const gchar         *interface;
+    g_autoptr(GVariant)  changed = NULL;
+    g_autoptr(GVariant)  invalidated = NULL;
+    g_autofree gchar    *key = NULL;
+    PendingChanges      *changes;
+    GDBusMessage        *merged;
+
+    body = g_dbus_message_get_body (message);
+    if (!body || !g_variant_is_of_type (body, G_VARIANT_TYPE ("(sa{sv}as)")))
+        return message;
+
+    g_variant_get (body, "(&s@a{sv}@as)", &interface, &changed, &invalidated);
+
+    key = g_strdup_printf ("%s %s", g_dbus_message_get_path (message), interface);
+    changes = g_hash_table_lookup (self->pending, key);
+
+    if (!is_urgent_change (interface, changed)) {
+        if (!changes) {
+            changes = pending_changes_new (g_dbus_message_get_path (message), interface);
+            g_hash_table_insert (self->pending, g_steal_pointer (&key), changes);
+        }
+        pending_changes_merge (changes, changed, invalidated);
+        g_object_unref (message);
+        return NULL;
+    }
+
+    /* Urgent changes are sent right away, along with the queued ones */
+    if (!changes)
+        return message;
+
+    pending_changes_merge (changes, changed, invalidated);
+    merged = g_dbus_message_copy (message, NULL);
+    if (!merged)
+        return message;
+    g_dbus_message_set_body (merged, pending_changes_build_body (changes));
+    g_hash_table_remove (self->pending, key);
+    g_object_unref (message);
+    return merged;
+}
+
+/* Called with the mutex locked */
+static void
+discard_interfaces_removed (MMPropertiesBatcher *self,
+                            GDBusMessage        *message)
+{
+    GVariant     *body;
+    const gchar  *path;
+    GVariantIter *iter;
+    const gchar  *interface;
+
+    body = g_dbus_message_get_body (message);
+    if (!body || !g_variant_is_of_type (body, G_VARIANT_TYPE ("(oas)")))
+        return;
+
+    g_variant_get (body, "(&oas)", &path, &iter);
+    while (g_variant_iter_next (iter, "&s", &interface)) {
+        g_autofree gchar *key = NULL;
+
+        key = g_strdup_printf ("%s %s", path, interface);
+        g_hash_table_remove (self->pending, key);
+    }
+    g_variant_iter_free (iter);
+}
+
+static GDBusMessage *
+connection_filter (GDBusConnection     *connection,
+                   GDBusMessage        *message,
+                   gboolean             incoming,
+                   MMPropertiesBatcher *self)
+{
+    const gchar *interface;
+    const gchar *member;
+
+    if (incoming || g_dbus_message_get_message_type (message) != G_DBUS_MESSAGE_TYPE_SIGNAL)
+        return message;
+
+    interface = g_dbus_message_get_interface (message);
+    member = g_dbus_message_get_member (message);
+
+    g_mutex_lock (&self->mutex);
+    if (g_hash_table_remove (self->flushed, message))
+        ; /* emitted by ourselves */
+    else if (!g_strcmp0 (interface, DBUS_INTERFACE_OBJECT_MANAGER) &&
+             !g_strcmp0 (member, "InterfacesRemoved"))
+        discard_interfaces_removed (self, message);
+    else if (self->interval_ms &&
+             !g_strcmp0 (interface, DBUS_INTERFACE_PROPERTIES) &&
+             !g_strcmp0 (member, "PropertiesChanged") &&
+             is_batched_path (g_dbus_message_get_path (message)))
+        message = queue_properties_changed (self, message);
+    g_mutex_unlock (&self->mutex);
+
+    return message;
+}
+
+/*****************************************************************************/
+
+static void
+flush_pending (MMPropertiesBatcher *self)
+{
+    g_autoptr(GHashTable) pending = NULL;
+    GHashTableIter        iter;
+    PendingChanges       *changes;
+
+    g_mutex_lock (&self->mutex);
+    pending = self->pending;
+    self->pending = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, (GDestroyNotify) pending_changes_free);
+    g_mutex_unlock (&self->mutex);
+
+    g_hash_table_iter_init (&iter, pending);
+    while (g_hash_table_iter_next (&iter, NULL, (gpointer *)&changes)) {
+        g_autoptr(GDBusMessage) message = NULL;
+        g_autoptr(GError)       error = NULL;
+
+        message = g_dbus_message_new_signal (changes->path, DBUS_INTERFACE_PROPERTIES, "PropertiesChanged");
+        g_dbus_message_set_body (message, pending_changes_build_body (changes));
+
+        g_mutex_lock (&self->mutex);
+        g_hash_table_add (self->flushed, message);
+        g_mutex_unlock (&self->mutex);
+
+        if (!g_dbus_connection_send_message (self->connection, message, G_DBUS_SEND_MESSAGE_FLAGS_NONE, NULL, &error)) {
+            mm_obj_dbg (self, "couldn't emit properties changed in %s: %s", changes->path, error->message);
+            g_mutex_lock (&self->mutex);
+            g_hash_table_remove (self->flushed, message);
+            g_mutex_unlock (&self->mutex);
+        }
+    }
+}
+
+static gboolean
+flush_cb (MMPropertiesBatcher *self)
+{
+    flush_pending (self);
+    return G_SOURCE_CONTINUE;
+}
+
+void
+mm_properties_batcher_monitor_connection (MMPropertiesBatcher *self,
+                                          GDBusConnection     *connection)
+{
+    g_assert (!self->connection);
+
+    self->connection = g_object_ref (connection);
+    self->filter_id = g_dbus_connection_add_filter (connection,
+                                                    (GDBusMessageFilterFunction) connection_filter,
+                                                    self,
+                                                    NULL);
+}
+
+/*****************************************************************************/
+
+guint
+mm_properties_batcher_get_interval (MMPropertiesBatcher *self)
+{
+    return self->interval_ms;
+}
+
+void
+mm_properties_batcher_set_interval (MMPropertiesBatcher *self,
+                                    guint                interval_ms)
+{
+    interval_ms = MIN (interval_ms, MM_PROPERTIES_BATCHER_INTERVAL_MAX);
+    if (interval_ms == self->interval_ms)
+        return;
+
+    if (self->timeout_id) {
+        g_source_remove (self->timeout_id);
+        self->timeout_id = 0;
+    }
+
+    if (!interval_ms)
+        mm_obj_msg (self, "properties changed batching disabled");
+    else
+        mm_obj_msg (self, "properties changed batching enabled: %u ms interval", interval_ms);
+
+    g_mutex_lock (&self->mutex);
+    self->interval_ms = interval_ms;
+    g_mutex_unlock (&self->mutex);
+
+    /* Flush whatever was pending with the previous settings */
+    if (self->connection)
+        flush_pending (self);
+
+    if (self->interval_ms)
+        self->timeout_id = g_timeout_add (self->interval_ms, (GSourceFunc) flush_cb, self);
+}
+
+/*****************************************************************************/
+
+static gchar *
+log_object_build_id (MMLogObject *_self)
+{
+    return g_strdup ("properties-batcher");
+}
+
+/*****************************************************************************/
+
+static void
+mm_properties_batcher_init (MMPropertiesBatcher *self)
+{
+    g_mutex_init (&self->mutex);
+    self->pending = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, (GDestroyNotify) pending_changes_free);
+    self->flushed = g_hash_table_new (g_direct_hash, g_direct_equal);
+}
+
+static void
+dispose (GObject *object)
+{
+    MMPropertiesBatcher *self = MM_PROPERTIES_BATCHER (object);
+
+    if (self->timeout_id) {
+        g_source_remove (self->timeout_id);
+        self->timeout_id = 0;
+    }
+
+    if (self->connection) {
+        g_dbus_connection_remove_filter (self->connection, self->filter_id);
+        self->filter_id = 0;
+        g_clear_object (&self->connection);
+    }
+
+    G_OBJECT_CLASS (mm_properties_batcher_parent_class)->dispose (object);
+}
+
+static void
+finalize (GObject *object)
+{
+    MMPropertiesBatcher *self = MM_PROPERTIES_BATCHER (object);
+
+    g_hash_table_unref (self->flushed);
+    g_hash_table_unref (self->pending);
+    g_mutex_clear (&self->mutex);
+
+    G_OBJECT_CLASS (mm_properties_batcher_parent_class)->finalize (object);
+}
+
+static void
+log_object_iface_init (MMLogObjectInterface *iface)
+{
+    iface->build_id = log_object_build_id;
+}
+
+static void
+mm_properties_batcher_class_init (MMPropertiesBatcherClass *klass)
+{
+    GObjectClass *object_class = G_OBJECT_CLASS (klass);
+
+    object_class->dispose  = dispose;
+    object_class->finalize = finalize;
+}
+
+MM_DEFINE_SINGLETON_GETTER (MMPropertiesBatcher, mm_properties_batcher_get, MM_TYPE_PROPERTIES_BATCHER);
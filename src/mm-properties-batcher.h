@@ -0,0 +1,53 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details:
+ *
+ * Copyright (C) 2026 The ModemManager authors
+ */
+
+#ifndef MM_PROPERTIES_BATCHER_H
+#define MM_PROPERTIES_BATCHER_H
+
+#include <glib-object.h>
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+#define MM_TYPE_PROPERTIES_BATCHER         (mm_properties_batcher_get_type ())
+#define MM_PROPERTIES_BATCHER(o)           (G_TYPE_CHECK_INSTANCE_CAST ((o), MM_TYPE_PROPERTIES_BATCHER, MMPropertiesBatcher))
+#define MM_PROPERTIES_BATCHER_CLASS(k)     (G_TYPE_CHECK_CLASS_CAST ((k), MM_TYPE_PROPERTIES_BATCHER, MMPropertiesBatcherClass))
+#define MM_PROPERTIES_BATCHER_GET_CLASS(o) (G_TYPE_INSTANCE_GET_CLASS ((o), MM_TYPE_PROPERTIES_BATCHER, MMPropertiesBatcherClass))
+#define MM_IS_PROPERTIES_BATCHER(o)        (G_TYPE_CHECK_INSTANCE_TYPE ((o), MM_TYPE_PROPERTIES_BATCHER))
+#define MM_IS_PROPERTIES_BATCHER_CLASS(k)  (G_TYPE_CHECK_CLASS_TYPE ((k), MM_TYPE_PROPERTIES_BATCHER))
+
+/* Upper limit for the batching interval, in milliseconds */
+#define MM_PROPERTIES_BATCHER_INTERVAL_MAX 60000
+
+typedef struct _MMPropertiesBatcher      MMPropertiesBatcher;
+typedef struct _MMPropertiesBatcherClass MMPropertiesBatcherClass;
+
+GType                mm_properties_batcher_get_type (void) G_GNUC_CONST;
+MMPropertiesBatcher *mm_properties_batcher_get      (void);
+
+/* Start batching the PropertiesChanged signals of the modem and bearer
+ * objects emitted in the given connection. */
+void  mm_properties_batcher_monitor_connection (MMPropertiesBatcher *self,
+                                                GDBusConnection     *connection);
+
+/* An interval of 0 disables batching, so that each property update is
+ * notified in its own PropertiesChanged signal (default behavior). */
+void  mm_properties_batcher_set_interval       (MMPropertiesBatcher *self,
+                                                guint                interval_ms);
+guint mm_properties_batcher_get_interval       (MMPropertiesBatcher *self);
+
+G_END_DECLS
+
+#endif /* MM_PROPERTIES_BATCHER_H */
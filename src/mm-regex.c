@@ -0,0 +1,144 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details:
+ *
+ * Copyright (C) 2026 The ModemManager authors
+ */
+
+#include <config.h>
+
+#include "mm-regex.h"
+
+/* The registry is never cleaned up, the number of different patterns is
+ * bounded by the ones hardcoded in the sources. */
+static GMutex      registry_mutex;
+static GHashTable *registry;
+static guint       n_compilations;
+
+typedef struct {
+    gchar    *pattern;
+    GRegex   *regex;
+    /* Whether the pattern has been requested through mm_regex_get(), as
+     * opposed to just being compiled in advance by mm_regex_warm_up() */
+    gboolean  requested;
+} RegistryEntry;
+
+static void
+registry_entry_free (RegistryEntry *entry)
+{
+    g_regex_unref (entry->regex);
+    g_free (entry->pattern);
+    g_slice_free (RegistryEntry, entry);
+}
+
+static gchar *
+build_key (const gchar        *pattern,
+           GRegexCompileFlags  compile_options,
+           GRegexMatchFlags    match_options)
+{
+    return g_strdup_printf ("%x:%x:%s", compile_options, match_options, pattern);
+}
+
+static GRegex *
+registry_get (const gchar        *pattern,
+              GRegexCompileFlags  compile_options,
+              GRegexMatchFlags    match_options,
+              gboolean            requested)
+{
+    g_autofree gchar *key = NULL;
+    RegistryEntry    *entry;
+    GRegex           *regex;
+
+    g_assert (pattern);
+
+    compile_options |= G_REGEX_OPTIMIZE;
+    key = build_key (pattern, compile_options, match_options);
+
+    g_mutex_lock (&registry_mutex);
+    {
+        if (G_UNLIKELY (!registry))
+            registry = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, (GDestroyNotify) registry_entry_free);
+
+        entry = g_hash_table_lookup (registry, key);
+        if (!entry) {
+            g_autoptr(GError) error = NULL;
+
+            regex = g_regex_new (pattern, compile_options, match_options, &error);
+            if (!regex)
+                g_error ("couldn't compile regex '%s': %s", pattern, error->message);
+            n_compilations++;
+            entry = g_slice_new0 (RegistryEntry);
+            entry->pattern = g_strdup (pattern);
+            entry->regex = regex;
+            g_hash_table_insert (registry, g_steal_pointer (&key), entry);
+        }
+        entry->requested |= requested;
+        regex = g_regex_ref (entry->regex);
+    }
+    g_mutex_unlock (&registry_mutex);
+
+    return regex;
+}
+
+GRegex *
+mm_regex_get (const gchar        *pattern,
+              GRegexCompileFlags  compile_options,
+              GRegexMatchFlags    match_options)
+{
+    return registry_get (pattern, compile_options, match_options, TRUE);
+}
+
+void
+mm_regex_warm_up (const MMRegexPattern *patterns,
+                  guint                 n_patterns)
+{
+    guint i;
+
+    for (i = 0; i < n_patterns; i++)
+        g_regex_unref (registry_get (patterns[i].pattern,
+                                     patterns[i].compile_options,
+                                     patterns[i].match_options,
+                                     FALSE));
+}
+
+guint
+mm_regex_get_n_compilations (void)
+{
+    guint n;
+
+    g_mutex_lock (&registry_mutex);
+    n = n_compilations;
+    g_mutex_unlock (&registry_mutex);
+    return n;
+}
+
+GStrv
+mm_regex_list_unrequested (void)
+{
+    GPtrArray      *unrequested;
+    GHashTableIter  iter;
+    RegistryEntry  *entry;
+
+    unrequested = g_ptr_array_new ();
+
+    g_mutex_lock (&registry_mutex);
+    if (registry) {
+        g_hash_table_iter_init (&iter, registry);
+        while (g_hash_table_iter_next (&iter, NULL, (gpointer *) &entry)) {
+            if (!entry->requested)
+                g_ptr_array_add (unrequested, g_strdup (entry->pattern));
+        }
+    }
+    g_mutex_unlock (&registry_mutex);
+
+    g_ptr_array_add (unrequested, NULL);
+    return (GStrv) g_ptr_array_free (unrequested, FALSE);
+}
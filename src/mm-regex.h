@@ -0,0 +1,57 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details:
+ *
+ * Copyright (C) 2026 The ModemManager authors
+ */
+
+#ifndef MM_REGEX_H
+#define MM_REGEX_H
+
+#include <glib.h>
+
+/* Process-wide registry of compiled regular expressions.
+ *
+ * Patterns are compiled (always with G_REGEX_OPTIMIZE) the first time they
+ * are requested and kept for the whole lifetime of the process, so that
+ * parsers running the same pattern over and over don't pay the compilation
+ * cost every time. GRegex objects are immutable and may be shared.
+ *
+ * mm_regex_get() returns a new reference, so callers release it with
+ * g_regex_unref() (or g_autoptr) exactly as if it had been created with
+ * g_regex_new(). The given pattern must be a valid one; this method never
+ * fails. */
+
+GRegex *mm_regex_get                  (const gchar        *pattern,
+                                       GRegexCompileFlags  compile_options,
+                                       GRegexMatchFlags    match_options);
+
+typedef struct {
+    const gchar        *pattern;
+    GRegexCompileFlags  compile_options;
+    GRegexMatchFlags    match_options;
+} MMRegexPattern;
+
+/* Compile in advance the given set of patterns. */
+void    mm_regex_warm_up              (const MMRegexPattern *patterns,
+                                       guint                 n_patterns);
+
+/* Number of regex compilations done by the registry so far, which should
+ * stay constant once all the patterns have been requested at least once. */
+guint   mm_regex_get_n_compilations   (void);
+
+/* Patterns compiled by mm_regex_warm_up() that have never been requested
+ * with mm_regex_get(), e.g. because the warm-up table and the call site
+ * disagree on the pattern or its flags. Only meaningful once every call
+ * site has run, which is what the unit tests check. */
+GStrv   mm_regex_list_unrequested     (void);
+
+#endif /* MM_REGEX_H */
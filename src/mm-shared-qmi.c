@@ -3634,6 +3634,18 @@ uim_refresh_complete (QmiClientUim      *client,
     g_array_unref (placeholder_aid);
 }
 
+static void
+uim_refresh_reload_sim_contents (MMSharedQmi *self)
+{
+    g_autoptr(MMBaseSim) sim = NULL;
+
+    /* If the SIM was swapped the modem is re-probed and a new SIM object
+     * is created; otherwise, the SIM files may still have been updated */
+    g_object_get (self, MM_IFACE_MODEM_SIM, &sim, NULL);
+    if (sim)
+        mm_base_sim_reload_contents (sim);
+}
+
 static gboolean
 uim_start_refresh_timeout (MMSharedQmi *self)
 {
@@ -3645,6 +3657,7 @@ uim_start_refresh_timeout (MMSharedQmi *self)
     mm_obj_dbg (self, "refresh start timed out; trigger SIM change check");
 
     mm_iface_modem_check_for_sim_swap (MM_IFACE_MODEM (self), 0, NULL, NULL, NULL, NULL);
+    uim_refresh_reload_sim_contents (self);
 
     return G_SOURCE_REMOVE;
 }
@@ -3695,8 +3708,18 @@ uim_refresh_indication_cb (QmiClientUim                  *client,
      *
      * It's possible that 'end-with-success' stage never appears. For that,
      * we start a timer at 'start' stage and if it expires, the SIM change
-     * check is triggered anyway. */
+     * check is triggered anyway.
+     *
+     * Any refresh means SIM files may have changed, so the cached SIM
+     * contents are dropped when it starts, and the contents exposed in the
+     * SIM object are reloaded once it has finished. */
     if (stage == QMI_UIM_REFRESH_STAGE_START) {
+        g_autoptr(MMBaseSim) sim = NULL;
+
+        g_object_get (self, MM_IFACE_MODEM_SIM, &sim, NULL);
+        if (sim)
+            mm_base_sim_invalidate_cache (sim);
+
         if (mode == QMI_UIM_REFRESH_MODE_RESET || mode == QMI_UIM_REFRESH_MODE_INIT_FULL_FCN) {
             if (!priv->uim_refresh_start_timeout_id)
                 priv->uim_refresh_start_timeout_id = g_timeout_add_seconds (REFRESH_START_TIMEOUT_SECS,
@@ -3712,6 +3735,7 @@ uim_refresh_indication_cb (QmiClientUim                  *client,
             }
             mm_iface_modem_check_for_sim_swap (MM_IFACE_MODEM (self), 0, NULL, NULL, NULL, NULL);
         }
+        uim_refresh_reload_sim_contents (self);
     }
 }
 
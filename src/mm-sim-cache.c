@@ -0,0 +1,224 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details:
+ *
+ * Copyright (C) 2026 The ModemManager authors
+ */
+
+#include <config.h>
+#include <errno.h>
+
+#include <glib/gstdio.h>
+
+#include <ModemManager.h>
+#include <mm-errors-types.h>
+
+#include "mm-context.h"
+#include "mm-log-object.h"
+#include "mm-sim-cache.h"
+
+#define CACHE_GROUP "sim"
+
+#define KEY_IMSI                "imsi"
+#define KEY_OPERATOR_IDENTIFIER "operator-identifier"
+#define KEY_OPERATOR_NAME       "operator-name"
+#define KEY_EMERGENCY_NUMBERS   "emergency-numbers"
+#define KEY_PREFERRED_NETWORKS  "preferred-networks"
+#define KEY_GID1                "gid1"
+#define KEY_GID2                "gid2"
+#define KEY_EID                 "eid"
+
+gboolean
+mm_sim_cache_enabled (void)
+{
+    const gchar *dir;
+
+    dir = mm_context_get_sim_cache_dir ();
+    return (dir && dir[0]);
+}
+
+/* The ICCID is personal info, so don't use it directly as file name */
+static gchar *
+build_cache_path (const gchar *iccid)
+{
+    g_autofree gchar *checksum = NULL;
+    g_autofree gchar *filename = NULL;
+
+    checksum = g_compute_checksum_for_string (G_CHECKSUM_SHA256, iccid, -1);
+    filename = g_strdup_printf ("%s.sim", checksum);
+    return g_build_filename (mm_context_get_sim_cache_dir (), filename, NULL);
+}
+
+/*****************************************************************************/
+
+static void
+load_variant (GKeyFile           *keyfile,
+              const gchar        *key,
+              const GVariantType *type,
+              GVariant           *current,
+              void              (*setter) (MmGdbusSim *, GVariant *),
+              MmGdbusSim         *sim)
+{
+    g_autofree gchar    *str = NULL;
+    g_autoptr(GError)    error = NULL;
+    g_autoptr(GVariant)  value = NULL;
+
+    if (current)
+        return;
+
+    str = g_key_file_get_string (keyfile, CACHE_GROUP, key, NULL);
+    if (!str)
+        return;
+
+    value = g_variant_parse (type, str, NULL, NULL, &error);
+    if (!value) {
+        mm_obj_dbg (sim, "couldn't parse cached %s: %s", key, error->message);
+        return;
+    }
+    setter (sim, value);
+}
+
+static void
+load_string (GKeyFile     *keyfile,
+             const gchar  *key,
+             const gchar  *current,
+             void        (*setter) (MmGdbusSim *, const gchar *),
+             MmGdbusSim   *sim)
+{
+    g_autofree gchar *str = NULL;
+
+    if (current)
+        return;
+
+    str = g_key_file_get_string (keyfile, CACHE_GROUP, key, NULL);
+    if (str)
+        setter (sim, str);
+}
+
+gboolean
+mm_sim_cache_load (const gchar  *iccid,
+                   MmGdbusSim   *sim,
+                   GError      **error)
+{
+    g_autoptr(GKeyFile)  keyfile = NULL;
+    g_autofree gchar    *path = NULL;
+
+    if (!mm_sim_cache_enabled ()) {
+        g_set_error (error, MM_CORE_ERROR, MM_CORE_ERROR_UNSUPPORTED, "SIM cache disabled");
+        return FALSE;
+    }
+
+    path = build_cache_path (iccid);
+    keyfile = g_key_file_new ();
+    if (!g_key_file_load_from_file (keyfile, path, G_KEY_FILE_NONE, error))
+        return FALSE;
+
+    load_string (keyfile, KEY_IMSI,                mm_gdbus_sim_get_imsi (sim),                mm_gdbus_sim_set_imsi,                sim);
+    load_string (keyfile, KEY_OPERATOR_IDENTIFIER, mm_gdbus_sim_get_operator_identifier (sim), mm_gdbus_sim_set_operator_identifier, sim);
+    load_string (keyfile, KEY_OPERATOR_NAME,       mm_gdbus_sim_get_operator_name (sim),       mm_gdbus_sim_set_operator_name,       sim);
+    load_string (keyfile, KEY_EID,                 mm_gdbus_sim_get_eid (sim),                 mm_gdbus_sim_set_eid,                 sim);
+
+    if (!mm_gdbus_sim_get_emergency_numbers (sim)) {
+        g_auto(GStrv) numbers = NULL;
+
+        numbers = g_key_file_get_string_list (keyfile, CACHE_GROUP, KEY_EMERGENCY_NUMBERS, NULL, NULL);
+        if (numbers)
+            mm_gdbus_sim_set_emergency_numbers (sim, (const gchar *const *) numbers);
+    }
+
+    load_variant (keyfile, KEY_PREFERRED_NETWORKS, G_VARIANT_TYPE ("a(su)"), mm_gdbus_sim_get_preferred_networks (sim), mm_gdbus_sim_set_preferred_networks, sim);
+    load_variant (keyfile, KEY_GID1,               G_VARIANT_TYPE ("ay"),    mm_gdbus_sim_get_gid1 (sim),               mm_gdbus_sim_set_gid1,               sim);
+    load_variant (keyfile, KEY_GID2,               G_VARIANT_TYPE ("ay"),    mm_gdbus_sim_get_gid2 (sim),               mm_gdbus_sim_set_gid2,               sim);
+
+    return TRUE;
+}
+
+/*****************************************************************************/
+
+static void
+store_string (GKeyFile    *keyfile,
+              const gchar *key,
+              const gchar *value)
+{
+    if (value)
+        g_key_file_set_string (keyfile, CACHE_GROUP, key, value);
+}
+
+static void
+store_variant (GKeyFile    *keyfile,
+               const gchar *key,
+               GVariant    *value)
+{
+    g_autofree gchar *str = NULL;
+
+    if (!value)
+        return;
+
+    str = g_variant_print (value, FALSE);
+    g_key_file_set_string (keyfile, CACHE_GROUP, key, str);
+}
+
+gboolean
+mm_sim_cache_store (const gchar  *iccid,
+                    MmGdbusSim   *sim,
+                    GError      **error)
+{
+    g_autoptr(GKeyFile)  keyfile = NULL;
+    g_autofree gchar    *path = NULL;
+    g_autofree gchar    *data = NULL;
+    const gchar *const  *numbers;
+    gsize                data_len;
+
+    if (!mm_sim_cache_enabled ()) {
+        g_set_error (error, MM_CORE_ERROR, MM_CORE_ERROR_UNSUPPORTED, "SIM cache disabled");
+        return FALSE;
+    }
+
+    if (g_mkdir_with_parents (mm_context_get_sim_cache_dir (), 0700) < 0) {
+        g_set_error (error, MM_CORE_ERROR, MM_CORE_ERROR_FAILED,
+                     "Couldn't create SIM cache directory: %s", g_strerror (errno));
+        return FALSE;
+    }
+
+    keyfile = g_key_file_new ();
+    store_string (keyfile, KEY_IMSI,                mm_gdbus_sim_get_imsi (sim));
+    store_string (keyfile, KEY_OPERATOR_IDENTIFIER, mm_gdbus_sim_get_operator_identifier (sim));
+    store_string (keyfile, KEY_OPERATOR_NAME,       mm_gdbus_sim_get_operator_name (sim));
+    store_string (keyfile, KEY_EID,                 mm_gdbus_sim_get_eid (sim));
+
+    numbers = mm_gdbus_sim_get_emergency_numbers (sim);
+    if (numbers)
+        g_key_file_set_string_list (keyfile, CACHE_GROUP, KEY_EMERGENCY_NUMBERS, numbers, g_strv_length ((gchar **) numbers));
+
+    store_variant (keyfile, KEY_PREFERRED_NETWORKS, mm_gdbus_sim_get_preferred_networks (sim));
+    store_variant (keyfile, KEY_GID1,               mm_gdbus_sim_get_gid1 (sim));
+    store_variant (keyfile, KEY_GID2,               mm_gdbus_sim_get_gid2 (sim));
+
+    data = g_key_file_to_data (keyfile, &data_len, NULL);
+    path = build_cache_path (iccid);
+    return g_file_set_contents (path, data, data_len, error);
+}
+
+/*****************************************************************************/
+
+void
+mm_sim_cache_remove (const gchar *iccid,
+                     gpointer     log_object)
+{
+    g_autofree gchar *path = NULL;
+
+    if (!mm_sim_cache_enabled ())
+        return;
+
+    path = build_cache_path (iccid);
+    if (g_unlink (path) < 0 && errno != ENOENT)
+        mm_obj_warn (log_object, "couldn't remove cached SIM contents: %s", g_strerror (errno));
+}
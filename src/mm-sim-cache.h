@@ -0,0 +1,39 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details:
+ *
+ * Copyright (C) 2026 The ModemManager authors
+ */
+
+#ifndef MM_SIM_CACHE_H
+#define MM_SIM_CACHE_H
+
+#include <glib.h>
+#include <mm-gdbus-sim.h>
+
+/* Persistent cache of the static contents of SIM cards (IMSI, operator info,
+ * emergency numbers, preferred networks, GIDs and EID), keyed by ICCID.
+ * The cache is only used if a cache directory is given to the daemon. */
+
+gboolean mm_sim_cache_enabled (void);
+
+/* Sets in @sim all the cached values not already set. Returns FALSE if
+ * there was no cache for the given ICCID. */
+gboolean mm_sim_cache_load    (const gchar  *iccid,
+                               MmGdbusSim   *sim,
+                               GError      **error);
+gboolean mm_sim_cache_store   (const gchar  *iccid,
+                               MmGdbusSim   *sim,
+                               GError      **error);
+void     mm_sim_cache_remove  (const gchar  *iccid,
+                               gpointer      log_object);
+
+#endif /* MM_SIM_CACHE_H */
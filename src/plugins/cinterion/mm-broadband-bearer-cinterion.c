@@ -31,6 +31,16 @@
 
 G_DEFINE_TYPE (MMBroadbandBearerCinterion, mm_broadband_bearer_cinterion, MM_TYPE_BROADBAND_BEARER)
 
+struct _MMBroadbandBearerCinterionPrivate {
+    /* Delayed ^SWWAN? check, which may be run right away if the modem
+     * reports a context event (+CGEV) for the same cid */
+    GTask    *delayed_check_task;
+    guint     delayed_check_id;
+    guint     delayed_check_cid;
+    /* Context event received while no delayed check was pending */
+    guint     latched_event_cid;
+};
+
 /*****************************************************************************/
 /* WWAN interface mapping */
 
@@ -116,6 +126,66 @@ load_connection_context_free (LoadConnectionContext *ctx)
 
 static gboolean swwan_check_status (GTask *task);
 
+static gboolean
+swwan_check_status_delayed_cb (GTask *task)
+{
+    MMBroadbandBearerCinterion *self;
+
+    self = g_task_get_source_object (task);
+    g_assert (self->priv->delayed_check_task == task);
+    self->priv->delayed_check_id = 0;
+    self->priv->delayed_check_task = NULL;
+    return swwan_check_status (task);
+}
+
+static void
+swwan_check_status_schedule (GTask *task)
+{
+    MMBroadbandBearerCinterion *self;
+    LoadConnectionContext      *ctx;
+
+    self = g_task_get_source_object (task);
+    ctx  = g_task_get_task_data (task);
+
+    /* A context event for this cid already arrived, no need to wait */
+    if (self->priv->latched_event_cid == ctx->cid) {
+        mm_obj_dbg (self, "context event already received for CID %u: checking status right away", ctx->cid);
+        self->priv->latched_event_cid = 0;
+        g_idle_add ((GSourceFunc)swwan_check_status, task);
+        return;
+    }
+
+    g_assert (!self->priv->delayed_check_id);
+    self->priv->delayed_check_task = task;
+    self->priv->delayed_check_cid = ctx->cid;
+    self->priv->delayed_check_id = g_timeout_add_seconds (1, (GSourceFunc)swwan_check_status_delayed_cb, task);
+}
+
+static void
+report_context_event (MMBroadbandBearer *_self,
+                      guint              cid,
+                      gboolean           active)
+{
+    MMBroadbandBearerCinterion *self = MM_BROADBAND_BEARER_CINTERION (_self);
+    GTask                      *task;
+
+    if (!self->priv->delayed_check_id) {
+        self->priv->latched_event_cid = cid;
+        return;
+    }
+
+    if (self->priv->delayed_check_cid != cid)
+        return;
+
+    mm_obj_dbg (self, "context %s event received for CID %u: checking status right away",
+                active ? "activation" : "deactivation", cid);
+    task = self->priv->delayed_check_task;
+    g_source_remove (self->priv->delayed_check_id);
+    self->priv->delayed_check_id = 0;
+    self->priv->delayed_check_task = NULL;
+    swwan_check_status (task);
+}
+
 static void
 swwan_check_status_ready (MMBaseModem  *modem,
                           GAsyncResult *res,
@@ -148,7 +218,7 @@ swwan_check_status_ready (MMBaseModem  *modem,
             goto out;
         } else {
             if (ctx->delay) {
-                g_timeout_add_seconds (1, (GSourceFunc)swwan_check_status, task);
+                swwan_check_status_schedule (task);
             } else {
                 g_idle_add ((GSourceFunc)swwan_check_status, task);
             }
@@ -215,9 +285,11 @@ load_connection_status_by_cid (MMBroadbandBearerCinterion *bearer,
 
     /* Some modems require a delay before querying the SWWAN status
      * This is only needed for step DIAL_3GPP_CONTEXT_STEP_VALIDATE_CONNECTION
-     * and DISCONNECT_3GPP_CONTEXT_STEP_CONNECTION_STATUS. */
+     * and DISCONNECT_3GPP_CONTEXT_STEP_CONNECTION_STATUS. If the modem
+     * reports +CGEV indications, the delay is cut short as soon as the
+     * context event for the cid is received. */
     if (delay) {
-        g_timeout_add_seconds (1, (GSourceFunc)swwan_check_status, task);
+        swwan_check_status_schedule (task);
     } else {
         g_idle_add ((GSourceFunc)swwan_check_status, task);
     }
@@ -427,6 +499,9 @@ dial_3gpp_context_step (GTask *task)
     case DIAL_3GPP_CONTEXT_STEP_START_SWWAN: {
         g_autofree gchar *command = NULL;
 
+        /* Forget any context event received before the connection attempt */
+        self->priv->latched_event_cid = 0;
+
         mm_obj_dbg (self, "dial step %u/%u: starting SWWAN interface %u connection...",
                     ctx->step, DIAL_3GPP_CONTEXT_STEP_LAST, usb_interface_configs[ctx->usb_interface_config_index].swwan_index);
         command = g_strdup_printf ("^SWWAN=1,%u,%u",
@@ -647,6 +722,9 @@ disconnect_3gpp_context_step (GTask *task)
     case DISCONNECT_3GPP_CONTEXT_STEP_STOP_SWWAN: {
         gchar *command;
 
+        /* Forget any context event received before the disconnection attempt */
+        self->priv->latched_event_cid = 0;
+
         command = g_strdup_printf ("^SWWAN=0,%u,%u",
                                    ctx->cid, usb_interface_configs[ctx->usb_interface_config_index].swwan_index);
         mm_obj_dbg (self, "disconnect step %u/%u: disconnecting PDP CID %u...",
@@ -774,14 +852,21 @@ mm_broadband_bearer_cinterion_new (MMBroadbandModemCinterion *modem,
 static void
 mm_broadband_bearer_cinterion_init (MMBroadbandBearerCinterion *self)
 {
+    /* Initialize private data */
+    self->priv = G_TYPE_INSTANCE_GET_PRIVATE (self,
+                                              MM_TYPE_BROADBAND_BEARER_CINTERION,
+                                              MMBroadbandBearerCinterionPrivate);
 }
 
 static void
 mm_broadband_bearer_cinterion_class_init (MMBroadbandBearerCinterionClass *klass)
 {
+    GObjectClass           *object_class           = G_OBJECT_CLASS            (klass);
     MMBaseBearerClass      *base_bearer_class      = MM_BASE_BEARER_CLASS      (klass);
     MMBroadbandBearerClass *broadband_bearer_class = MM_BROADBAND_BEARER_CLASS (klass);
 
+    g_type_class_add_private (object_class, sizeof (MMBroadbandBearerCinterionPrivate));
+
     base_bearer_class->load_connection_status        = load_connection_status;
     base_bearer_class->load_connection_status_finish = load_connection_status_finish;
 #if defined WITH_SUSPEND_RESUME
@@ -793,4 +878,5 @@ mm_broadband_bearer_cinterion_class_init (MMBroadbandBearerCinterionClass *klass
     broadband_bearer_class->dial_3gpp_finish       = dial_3gpp_finish;
     broadband_bearer_class->disconnect_3gpp        = disconnect_3gpp;
     broadband_bearer_class->disconnect_3gpp_finish = disconnect_3gpp_finish;
+    broadband_bearer_class->report_context_event   = report_context_event;
 }
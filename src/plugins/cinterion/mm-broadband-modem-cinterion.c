@@ -74,6 +74,12 @@ typedef enum {
     FEATURE_SUPPORTED,
 } FeatureSupport;
 
+typedef enum {
+    CINTERION_SIM_STATUS_REMOVED        = 0,
+    CINTERION_SIM_STATUS_INSERTED       = 1,
+    CINTERION_SIM_STATUS_INIT_COMPLETED = 5,
+} CinterionSimStatus;
+
 struct _MMBroadbandModemCinterionPrivate {
     /* Command to go into sleep mode */
     gchar *sleep_mode_cmd;
@@ -996,6 +1002,11 @@ sind_ciev_received (MMPortSerialAt            *port,
             mm_iface_modem_update_access_technologies (MM_IFACE_MODEM (self),
                                                        mm_cinterion_get_access_technology_from_sind_psinfo (val, self),
                                                        MM_IFACE_MODEM_3GPP_ALL_ACCESS_TECHNOLOGIES_MASK);
+        } else if (g_strcmp0 (indicator, "simstatus") == 0) {
+            if (val == CINTERION_SIM_STATUS_INIT_COMPLETED)
+                mm_iface_modem_report_sim_ready (MM_IFACE_MODEM (self), TRUE);
+            else if (val == CINTERION_SIM_STATUS_REMOVED)
+                mm_iface_modem_report_sim_ready (MM_IFACE_MODEM (self), FALSE);
         }
     }
     g_free (indicator);
@@ -2691,18 +2702,7 @@ load_unlock_retries (MMIfaceModem        *self,
 /*****************************************************************************/
 /* After SIM unlock (Modem interface) */
 
-#define MAX_AFTER_SIM_UNLOCK_RETRIES 15
-
-typedef enum {
-    CINTERION_SIM_STATUS_REMOVED        = 0,
-    CINTERION_SIM_STATUS_INSERTED       = 1,
-    CINTERION_SIM_STATUS_INIT_COMPLETED = 5,
-} CinterionSimStatus;
-
-typedef struct {
-    guint retries;
-    guint timeout_id;
-} AfterSimUnlockContext;
+#define MAX_AFTER_SIM_UNLOCK_WAIT_SECS 15
 
 static gboolean
 after_sim_unlock_finish (MMIfaceModem  *self,
@@ -2712,75 +2712,47 @@ after_sim_unlock_finish (MMIfaceModem  *self,
     return g_task_propagate_boolean (G_TASK (res), error);
 }
 
-static void after_sim_unlock_context_step (GTask *task);
-
 static gboolean
-simstatus_timeout_cb (GTask *task)
+simstatus_check_finish (MMIfaceModem  *self,
+                        GAsyncResult  *res,
+                        GError       **error)
 {
-    AfterSimUnlockContext *ctx;
+    const gchar      *response;
+    g_autofree gchar *descr = NULL;
+    guint             val = 0;
 
-    ctx = g_task_get_task_data (task);
-    ctx->timeout_id = 0;
-    after_sim_unlock_context_step (task);
-    return G_SOURCE_REMOVE;
+    response = mm_base_modem_at_command_finish (MM_BASE_MODEM (self), res, error);
+    if (!response || !mm_cinterion_parse_sind_response (response, &descr, NULL, &val, error))
+        return FALSE;
+
+    return (g_str_equal (descr, "simstatus") && val == CINTERION_SIM_STATUS_INIT_COMPLETED);
 }
 
 static void
-simstatus_check_ready (MMBaseModem  *self,
-                       GAsyncResult *res,
-                       GTask        *task)
+simstatus_check (MMIfaceModem        *self,
+                 GAsyncReadyCallback  callback,
+                 gpointer             user_data)
 {
-    AfterSimUnlockContext *ctx;
-    const gchar           *response;
-
-    response = mm_base_modem_at_command_finish (self, res, NULL);
-    if (response) {
-        gchar *descr = NULL;
-        guint val = 0;
-
-        if (mm_cinterion_parse_sind_response (response, &descr, NULL, &val, NULL) &&
-            g_str_equal (descr, "simstatus") &&
-            val == CINTERION_SIM_STATUS_INIT_COMPLETED) {
-            /* SIM ready! */
-            g_free (descr);
-            g_task_return_boolean (task, TRUE);
-            g_object_unref (task);
-            return;
-        }
-
-        g_free (descr);
-    }
-
-    /* Need to retry after 1 sec */
-    ctx = g_task_get_task_data (task);
-    g_assert (ctx->timeout_id == 0);
-    ctx->timeout_id = g_timeout_add_seconds (1, (GSourceFunc)simstatus_timeout_cb, task);
+    mm_base_modem_at_command (MM_BASE_MODEM (self),
+                              "^SIND=\"simstatus\",2",
+                              3,
+                              FALSE,
+                              callback,
+                              user_data);
 }
 
 static void
-after_sim_unlock_context_step (GTask *task)
+wait_sim_ready_ready (MMIfaceModem *self,
+                      GAsyncResult *res,
+                      GTask        *task)
 {
-    MMBroadbandModemCinterion *self;
-    AfterSimUnlockContext     *ctx;
-
-    self = g_task_get_source_object (task);
-    ctx = g_task_get_task_data (task);
+    GError *error = NULL;
 
-    /* if not supported or too much wait, skip */
-    if (self->priv->sind_simstatus_support != FEATURE_SUPPORTED || ctx->retries == 0) {
+    if (!mm_iface_modem_wait_sim_ready_finish (self, res, &error))
+        g_task_return_error (task, error);
+    else
         g_task_return_boolean (task, TRUE);
-        g_object_unref (task);
-        return;
-    }
-
-    /* Recheck */
-    ctx->retries--;
-    mm_base_modem_at_command (MM_BASE_MODEM (self),
-                              "^SIND=\"simstatus\",2",
-                              3,
-                              FALSE,
-                              (GAsyncReadyCallback)simstatus_check_ready,
-                              task);
+    g_object_unref (task);
 }
 
 static void
@@ -2814,7 +2786,19 @@ sind_indicators_ready (MMBaseModem  *_self,
         self->priv->sind_simstatus_support = FEATURE_SUPPORTED;
     mm_obj_dbg (self, "simstatus support? %s", self->priv->sind_simstatus_support == FEATURE_SUPPORTED ? "yes":"no");
 
-    after_sim_unlock_context_step (task);
+    /* if not supported, skip */
+    if (self->priv->sind_simstatus_support != FEATURE_SUPPORTED) {
+        g_task_return_boolean (task, TRUE);
+        g_object_unref (task);
+        return;
+    }
+
+    mm_iface_modem_wait_sim_ready (MM_IFACE_MODEM (self),
+                                   MAX_AFTER_SIM_UNLOCK_WAIT_SECS,
+                                   simstatus_check,
+                                   simstatus_check_finish,
+                                   (GAsyncReadyCallback)wait_sim_ready_ready,
+                                   task);
 }
 
 static void
@@ -2822,13 +2806,9 @@ after_sim_unlock (MMIfaceModem        *self,
                   GAsyncReadyCallback  callback,
                   gpointer             user_data)
 {
-    GTask                 *task;
-    AfterSimUnlockContext *ctx;
+    GTask *task;
 
     task = g_task_new (self, NULL, callback, user_data);
-    ctx = g_new0 (AfterSimUnlockContext, 1);
-    ctx->retries = MAX_AFTER_SIM_UNLOCK_RETRIES;
-    g_task_set_task_data (task, ctx, g_free);
 
     /* check which indicators are available */
     mm_base_modem_at_command (MM_BASE_MODEM (self),
@@ -29,6 +29,7 @@
 #include "mm-errors-types.h"
 #include "mm-modem-helpers-cinterion.h"
 #include "mm-modem-helpers.h"
+#include "mm-regex.h"
 #include "mm-common-helpers.h"
 #include "mm-port-serial-at.h"
 
@@ -250,6 +251,12 @@ take_and_convert_from_matched_string (gchar                   *str,
     return val;
 }
 
+#define SCFG_TEST_SINGLE_REGEX "\\^SCFG:\\s*\"Radio/Band\",\\((?:\")?([0-9]*)(?:\")?-(?:\")?([0-9]*)(?:\")?.*\\)"
+#define SCFG_TEST_MULTIPLE_REGEX \
+    "\\^SCFG:\\s*\"Radio/Band/([234]G)\"," \
+    "\\(\"?([0-9A-Fa-fx]*)\"?-\"?([0-9A-Fa-fx]*)\"?\\)" \
+    "(,*\\(\"?([0-9A-Fa-fx]*)\"?-\"?([0-9A-Fa-fx]*)\"?\\))?"
+
 gboolean
 mm_cinterion_parse_scfg_test (const gchar                 *response,
                               MMCinterionModemFamily       modem_family,
@@ -272,8 +279,8 @@ mm_cinterion_parse_scfg_test (const gchar                 *response,
         return FALSE;
     }
 
-    r1 = g_regex_new ("\\^SCFG:\\s*\"Radio/Band\",\\((?:\")?([0-9]*)(?:\")?-(?:\")?([0-9]*)(?:\")?.*\\)",
-                     G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0, NULL);
+    r1 = mm_regex_get (SCFG_TEST_SINGLE_REGEX,
+                      G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0);
     g_assert (r1 != NULL);
 
     g_regex_match_full (r1, response, strlen (response), 0, 0, &match_info1, &inner_error);
@@ -307,10 +314,7 @@ mm_cinterion_parse_scfg_test (const gchar                 *response,
         goto finish;
     }
 
-    r2 = g_regex_new ("\\^SCFG:\\s*\"Radio/Band/([234]G)\","
-                      "\\(\"?([0-9A-Fa-fx]*)\"?-\"?([0-9A-Fa-fx]*)\"?\\)"
-                      "(,*\\(\"?([0-9A-Fa-fx]*)\"?-\"?([0-9A-Fa-fx]*)\"?\\))?",
-                     0, 0, NULL);
+    r2 = mm_regex_get (SCFG_TEST_MULTIPLE_REGEX, 0, 0);
     g_assert (r2 != NULL);
 
     g_regex_match_full (r2, response, strlen (response), 0, 0, &match_info2, &inner_error);
@@ -417,6 +421,9 @@ finish:
  *     ...
  */
 
+#define SCFG_RESPONSE_SINGLE_REGEX "\\^SCFG:\\s*\"Radio/Band\",\\s*\"?([0-9a-fA-F]*)\"?"
+#define SCFG_RESPONSE_MULTIPLE_REGEX "\\^SCFG:\\s*\"Radio/Band/([234]G)\",\"?([0-9A-Fa-fx]*)\"?,?\"?([0-9A-Fa-fx]*)?\"?"
+
 gboolean
 mm_cinterion_parse_scfg_response (const gchar                  *response,
                                   MMCinterionModemFamily        modem_family,
@@ -436,7 +443,7 @@ mm_cinterion_parse_scfg_response (const gchar                  *response,
     }
 
     if (format == MM_CINTERION_RADIO_BAND_FORMAT_SINGLE) {
-        r = g_regex_new ("\\^SCFG:\\s*\"Radio/Band\",\\s*\"?([0-9a-fA-F]*)\"?", 0, 0, NULL);
+        r = mm_regex_get (SCFG_RESPONSE_SINGLE_REGEX, 0, 0);
         g_assert (r != NULL);
 
         g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -468,8 +475,7 @@ mm_cinterion_parse_scfg_response (const gchar                  *response,
             }
         }
     } else if (format == MM_CINTERION_RADIO_BAND_FORMAT_MULTIPLE) {
-        r = g_regex_new ("\\^SCFG:\\s*\"Radio/Band/([234]G)\",\"?([0-9A-Fa-fx]*)\"?,?\"?([0-9A-Fa-fx]*)?\"?",
-                         0, 0, NULL);
+        r = mm_regex_get (SCFG_RESPONSE_MULTIPLE_REGEX, 0, 0);
         g_assert (r != NULL);
 
         g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -545,6 +551,8 @@ finish:
  *   +CNMI: (0,1,2),(0,1),(0,2),(0),(1)
  */
 
+#define CNMI_TEST_REGEX "\\+CNMI:\\s*\\((.*)\\),\\((.*)\\),\\((.*)\\),\\((.*)\\),\\((.*)\\)"
+
 gboolean
 mm_cinterion_parse_cnmi_test (const gchar *response,
                               GArray **supported_mode,
@@ -568,9 +576,9 @@ mm_cinterion_parse_cnmi_test (const gchar *response,
         return FALSE;
     }
 
-    r = g_regex_new ("\\+CNMI:\\s*\\((.*)\\),\\((.*)\\),\\((.*)\\),\\((.*)\\),\\((.*)\\)",
-                     G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW,
-                     0, NULL);
+    r = mm_regex_get (CNMI_TEST_REGEX,
+                      G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW,
+                      0);
     g_assert (r != NULL);
 
     g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -645,6 +653,8 @@ out:
  *   ^SXRAT: (0-6),(0,2,3),(0,2,3)
  */
 
+#define SXRAT_TEST_REGEX "\\^SXRAT:\\s*\\(([^\\)]*)\\),\\(([^\\)]*)\\)(,\\(([^\\)]*)\\))?(?:\\r\\n)?"
+
 gboolean
 mm_cinterion_parse_sxrat_test (const gchar *response,
                                GArray **supported_rat,
@@ -664,9 +674,9 @@ mm_cinterion_parse_sxrat_test (const gchar *response,
         return FALSE;
     }
 
-    r = g_regex_new ("\\^SXRAT:\\s*\\(([^\\)]*)\\),\\(([^\\)]*)\\)(,\\(([^\\)]*)\\))?(?:\\r\\n)?",
-                     G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW,
-                     0, NULL);
+    r = mm_regex_get (SXRAT_TEST_REGEX,
+                      G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW,
+                      0);
 
     g_assert (r != NULL);
 
@@ -830,6 +840,8 @@ mm_cinterion_build_band (GArray                        *bands,
 /*****************************************************************************/
 /* Single ^SIND response parser */
 
+#define SIND_RESPONSE_REGEX "\\^SIND:\\s*(.*),(\\d+),(\\d+)(\\r\\n)?"
+
 gboolean
 mm_cinterion_parse_sind_response (const gchar *response,
                                   gchar **description,
@@ -846,7 +858,7 @@ mm_cinterion_parse_sind_response (const gchar *response,
         return FALSE;
     }
 
-    r = g_regex_new ("\\^SIND:\\s*(.*),(\\d+),(\\d+)(\\r\\n)?", 0, 0, NULL);
+    r = mm_regex_get (SIND_RESPONSE_REGEX, 0, 0);
     g_assert (r != NULL);
 
     if (g_regex_match (r, response, 0, &match_info)) {
@@ -901,6 +913,8 @@ enum {
     MM_SWWAN_STATE_CONNECTED    =  1,
 };
 
+#define SWWAN_RESPONSE_REGEX "\\^SWWAN:\\s*(\\d+),\\s*(\\d+)(?:,\\s*(\\d+))?(?:\\r\\n)?"
+
 MMBearerConnectionStatus
 mm_cinterion_parse_swwan_response (const gchar  *response,
                                    guint         cid,
@@ -925,8 +939,8 @@ mm_cinterion_parse_swwan_response (const gchar  *response,
         return MM_BEARER_CONNECTION_STATUS_UNKNOWN;
     }
 
-    r = g_regex_new ("\\^SWWAN:\\s*(\\d+),\\s*(\\d+)(?:,\\s*(\\d+))?(?:\\r\\n)?",
-                     G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0, NULL);
+    r = mm_regex_get (SWWAN_RESPONSE_REGEX,
+                      G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0);
     g_assert (r != NULL);
 
     status = MM_BEARER_CONNECTION_STATUS_UNKNOWN;
@@ -972,6 +986,8 @@ mm_cinterion_parse_swwan_response (const gchar  *response,
  *   OK
  */
 
+#define SGAUTH_RESPONSE_REGEX "\\^SGAUTH:\\s*(\\d+),(\\d+),?\"?([a-zA-Z0-9_-]+)?\"?"
+
 gboolean
 mm_cinterion_parse_sgauth_response (const gchar          *response,
                                     guint                 cid,
@@ -982,7 +998,7 @@ mm_cinterion_parse_sgauth_response (const gchar          *response,
     g_autoptr(GRegex)     r = NULL;
     g_autoptr(GMatchInfo) match_info = NULL;
 
-    r = g_regex_new ("\\^SGAUTH:\\s*(\\d+),(\\d+),?\"?([a-zA-Z0-9_-]+)?\"?", 0, 0, NULL);
+    r = mm_regex_get (SGAUTH_RESPONSE_REGEX, 0, 0);
     g_assert (r != NULL);
 
     g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, NULL);
@@ -1039,6 +1055,11 @@ get_access_technology_from_smong_gprs_status (guint                     gprs_sta
     return FALSE;
 }
 
+#define SMONG_RESPONSE_REGEX \
+    ".*GPRS Monitor(?:\r\n)*" \
+    "BCCH\\s*G.*\\r\\n" \
+    "\\s*(\\d+)\\s*(\\d+)\\s*"
+
 gboolean
 mm_cinterion_parse_smong_response (const gchar              *response,
                                    MMModemAccessTechnology  *access_tech,
@@ -1059,11 +1080,9 @@ mm_cinterion_parse_smong_response (const gchar              *response,
      * 0776  1  -      -   214   03  2    00      01
      * OK
      */
-    regex = g_regex_new (".*GPRS Monitor(?:\r\n)*"
-                         "BCCH\\s*G.*\\r\\n"
-                         "\\s*(\\d+)\\s*(\\d+)\\s*",
-                         G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW,
-                         0, NULL);
+    regex = mm_regex_get (SMONG_RESPONSE_REGEX,
+                          G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW,
+                          0);
     g_assert (regex);
 
     g_regex_match_full (regex, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -1120,6 +1139,8 @@ mm_cinterion_get_access_technology_from_sind_psinfo (guint    val,
 /*****************************************************************************/
 /* ^SLCC psinfo helper */
 
+#define SLCC_URC_REGEX "\\r\\n(\\^SLCC: .*\\r\\n)*\\^SLCC: \\r\\n"
+
 GRegex *
 mm_cinterion_get_slcc_regex (void)
 {
@@ -1127,8 +1148,8 @@ mm_cinterion_get_slcc_regex (void)
      * with an empty line preceded by prefix "^SLCC: ", in order to indicate the end
      * of the list.
      */
-    return g_regex_new ("\\r\\n(\\^SLCC: .*\\r\\n)*\\^SLCC: \\r\\n",
-                        G_REGEX_RAW | G_REGEX_OPTIMIZE, 0, NULL);
+    return mm_regex_get (SLCC_URC_REGEX,
+                         G_REGEX_RAW | G_REGEX_OPTIMIZE, 0);
 }
 
 static void
@@ -1140,6 +1161,12 @@ cinterion_call_info_free (MMCallInfo *info)
     g_slice_free (MMCallInfo, info);
 }
 
+#define SLCC_LIST_REGEX \
+    "\\^SLCC:\\s*(\\d+),\\s*(\\d+),\\s*(\\d+),\\s*(\\d+),\\s*(\\d+),\\s*(\\d+)" /* mandatory fields */ \
+    "(?:,\\s*([^,]*),\\s*(\\d+)"                                                /* number and type */ \
+    "(?:,\\s*([^,]*)"                                                           /* alpha */ \
+    ")?)?$"
+
 gboolean
 mm_cinterion_parse_slcc_list (const gchar *str,
                               gpointer     log_object,
@@ -1175,13 +1202,9 @@ mm_cinterion_parse_slcc_list (const gchar *str,
      *  ^SLCC :
      */
 
-    r = g_regex_new ("\\^SLCC:\\s*(\\d+),\\s*(\\d+),\\s*(\\d+),\\s*(\\d+),\\s*(\\d+),\\s*(\\d+)" /* mandatory fields */
-                     "(?:,\\s*([^,]*),\\s*(\\d+)"                                                /* number and type */
-                     "(?:,\\s*([^,]*)"                                                           /* alpha */
-                     ")?)?$",
-                     G_REGEX_RAW | G_REGEX_MULTILINE | G_REGEX_NEWLINE_CRLF,
-                     G_REGEX_MATCH_NEWLINE_CRLF,
-                     NULL);
+    r = mm_regex_get (SLCC_LIST_REGEX,
+                      G_REGEX_RAW | G_REGEX_MULTILINE | G_REGEX_NEWLINE_CRLF,
+                      G_REGEX_MATCH_NEWLINE_CRLF);
     g_assert (r != NULL);
 
     g_regex_match_full (r, str, strlen (str), 0, 0, &match_info, &inner_error);
@@ -1246,6 +1269,8 @@ mm_cinterion_call_info_list_free (GList *call_info_list)
 /*****************************************************************************/
 /* +CTZU URC helpers */
 
+#define CTZU_URC_REGEX "\\r\\n\\+CTZU:\\s*\"(\\d+)\\/(\\d+)\\/(\\d+),(\\d+):(\\d+):(\\d+)\",([\\-\\+\\d]+)(?:,(\\d+))?(?:\\r\\n)?"
+
 GRegex *
 mm_cinterion_get_ctzu_regex (void)
 {
@@ -1256,8 +1281,8 @@ mm_cinterion_get_ctzu_regex (void)
      *  +CTZU: "19/07/09,10:19:15",+08,1
      */
 
-    return g_regex_new ("\\r\\n\\+CTZU:\\s*\"(\\d+)\\/(\\d+)\\/(\\d+),(\\d+):(\\d+):(\\d+)\",([\\-\\+\\d]+)(?:,(\\d+))?(?:\\r\\n)?",
-                        G_REGEX_RAW | G_REGEX_OPTIMIZE, 0, NULL);
+    return mm_regex_get (CTZU_URC_REGEX,
+                         G_REGEX_RAW | G_REGEX_OPTIMIZE, 0);
 }
 
 gboolean
@@ -1319,6 +1344,13 @@ mm_cinterion_parse_ctzu_urc (GMatchInfo         *match_info,
 /*****************************************************************************/
 /* ^SMONI response parser */
 
+#define FLOAT "([-+]?[0-9]+\\.?[0-9]*)"
+
+#define SMONI_TECH_REGEX "\\^SMONI:\\s*([234])"
+#define SMONI_2G_REGEX "\\^SMONI:\\s*2G,(\\d+),"FLOAT
+#define SMONI_3G_REGEX "\\^SMONI:\\s*3G,(\\d+),(\\d+),"FLOAT","FLOAT
+#define SMONI_4G_REGEX "\\^SMONI:\\s*4G,(\\d+),(\\d+),(\\d+),(\\d+),(\\w+),(\\d+),(\\d+),(\\w+),(\\w+),(\\d+),([^,]*),"FLOAT","FLOAT
+
 gboolean
 mm_cinterion_parse_smoni_query_response (const gchar           *response,
                                          MMCinterionRadioGen   *out_tech,
@@ -1406,7 +1438,7 @@ mm_cinterion_parse_smoni_query_response (const gchar           *response,
         success = TRUE;
         goto out;
     }
-    pre = g_regex_new ("\\^SMONI:\\s*([234])", 0, 0, NULL);
+    pre = mm_regex_get (SMONI_TECH_REGEX, 0, 0);
     g_assert (pre != NULL);
     g_regex_match_full (pre, response, strlen (response), 0, 0, &match_info_pre, &inner_error);
     if (!inner_error && g_match_info_matches (match_info_pre)) {
@@ -1414,10 +1446,9 @@ mm_cinterion_parse_smoni_query_response (const gchar           *response,
             inner_error = g_error_new (MM_CORE_ERROR, MM_CORE_ERROR_FAILED, "Couldn't read tech");
             goto out;
         }
-        #define FLOAT "([-+]?[0-9]+\\.?[0-9]*)"
         switch (tech) {
         case MM_CINTERION_RADIO_GEN_2G:
-            r = g_regex_new ("\\^SMONI:\\s*2G,(\\d+),"FLOAT, 0, 0, NULL);
+            r = mm_regex_get (SMONI_2G_REGEX, 0, 0);
             g_assert (r != NULL);
             g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
             if (!inner_error && g_match_info_matches (match_info)) {
@@ -1429,7 +1460,7 @@ mm_cinterion_parse_smoni_query_response (const gchar           *response,
             }
             break;
         case MM_CINTERION_RADIO_GEN_3G:
-            r = g_regex_new ("\\^SMONI:\\s*3G,(\\d+),(\\d+),"FLOAT","FLOAT, 0, 0, NULL);
+            r = mm_regex_get (SMONI_3G_REGEX, 0, 0);
             g_assert (r != NULL);
             g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
             if (!inner_error && g_match_info_matches (match_info)) {
@@ -1446,7 +1477,7 @@ mm_cinterion_parse_smoni_query_response (const gchar           *response,
             }
             break;
         case MM_CINTERION_RADIO_GEN_4G:
-            r = g_regex_new ("\\^SMONI:\\s*4G,(\\d+),(\\d+),(\\d+),(\\d+),(\\w+),(\\d+),(\\d+),(\\w+),(\\w+),(\\d+),([^,]*),"FLOAT","FLOAT, 0, 0, NULL);
+            r = mm_regex_get (SMONI_4G_REGEX, 0, 0);
             g_assert (r != NULL);
             g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
             if (!inner_error && g_match_info_matches (match_info)) {
@@ -1475,7 +1506,6 @@ mm_cinterion_parse_smoni_query_response (const gchar           *response,
         default:
             goto out;
         }
-        #undef FLOAT
         success = TRUE;
     }
 
@@ -1572,6 +1602,9 @@ mm_cinterion_smoni_response_to_signal_info (const gchar  *response,
  * ^SCFG: "MEopMode/Prov/Cfg","tmode" -> t-mob germany
  * OK
  */
+
+#define PROVCFG_RESPONSE_REGEX "\\^SCFG:\\s*\"MEopMode/Prov/Cfg\",\\s*\"([0-9a-zA-Z*]*)\""
+
 gboolean
 mm_cinterion_provcfg_response_to_cid (const gchar             *response,
                                       MMCinterionModemFamily   modem_family,
@@ -1585,7 +1618,7 @@ mm_cinterion_provcfg_response_to_cid (const gchar             *response,
     g_autofree gchar      *mno = NULL;
     GError                *inner_error = NULL;
 
-    r = g_regex_new ("\\^SCFG:\\s*\"MEopMode/Prov/Cfg\",\\s*\"([0-9a-zA-Z*]*)\"", 0, 0, NULL);
+    r = mm_regex_get (PROVCFG_RESPONSE_REGEX, 0, 0);
     g_assert (r != NULL);
 
     g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -1802,3 +1835,34 @@ mm_cinterion_build_sxrat_set_command (MMModemMode allowed,
 
     return g_string_free (command, FALSE);
 }
+
+/*****************************************************************************/
+
+/* Every constant pattern used by the parsers above, with the exact same flags
+ * as in the call site */
+static const MMRegexPattern warm_up_patterns[] = {
+    { SCFG_TEST_SINGLE_REGEX, G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0 },
+    { SCFG_TEST_MULTIPLE_REGEX, 0, 0 },
+    { SCFG_RESPONSE_SINGLE_REGEX, 0, 0 },
+    { SCFG_RESPONSE_MULTIPLE_REGEX, 0, 0 },
+    { CNMI_TEST_REGEX, G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0 },
+    { SXRAT_TEST_REGEX, G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0 },
+    { SIND_RESPONSE_REGEX, 0, 0 },
+    { SWWAN_RESPONSE_REGEX, G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0 },
+    { SGAUTH_RESPONSE_REGEX, 0, 0 },
+    { SMONG_RESPONSE_REGEX, G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0 },
+    { SLCC_URC_REGEX, G_REGEX_RAW | G_REGEX_OPTIMIZE, 0 },
+    { SLCC_LIST_REGEX, G_REGEX_RAW | G_REGEX_MULTILINE | G_REGEX_NEWLINE_CRLF, G_REGEX_MATCH_NEWLINE_CRLF },
+    { CTZU_URC_REGEX, G_REGEX_RAW | G_REGEX_OPTIMIZE, 0 },
+    { SMONI_TECH_REGEX, 0, 0 },
+    { SMONI_2G_REGEX, 0, 0 },
+    { SMONI_3G_REGEX, 0, 0 },
+    { SMONI_4G_REGEX, 0, 0 },
+    { PROVCFG_RESPONSE_REGEX, 0, 0 },
+};
+
+void
+mm_cinterion_warm_up (void)
+{
+    mm_regex_warm_up (warm_up_patterns, G_N_ELEMENTS (warm_up_patterns));
+}
@@ -208,4 +208,9 @@ gchar *mm_cinterion_build_sxrat_set_command (MMModemMode allowed,
                                              MMModemMode preferred,
                                              GError **error);
 
+/*****************************************************************************/
+/* Regex warm-up */
+
+void mm_cinterion_warm_up (void);
+
 #endif  /* MM_MODEM_HELPERS_CINTERION_H */
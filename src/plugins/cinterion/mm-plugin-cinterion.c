@@ -30,6 +30,8 @@
 #include "mm-plugin-common.h"
 #include "mm-broadband-modem-cinterion.h"
 #include "mm-log-object.h"
+#include "mm-context.h"
+#include "mm-modem-helpers-cinterion.h"
 
 #if defined WITH_QMI
 #include "mm-broadband-modem-qmi-cinterion.h"
@@ -188,6 +190,10 @@ mm_plugin_create_cinterion (void)
         .finish = G_CALLBACK (cinterion_custom_init_finish),
     };
 
+    /* Compile the plugin specific parser regexes in advance, if requested */
+    if (mm_context_get_regex_warm_up ())
+        mm_cinterion_warm_up ();
+
     return MM_PLUGIN (
         g_object_new (MM_TYPE_PLUGIN_CINTERION,
                       MM_PLUGIN_NAME,                   MM_MODULE_NAME,
@@ -25,6 +25,7 @@
 #include "mm-log-test.h"
 #include "mm-modem-helpers.h"
 #include "mm-modem-helpers-cinterion.h"
+#include "mm-regex.h"
 
 #define g_assert_cmpfloat_tolerance(val1, val2, tolerance)  \
     g_assert_cmpfloat (fabs (val1 - val2), <, tolerance)
@@ -1924,6 +1925,23 @@ test_sxrat (void)
         }
     }
 }
+/*****************************************************************************/
+/* Test regex warm-up coverage */
+
+static void
+test_regex_warm_up_coverage (void)
+{
+    g_auto(GStrv) unrequested = NULL;
+    guint         i;
+
+    /* Each pattern warmed up in main() must have been requested by one of the
+     * parsers exercised by the previous tests */
+    unrequested = mm_regex_list_unrequested ();
+    for (i = 0; unrequested[i]; i++)
+        g_test_message ("warmed pattern never requested: %s", unrequested[i]);
+    g_assert_cmpuint (g_strv_length (unrequested), ==, 0);
+}
+
 /*****************************************************************************/
 
 int main (int argc, char **argv)
@@ -1932,6 +1950,10 @@ int main (int argc, char **argv)
 
     g_test_init (&argc, &argv, NULL);
 
+    /* Warm up before running any parser, so that the coverage test can
+     * validate the warm-up table against the real call sites */
+    mm_cinterion_warm_up ();
+
     g_test_add_func ("/MM/cinterion/scfg",                    test_scfg);
     g_test_add_func ("/MM/cinterion/scfg/ehs5",               test_scfg_ehs5);
     g_test_add_func ("/MM/cinterion/scfg/pls62/gsm",          test_scfg_pls62_gsm);
@@ -1963,5 +1985,8 @@ int main (int argc, char **argv)
     g_test_add_func ("/MM/cinterion/sxrat/response/els61",    test_sxrat_response_els61);
     g_test_add_func ("/MM/cinterion/sxrat/response/other",    test_sxrat_response_other);
 
+    /* Must run after all the parser tests */
+    g_test_add_func ("/MM/cinterion/regex/warm-up", test_regex_warm_up_coverage);
+
     return g_test_run ();
 }
@@ -41,6 +41,22 @@ struct _MMBroadbandBearerHuaweiPrivate {
 
 /*****************************************************************************/
 
+/* Connection status is polled with ^NDISSTATQRY? every second, unless the
+ * modem is known to send ^NDISSTAT URCs; in that case the URC completes the
+ * operation and polling is just a slow fallback */
+#define NDISSTATQRY_RETRY_TIMEOUT_SECS          1
+#define NDISSTATQRY_RETRY_TIMEOUT_FALLBACK_SECS 5
+
+static guint
+get_ndisstatqry_retry_timeout (MMBaseModem *modem)
+{
+    return (mm_broadband_modem_huawei_get_ndisstat_reported (MM_BROADBAND_MODEM_HUAWEI (modem)) ?
+            NDISSTATQRY_RETRY_TIMEOUT_FALLBACK_SECS :
+            NDISSTATQRY_RETRY_TIMEOUT_SECS);
+}
+
+/*****************************************************************************/
+
 static MMPortSerialAt *
 get_dial_port (MMBroadbandModemHuawei *modem,
                MMPort                 *data,
@@ -74,7 +90,10 @@ typedef struct {
     MMPortSerialAt *primary;
     MMPort *data;
     Connect3gppContextStep step;
-    guint check_count;
+    GTimer *timer;
+    guint retry_id;
+    gboolean ndisstatqry_running;
+    gboolean ndisstat_connected;
     guint failed_ndisstatqry_count;
     MMBearerIpConfig *ipv4_config;
 } Connect3gppContext;
@@ -82,8 +101,12 @@ typedef struct {
 static void
 connect_3gpp_context_free (Connect3gppContext *ctx)
 {
+    g_assert (!ctx->retry_id);
     g_object_unref (ctx->modem);
 
+    if (ctx->timer)
+        g_timer_destroy (ctx->timer);
+
     g_clear_object (&ctx->ipv4_config);
     g_clear_object (&ctx->data);
     g_clear_object (&ctx->primary);
@@ -186,13 +209,14 @@ static gboolean
 connect_retry_ndisstatqry_check_cb (MMBroadbandBearerHuawei *self)
 {
     GTask *task;
+    Connect3gppContext *ctx;
 
     /* Recover context */
     task = self->priv->connect_pending;
     g_assert (task != NULL);
 
-    /* Balance refcount */
-    g_object_unref (self);
+    ctx = g_task_get_task_data (task);
+    ctx->retry_id = 0;
 
     /* Retry same step */
     connect_3gpp_context_step (task);
@@ -200,6 +224,38 @@ connect_retry_ndisstatqry_check_cb (MMBroadbandBearerHuawei *self)
     return G_SOURCE_REMOVE;
 }
 
+static void
+connect_ndisstat_received (MMBroadbandBearerHuawei  *self,
+                           MMBearerConnectionStatus  status)
+{
+    GTask *task;
+    Connect3gppContext *ctx;
+
+    task = self->priv->connect_pending;
+    ctx = g_task_get_task_data (task);
+
+    /* Only a 'CONNECTED' report while waiting for the connection is relevant */
+    if (ctx->step != CONNECT_3GPP_CONTEXT_STEP_NDISSTATQRY ||
+        status != MM_BEARER_CONNECTION_STATUS_CONNECTED)
+        return;
+
+    mm_obj_dbg (self, "received ^NDISSTAT (connected) while connecting");
+
+    /* If a query is ongoing, let its response handler go on */
+    if (ctx->ndisstatqry_running) {
+        ctx->ndisstat_connected = TRUE;
+        return;
+    }
+
+    /* Otherwise, cancel the retry and go on right away */
+    g_assert (ctx->retry_id);
+    g_source_remove (ctx->retry_id);
+    ctx->retry_id = 0;
+
+    ctx->step++;
+    connect_3gpp_context_step (task);
+}
+
 static void
 connect_ndisstatqry_check_ready (MMBaseModem *modem,
                                  GAsyncResult *res,
@@ -218,6 +274,7 @@ connect_ndisstatqry_check_ready (MMBaseModem *modem,
     g_assert (task != NULL);
 
     ctx = g_task_get_task_data (task);
+    ctx->ndisstatqry_running = FALSE;
 
     /* Balance refcount */
     g_object_unref (self);
@@ -236,8 +293,8 @@ connect_ndisstatqry_check_ready (MMBaseModem *modem,
         g_error_free (error);
     }
 
-    /* Connected in IPv4? */
-    if (ipv4_available && ipv4_connected) {
+    /* Connected in IPv4? (either queried or reported in the meantime) */
+    if ((ipv4_available && ipv4_connected) || ctx->ndisstat_connected) {
         /* Success! */
         ctx->step++;
         connect_3gpp_context_step (task);
@@ -245,9 +302,9 @@ connect_ndisstatqry_check_ready (MMBaseModem *modem,
     }
 
     /* Setup timeout to retry the same step */
-    g_timeout_add_seconds (1,
-                           (GSourceFunc)connect_retry_ndisstatqry_check_cb,
-                           g_object_ref (self));
+    ctx->retry_id = g_timeout_add_seconds (get_ndisstatqry_retry_timeout (ctx->modem),
+                                           (GSourceFunc)connect_retry_ndisstatqry_check_cb,
+                                           self);
 }
 
 static void
@@ -408,11 +465,13 @@ connect_3gpp_context_step (GTask *task)
     }
 
     case CONNECT_3GPP_CONTEXT_STEP_NDISSTATQRY:
-        /* Wait for dial up timeout, retries for 180 times
-         * (1s between the retries, so it means 3 minutes).
-         * If too many retries, failed
+        /* Wait for dial up timeout (3 minutes), either until ^NDISSTAT is
+         * received or until ^NDISSTATQRY? reports connected.
+         * If too long, failed
          */
-        if (ctx->check_count > MM_BASE_BEARER_DEFAULT_CONNECTION_TIMEOUT) {
+        if (!ctx->timer)
+            ctx->timer = g_timer_new ();
+        if (g_timer_elapsed (ctx->timer, NULL) > MM_BASE_BEARER_DEFAULT_CONNECTION_TIMEOUT) {
             /* Clear context */
             self->priv->connect_pending = NULL;
             g_task_return_new_error (task,
@@ -436,7 +495,7 @@ connect_3gpp_context_step (GTask *task)
         }
 
         /* Check if connected */
-        ctx->check_count++;
+        ctx->ndisstatqry_running = TRUE;
         mm_base_modem_at_command_full (ctx->modem,
                                        ctx->primary,
                                        "^NDISSTATQRY?",
@@ -546,13 +605,19 @@ typedef struct {
     MMBaseModem *modem;
     MMPortSerialAt *primary;
     Disconnect3gppContextStep step;
-    guint check_count;
+    GTimer *timer;
+    guint retry_id;
+    gboolean ndisstatqry_running;
+    gboolean ndisstat_disconnected;
     guint failed_ndisstatqry_count;
 } Disconnect3gppContext;
 
 static void
 disconnect_3gpp_context_free (Disconnect3gppContext *ctx)
 {
+    g_assert (!ctx->retry_id);
+    if (ctx->timer)
+        g_timer_destroy (ctx->timer);
     g_object_unref (ctx->primary);
     g_object_unref (ctx->modem);
     g_slice_free (Disconnect3gppContext, ctx);
@@ -572,19 +637,52 @@ static gboolean
 disconnect_retry_ndisstatqry_check_cb (MMBroadbandBearerHuawei *self)
 {
     GTask *task;
+    Disconnect3gppContext *ctx;
 
     /* Recover context */
     task = self->priv->disconnect_pending;
     g_assert (task != NULL);
 
-    /* Balance refcount */
-    g_object_unref (self);
+    ctx = g_task_get_task_data (task);
+    ctx->retry_id = 0;
 
     /* Retry same step */
     disconnect_3gpp_context_step (task);
     return G_SOURCE_REMOVE;
 }
 
+static void
+disconnect_ndisstat_received (MMBroadbandBearerHuawei  *self,
+                              MMBearerConnectionStatus  status)
+{
+    GTask *task;
+    Disconnect3gppContext *ctx;
+
+    task = self->priv->disconnect_pending;
+    ctx = g_task_get_task_data (task);
+
+    /* Only a 'DISCONNECTED' report while waiting for the disconnection is relevant */
+    if (ctx->step != DISCONNECT_3GPP_CONTEXT_STEP_NDISSTATQRY ||
+        status != MM_BEARER_CONNECTION_STATUS_DISCONNECTED)
+        return;
+
+    mm_obj_dbg (self, "received ^NDISSTAT (disconnected) while disconnecting");
+
+    /* If a query is ongoing, let its response handler go on */
+    if (ctx->ndisstatqry_running) {
+        ctx->ndisstat_disconnected = TRUE;
+        return;
+    }
+
+    /* Otherwise, cancel the retry and go on right away */
+    g_assert (ctx->retry_id);
+    g_source_remove (ctx->retry_id);
+    ctx->retry_id = 0;
+
+    ctx->step++;
+    disconnect_3gpp_context_step (task);
+}
+
 static void
 disconnect_ndisstatqry_check_ready (MMBaseModem *modem,
                                     GAsyncResult *res,
@@ -603,6 +701,7 @@ disconnect_ndisstatqry_check_ready (MMBaseModem *modem,
     g_assert (task != NULL);
 
     ctx = g_task_get_task_data (task);
+    ctx->ndisstatqry_running = FALSE;
 
     /* Balance refcount */
     g_object_unref (self);
@@ -621,8 +720,8 @@ disconnect_ndisstatqry_check_ready (MMBaseModem *modem,
         g_error_free (error);
     }
 
-    /* Disconnected IPv4? */
-    if (ipv4_available && !ipv4_connected) {
+    /* Disconnected IPv4? (either queried or reported in the meantime) */
+    if ((ipv4_available && !ipv4_connected) || ctx->ndisstat_disconnected) {
         /* Success! */
         ctx->step++;
         disconnect_3gpp_context_step (task);
@@ -630,9 +729,9 @@ disconnect_ndisstatqry_check_ready (MMBaseModem *modem,
     }
 
     /* Setup timeout to retry the same step */
-    g_timeout_add_seconds (1,
-                           (GSourceFunc)disconnect_retry_ndisstatqry_check_cb,
-                           g_object_ref (self));
+    ctx->retry_id = g_timeout_add_seconds (get_ndisstatqry_retry_timeout (ctx->modem),
+                                           (GSourceFunc)disconnect_retry_ndisstatqry_check_cb,
+                                           self);
 }
 
 static void
@@ -691,8 +790,10 @@ disconnect_3gpp_context_step (GTask *task)
         return;
 
     case DISCONNECT_3GPP_CONTEXT_STEP_NDISSTATQRY:
-        /* If too many retries (1s of wait between the retries), failed */
-        if (ctx->check_count > MM_BASE_BEARER_DEFAULT_DISCONNECTION_TIMEOUT) {
+        /* If waiting for too long, failed */
+        if (!ctx->timer)
+            ctx->timer = g_timer_new ();
+        if (g_timer_elapsed (ctx->timer, NULL) > MM_BASE_BEARER_DEFAULT_DISCONNECTION_TIMEOUT) {
             /* Clear task */
             self->priv->disconnect_pending = NULL;
             g_task_return_new_error (task,
@@ -716,7 +817,7 @@ disconnect_3gpp_context_step (GTask *task)
         }
 
         /* Check if disconnected */
-        ctx->check_count++;
+        ctx->ndisstatqry_running = TRUE;
         mm_base_modem_at_command_full (ctx->modem,
                                        ctx->primary,
                                        "^NDISSTATQRY?",
@@ -787,11 +888,17 @@ report_connection_status (MMBaseBearer             *bearer,
               status == MM_BEARER_CONNECTION_STATUS_DISCONNECTING ||
               status == MM_BEARER_CONNECTION_STATUS_DISCONNECTED);
 
-    /* When a pending connection / disconnection attempt is in progress, we use
-     * ^NDISSTATQRY? to check the connection status and thus temporarily ignore
-     * ^NDISSTAT unsolicited messages */
-    if (self->priv->connect_pending || self->priv->disconnect_pending)
+    /* When a pending connection / disconnection attempt is in progress, the
+     * ^NDISSTAT unsolicited messages may complete it right away; otherwise
+     * they're ignored and we rely on ^NDISSTATQRY? */
+    if (self->priv->connect_pending) {
+        connect_ndisstat_received (self, status);
         return;
+    }
+    if (self->priv->disconnect_pending) {
+        disconnect_ndisstat_received (self, status);
+        return;
+    }
 
     mm_obj_dbg (self, "received spontaneous ^NDISSTAT (%s)", mm_bearer_connection_status_get_string (status));
 
@@ -134,6 +134,8 @@ struct _MMBroadbandModemHuaweiPrivate {
     GRegex *lwurc_regex;
 
     FeatureSupport ndisdup_support;
+    /* Whether ^NDISSTAT URCs have been received */
+    gboolean ndisstat_reported;
     FeatureSupport rfswitch_support;
     FeatureSupport sysinfoex_support;
     FeatureSupport syscfg_support;
@@ -185,6 +187,14 @@ mm_broadband_modem_huawei_get_at_port_list (MMBroadbandModemHuawei *self)
 
 /*****************************************************************************/
 
+gboolean
+mm_broadband_modem_huawei_get_ndisstat_reported (MMBroadbandModemHuawei *self)
+{
+    return self->priv->ndisstat_reported;
+}
+
+/*****************************************************************************/
+
 typedef struct {
     gboolean extended;
     guint srv_status;
@@ -708,12 +718,59 @@ modem_after_sim_unlock_finish (MMIfaceModem *self,
     return g_task_propagate_boolean (G_TASK (res), error);
 }
 
-static gboolean
-after_sim_unlock_wait_cb (GTask *task)
+static void
+simst_received (MMPortSerialAt         *port,
+                GMatchInfo             *match_info,
+                MMBroadbandModemHuawei *self)
 {
-    g_task_return_boolean (task, TRUE);
+    guint sim_state = 0;
+
+    if (!mm_get_uint_from_match_info (match_info, 1, &sim_state))
+        return;
+
+    mm_obj_dbg (self, "SIM state reported: %u", sim_state);
+
+    /* 0: invalid SIM, 1: valid SIM, 2: invalid in CS, 3: invalid in PS,
+     * 4: invalid in PS and CS, 240: ROMSIM, 255: SIM not present. All
+     * states where the card itself is usable mean the SIM is ready. */
+    mm_iface_modem_report_sim_ready (MM_IFACE_MODEM (self),
+                                     ((sim_state >= 1 && sim_state <= 4) || sim_state == 240));
+}
+
+static void
+set_simst_unsolicited_events_handler (MMBroadbandModemHuawei *self,
+                                      gboolean                enable)
+{
+    GList *ports, *l;
+
+    ports = mm_broadband_modem_huawei_get_at_port_list (self);
+
+    /* When disabled, ^SIMST is still consumed, just ignored */
+    for (l = ports; l; l = g_list_next (l))
+        mm_port_serial_at_add_unsolicited_msg_handler (
+            MM_PORT_SERIAL_AT (l->data),
+            self->priv->simst_regex,
+            enable ? (MMPortSerialAtUnsolicitedMsgFn)simst_received : NULL,
+            enable ? self : NULL,
+            NULL);
+
+    g_list_free_full (ports, g_object_unref);
+}
+
+static void
+after_sim_unlock_wait_ready (MMIfaceModem *self,
+                             GAsyncResult *res,
+                             GTask        *task)
+{
+    GError *error = NULL;
+
+    set_simst_unsolicited_events_handler (MM_BROADBAND_MODEM_HUAWEI (self), FALSE);
+
+    if (!mm_iface_modem_wait_sim_ready_finish (self, res, &error))
+        g_task_return_error (task, error);
+    else
+        g_task_return_boolean (task, TRUE);
     g_object_unref (task);
-    return G_SOURCE_REMOVE;
 }
 
 static void
@@ -725,9 +782,21 @@ modem_after_sim_unlock (MMIfaceModem *self,
 
     task = g_task_new (self, NULL, callback, user_data);
 
-    /* A 3-second wait is necessary for SIM to become ready, or the firmware may
-     * fail miserably and reboot itself */
-    g_timeout_add_seconds (3, (GSourceFunc)after_sim_unlock_wait_cb, task);
+    /* The SIM must be ready before going on, or the firmware may fail
+     * miserably and reboot itself. The ^SIMST URC tells us when it is, but
+     * it is also emitted with a valid state while the SIM is still locked,
+     * so only ^SIMST URCs received from now on are honoured; any earlier
+     * readiness report is dropped. Otherwise, wait up to 3 seconds as we
+     * always did. */
+    mm_iface_modem_report_sim_ready (self, FALSE);
+    set_simst_unsolicited_events_handler (MM_BROADBAND_MODEM_HUAWEI (self), TRUE);
+
+    mm_iface_modem_wait_sim_ready (self,
+                                   3,
+                                   NULL,
+                                   NULL,
+                                   (GAsyncReadyCallback)after_sim_unlock_wait_ready,
+                                   task);
 }
 
 /*****************************************************************************/
@@ -1677,6 +1746,8 @@ huawei_ndisstat_changed (MMPortSerialAt *port,
     }
     g_free (str);
 
+    self->priv->ndisstat_reported = TRUE;
+
     mm_obj_dbg (self, "NDIS status: IPv4 %s, IPv6 %s",
                 ndisstat_result.ipv4_available ?
                 (ndisstat_result.ipv4_connected ? "connected" : "disconnected") : "not available",
@@ -4486,7 +4557,7 @@ mm_broadband_modem_huawei_init (MMBroadbandModemHuawei *self)
                                               G_REGEX_RAW | G_REGEX_OPTIMIZE, 0, NULL);
     self->priv->dsdormant_regex = g_regex_new ("\\r\\n\\^DSDORMANT:.+\\r\\n",
                                                G_REGEX_RAW | G_REGEX_OPTIMIZE, 0, NULL);
-    self->priv->simst_regex = g_regex_new ("\\r\\n\\^SIMST:.+\\r\\n",
+    self->priv->simst_regex = g_regex_new ("\\r\\n\\^SIMST:\\s*(\\d+).*\\r\\n",
                                            G_REGEX_RAW | G_REGEX_OPTIMIZE, 0, NULL);
     self->priv->srvst_regex = g_regex_new ("\\r\\n\\^SRVST:.+\\r\\n",
                                            G_REGEX_RAW | G_REGEX_OPTIMIZE, 0, NULL);
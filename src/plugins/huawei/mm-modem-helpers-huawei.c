@@ -25,12 +25,18 @@
 #include "mm-log-object.h"
 #include "mm-common-helpers.h"
 #include "mm-modem-helpers.h"
+#include "mm-regex.h"
 #include "mm-modem-helpers-huawei.h"
 #include "mm-huawei-enums-types.h"
 
 /*****************************************************************************/
 /* ^NDISSTAT /  ^NDISSTATQRY response parser */
 
+#define NDISSTATQRY_MULTIPLE_REGEX \
+    "\\^NDISSTAT(?:QRY)?(?:Qry)?:\\s*(\\d),([^,]*),([^,]*),([^,\\r\\n]*)(?:\\r\\n)?" \
+    "(?:\\^NDISSTAT:|\\^NDISSTATQRY:)?\\s*,?(\\d)?,?([^,]*)?,?([^,]*)?,?([^,\\r\\n]*)?(?:\\r\\n)?"
+#define NDISSTATQRY_SINGLE_REGEX "\\^NDISSTAT(?:QRY)?(?:Qry)?:\\s*(\\d)(?:\\r\\n)?"
+
 gboolean
 mm_huawei_parse_ndisstatqry_response (const gchar *response,
                                       gboolean *ipv4_available,
@@ -72,10 +78,9 @@ mm_huawei_parse_ndisstatqry_response (const gchar *response,
         g_autoptr(GRegex)     r = NULL;
         g_autoptr(GMatchInfo) match_info = NULL;
 
-        r = g_regex_new ("\\^NDISSTAT(?:QRY)?(?:Qry)?:\\s*(\\d),([^,]*),([^,]*),([^,\\r\\n]*)(?:\\r\\n)?"
-                         "(?:\\^NDISSTAT:|\\^NDISSTATQRY:)?\\s*,?(\\d)?,?([^,]*)?,?([^,]*)?,?([^,\\r\\n]*)?(?:\\r\\n)?",
-                         G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW,
-                         0, NULL);
+        r = mm_regex_get (NDISSTATQRY_MULTIPLE_REGEX,
+                          G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW,
+                          0);
         g_assert (r != NULL);
 
         g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -115,9 +120,9 @@ mm_huawei_parse_ndisstatqry_response (const gchar *response,
         g_autoptr(GRegex)     r = NULL;
         g_autoptr(GMatchInfo) match_info = NULL;
 
-        r = g_regex_new ("\\^NDISSTAT(?:QRY)?(?:Qry)?:\\s*(\\d)(?:\\r\\n)?",
-                         G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW,
-                         0, NULL);
+        r = mm_regex_get (NDISSTATQRY_SINGLE_REGEX,
+                          G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW,
+                          0);
         g_assert (r != NULL);
 
         g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -197,6 +202,8 @@ match_info_to_ip4_addr (GMatchInfo *match_info,
     return TRUE;
 }
 
+#define DHCP_REGEX "\\^DHCP:\\s*(?:0[xX])?([0-9a-fA-F]+),(?:0[xX])?([0-9a-fA-F]+),(?:0[xX])?([0-9a-fA-F]+),(?:0[xX])?([0-9a-fA-F]+),(?:0[xX])?([0-9a-fA-F]+),(?:0[xX])?([0-9a-fA-F]+),.*$"
+
 gboolean
 mm_huawei_parse_dhcp_response (const char *reply,
                                guint *out_address,
@@ -228,7 +235,7 @@ mm_huawei_parse_dhcp_response (const char *reply,
      * actually 10.10.1.1.
      */
 
-    r = g_regex_new ("\\^DHCP:\\s*(?:0[xX])?([0-9a-fA-F]+),(?:0[xX])?([0-9a-fA-F]+),(?:0[xX])?([0-9a-fA-F]+),(?:0[xX])?([0-9a-fA-F]+),(?:0[xX])?([0-9a-fA-F]+),(?:0[xX])?([0-9a-fA-F]+),.*$", 0, 0, NULL);
+    r = mm_regex_get (DHCP_REGEX, 0, 0);
     g_assert (r != NULL);
 
     matched = g_regex_match_full (r, reply, -1, 0, 0, &match_info, &match_error);
@@ -261,6 +268,8 @@ mm_huawei_parse_dhcp_response (const char *reply,
 /*****************************************************************************/
 /* ^SYSINFO response parser */
 
+#define SYSINFO_REGEX "\\^SYSINFO:\\s*(\\d+),(\\d+),(\\d+),(\\d+),(\\d+),?(\\d+)?,?(\\d+)?$"
+
 gboolean
 mm_huawei_parse_sysinfo_response (const char *reply,
                                   guint *out_srv_status,
@@ -291,7 +300,7 @@ mm_huawei_parse_sysinfo_response (const char *reply,
      */
 
     /* Can't just use \d here since sometimes you get "^SYSINFO:2,1,0,3,1,,3" */
-    r = g_regex_new ("\\^SYSINFO:\\s*(\\d+),(\\d+),(\\d+),(\\d+),(\\d+),?(\\d+)?,?(\\d+)?$", 0, 0, NULL);
+    r = mm_regex_get (SYSINFO_REGEX, 0, 0);
     g_assert (r != NULL);
 
     matched = g_regex_match_full (r, reply, -1, 0, 0, &match_info, &match_error);
@@ -325,6 +334,8 @@ mm_huawei_parse_sysinfo_response (const char *reply,
 /*****************************************************************************/
 /* ^SYSINFOEX response parser */
 
+#define SYSINFOEX_REGEX "\\^SYSINFOEX:\\s*(\\d+),(\\d+),(\\d+),(\\d+),?(\\d*),(\\d+),\"?([^\"]*)\"?,(\\d+),\"?([^\"]*)\"?$"
+
 gboolean
 mm_huawei_parse_sysinfoex_response (const char *reply,
                                     guint *out_srv_status,
@@ -356,7 +367,7 @@ mm_huawei_parse_sysinfoex_response (const char *reply,
 
     /* ^SYSINFOEX:2,3,0,1,,3,"WCDMA",41,"HSPA+" */
 
-    r = g_regex_new ("\\^SYSINFOEX:\\s*(\\d+),(\\d+),(\\d+),(\\d+),?(\\d*),(\\d+),\"?([^\"]*)\"?,(\\d+),\"?([^\"]*)\"?$", 0, 0, NULL);
+    r = mm_regex_get (SYSINFOEX_REGEX, 0, 0);
     g_assert (r != NULL);
 
     matched = g_regex_match_full (r, reply, -1, 0, 0, &match_info, &match_error);
@@ -1181,6 +1192,8 @@ mm_huawei_parse_syscfgex_response (const gchar *response,
 /*****************************************************************************/
 /* ^NWTIME response parser */
 
+#define NWTIME_REGEX "\\^NWTIME:\\s*(\\d+)/(\\d+)/(\\d+),(\\d+):(\\d+):(\\d*)([\\-\\+\\d]+),(\\d+)$"
+
 gboolean
 mm_huawei_parse_nwtime_response (const gchar        *response,
                                  gchar             **iso8601p,
@@ -1201,7 +1214,7 @@ mm_huawei_parse_nwtime_response (const gchar        *response,
 
     g_assert (iso8601p || tzp); /* at least one */
 
-    r = g_regex_new ("\\^NWTIME:\\s*(\\d+)/(\\d+)/(\\d+),(\\d+):(\\d+):(\\d*)([\\-\\+\\d]+),(\\d+)$", 0, 0, NULL);
+    r = mm_regex_get (NWTIME_REGEX, 0, 0);
     g_assert (r != NULL);
 
     if (!g_regex_match_full (r, response, -1, 0, 0, &match_info, &match_error)) {
@@ -1260,6 +1273,8 @@ mm_huawei_parse_nwtime_response (const gchar        *response,
 /*****************************************************************************/
 /* ^TIME response parser */
 
+#define TIME_REGEX "\\^TIME:\\s*(\\d+)/(\\d+)/(\\d+)\\s*(\\d+):(\\d+):(\\d*)$"
+
 gboolean
 mm_huawei_parse_time_response (const gchar        *response,
                                gchar             **iso8601p,
@@ -1288,7 +1303,7 @@ mm_huawei_parse_time_response (const gchar        *response,
     }
 
     /* Already in ISO-8601 format, but verify just to be sure */
-    r = g_regex_new ("\\^TIME:\\s*(\\d+)/(\\d+)/(\\d+)\\s*(\\d+):(\\d+):(\\d*)$", 0, 0, NULL);
+    r = mm_regex_get (TIME_REGEX, 0, 0);
     g_assert (r != NULL);
 
     if (!g_regex_match_full (r, response, -1, 0, 0, &match_info, &match_error)) {
@@ -1335,6 +1350,8 @@ mm_huawei_parse_time_response (const gchar        *response,
 /*****************************************************************************/
 /* ^HCSQ response parser */
 
+#define HCSQ_REGEX "\\^HCSQ:\\s*\"?([a-zA-Z]*)\"?,(\\d+),?(\\d+)?,?(\\d+)?,?(\\d+)?,?(\\d+)?$"
+
 gboolean
 mm_huawei_parse_hcsq_response (const gchar *response,
                                MMModemAccessTechnology *out_act,
@@ -1349,7 +1366,7 @@ mm_huawei_parse_hcsq_response (const gchar *response,
     g_autoptr(GMatchInfo)  match_info = NULL;
     GError                *match_error = NULL;
 
-    r = g_regex_new ("\\^HCSQ:\\s*\"?([a-zA-Z]*)\"?,(\\d+),?(\\d+)?,?(\\d+)?,?(\\d+)?,?(\\d+)?$", 0, 0, NULL);
+    r = mm_regex_get (HCSQ_REGEX, 0, 0);
     g_assert (r != NULL);
 
     if (!g_regex_match_full (r, response, -1, 0, 0, &match_info, &match_error)) {
@@ -1394,6 +1411,8 @@ mm_huawei_parse_hcsq_response (const gchar *response,
 /*****************************************************************************/
 /* ^CVOICE response parser */
 
+#define CVOICE_REGEX "\\^CVOICE:\\s*(\\d)\\s*,\\s*(\\d+)\\s*,\\s*(\\d+)\\s*,\\s*(\\d+)$"
+
 gboolean
 mm_huawei_parse_cvoice_response (const gchar  *response,
                                  guint        *out_hz,
@@ -1408,7 +1427,7 @@ mm_huawei_parse_cvoice_response (const gchar  *response,
     guint                  bits = 0;
 
     /* ^CVOICE: <0=supported,1=unsupported>,<hz>,<bits>,<unknown> */
-    r = g_regex_new ("\\^CVOICE:\\s*(\\d)\\s*,\\s*(\\d+)\\s*,\\s*(\\d+)\\s*,\\s*(\\d+)$", 0, 0, NULL);
+    r = mm_regex_get (CVOICE_REGEX, 0, 0);
     g_assert (r != NULL);
 
     if (!g_regex_match_full (r, response, -1, 0, 0, &match_info, &match_error)) {
@@ -1544,3 +1563,25 @@ mm_huawei_parse_getportmode_response (const gchar  *response,
 
     return g_steal_pointer (&modes);
 }
+
+/*****************************************************************************/
+
+/* Every constant pattern used by the parsers above, with the exact same flags
+ * as in the call site */
+static const MMRegexPattern warm_up_patterns[] = {
+    { NDISSTATQRY_MULTIPLE_REGEX, G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0 },
+    { NDISSTATQRY_SINGLE_REGEX, G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0 },
+    { DHCP_REGEX, 0, 0 },
+    { SYSINFO_REGEX, 0, 0 },
+    { SYSINFOEX_REGEX, 0, 0 },
+    { NWTIME_REGEX, 0, 0 },
+    { TIME_REGEX, 0, 0 },
+    { HCSQ_REGEX, 0, 0 },
+    { CVOICE_REGEX, 0, 0 },
+};
+
+void
+mm_huawei_warm_up (void)
+{
+    mm_regex_warm_up (warm_up_patterns, G_N_ELEMENTS (warm_up_patterns));
+}
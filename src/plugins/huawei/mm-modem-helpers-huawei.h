@@ -190,4 +190,9 @@ GArray *mm_huawei_parse_getportmode_response (const gchar  *response,
                                               gpointer      log_object,
                                               GError      **error);
 
+/*****************************************************************************/
+/* Regex warm-up */
+
+void mm_huawei_warm_up (void);
+
 #endif  /* MM_MODEM_HELPERS_HUAWEI_H */
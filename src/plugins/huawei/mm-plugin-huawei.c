@@ -29,6 +29,7 @@
 #include "mm-plugin-common.h"
 #include "mm-broadband-modem-huawei.h"
 #include "mm-modem-helpers-huawei.h"
+#include "mm-context.h"
 #include "mm-huawei-enums-types.h"
 
 #if defined WITH_QMI
@@ -705,6 +706,10 @@ mm_plugin_create_huawei (void)
         .finish = G_CALLBACK (huawei_custom_init_finish),
     };
 
+    /* Compile the plugin specific parser regexes in advance, if requested */
+    if (mm_context_get_regex_warm_up ())
+        mm_huawei_warm_up ();
+
     return MM_PLUGIN (
         g_object_new (MM_TYPE_PLUGIN_HUAWEI,
                       MM_PLUGIN_NAME,               MM_MODULE_NAME,
@@ -26,6 +26,7 @@
 #include "mm-log-object.h"
 #include "mm-modem-helpers.h"
 #include "mm-modem-helpers-huawei.h"
+#include "mm-regex.h"
 
 /*****************************************************************************/
 /* Test ^NDISSTAT / ^NDISSTATQRY responses */
@@ -1249,6 +1250,47 @@ test_hcsq (void)
     }
 }
 
+/*****************************************************************************/
+/* Test ^CVOICE responses */
+
+typedef struct {
+    const gchar *str;
+    gboolean     ret;
+    guint        hz;
+    guint        bits;
+} CvoiceTest;
+
+static const CvoiceTest cvoice_tests[] = {
+    { "^CVOICE:0,8000,16,1",        TRUE,  8000, 16 },
+    { "^CVOICE: 0, 16000, 16, 20",  TRUE, 16000, 16 },
+    { "^CVOICE:1,8000,16,1",        FALSE,    0,  0 },
+    { "^CVOICE:0",                  FALSE,    0,  0 },
+    { NULL,                         FALSE,    0,  0 }
+};
+
+static void
+test_cvoice (void)
+{
+    guint i;
+
+    for (i = 0; cvoice_tests[i].str; i++) {
+        GError *error = NULL;
+        guint hz = 0;
+        guint bits = 0;
+        gboolean ret;
+
+        ret = mm_huawei_parse_cvoice_response (cvoice_tests[i].str, &hz, &bits, &error);
+        g_assert (ret == cvoice_tests[i].ret);
+        if (ret) {
+            g_assert_no_error (error);
+            g_assert_cmpuint (cvoice_tests[i].hz, ==, hz);
+            g_assert_cmpuint (cvoice_tests[i].bits, ==, bits);
+        } else
+            g_assert (error);
+        g_clear_error (&error);
+    }
+}
+
 /*****************************************************************************/
 /* Test ^GETPORTMODE response */
 
@@ -1395,6 +1437,23 @@ test_getportmode (void)
     }
 }
 
+/*****************************************************************************/
+/* Test regex warm-up coverage */
+
+static void
+test_regex_warm_up_coverage (void)
+{
+    g_auto(GStrv) unrequested = NULL;
+    guint         i;
+
+    /* Each pattern warmed up in main() must have been requested by one of the
+     * parsers exercised by the previous tests */
+    unrequested = mm_regex_list_unrequested ();
+    for (i = 0; unrequested[i]; i++)
+        g_test_message ("warmed pattern never requested: %s", unrequested[i]);
+    g_assert_cmpuint (g_strv_length (unrequested), ==, 0);
+}
+
 /*****************************************************************************/
 
 int main (int argc, char **argv)
@@ -1403,6 +1462,10 @@ int main (int argc, char **argv)
 
     g_test_init (&argc, &argv, NULL);
 
+    /* Warm up before running any parser, so that the coverage test can
+     * validate the warm-up table against the real call sites */
+    mm_huawei_warm_up ();
+
     g_test_add_func ("/MM/huawei/ndisstatqry", test_ndisstatqry);
     g_test_add_func ("/MM/huawei/dhcp", test_dhcp);
     g_test_add_func ("/MM/huawei/sysinfo", test_sysinfo);
@@ -1416,7 +1479,11 @@ int main (int argc, char **argv)
     g_test_add_func ("/MM/huawei/nwtime", test_nwtime);
     g_test_add_func ("/MM/huawei/time", test_time);
     g_test_add_func ("/MM/huawei/hcsq", test_hcsq);
+    g_test_add_func ("/MM/huawei/cvoice", test_cvoice);
     g_test_add_func ("/MM/huawei/getportmode", test_getportmode);
 
+    /* Must run after all the parser tests */
+    g_test_add_func ("/MM/huawei/regex/warm-up", test_regex_warm_up_coverage);
+
     return g_test_run ();
 }
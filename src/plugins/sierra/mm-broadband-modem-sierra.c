@@ -906,11 +906,51 @@ modem_after_sim_unlock_finish (MMIfaceModem *self,
 }
 
 static gboolean
-after_sim_unlock_wait_cb (GTask *task)
+sim_ready_check_finish (MMIfaceModem  *self,
+                        GAsyncResult  *res,
+                        GError       **error)
 {
-    g_task_return_boolean (task, TRUE);
+    const gchar      *response;
+    g_autofree gchar *hex = NULL;
+    guint             sw1 = 0;
+    guint             sw2 = 0;
+
+    response = mm_base_modem_at_command_finish (MM_BASE_MODEM (self), res, error);
+    if (!response || !mm_3gpp_parse_crsm_response (response, &sw1, &sw2, &hex, error))
+        return FALSE;
+
+    return ((sw1 == 0x90 && sw2 == 0x00) || (sw1 == 0x91) || (sw1 == 0x92) || (sw1 == 0x9f));
+}
+
+static void
+sim_ready_check (MMIfaceModem        *self,
+                 GAsyncReadyCallback  callback,
+                 gpointer             user_data)
+{
+    /* EFiccid is always readable, even before the PIN is verified, so probe
+     * EFimsi instead: its READ BINARY requires CHV1, and therefore succeeds
+     * only once the SIM has really completed the unlock. Until then the card
+     * replies with 0x69 0x82 (security status not satisfied) and we retry. */
+    mm_base_modem_at_command (MM_BASE_MODEM (self),
+                              "+CRSM=176,28423,0,0,9",
+                              3,
+                              FALSE,
+                              callback,
+                              user_data);
+}
+
+static void
+after_sim_unlock_wait_ready (MMIfaceModem *self,
+                             GAsyncResult *res,
+                             GTask        *task)
+{
+    GError *error = NULL;
+
+    if (!mm_iface_modem_wait_sim_ready_finish (self, res, &error))
+        g_task_return_error (task, error);
+    else
+        g_task_return_boolean (task, TRUE);
     g_object_unref (task);
-    return G_SOURCE_REMOVE;
 }
 
 static void
@@ -920,23 +960,32 @@ modem_after_sim_unlock (MMIfaceModem *self,
 {
     GTask *task;
     guint timeout = 8;
+    gboolean sierra_net = FALSE;
     const gchar **drivers;
     guint i;
 
     /* A short wait is necessary for SIM to become ready, otherwise some older
      * cards (AC881) crash if asked to connect immediately after sending the
      * PIN.  Assume sierra_net driven devices are better and don't need as long
-     * a delay.
+     * a delay; in these we also stop waiting as soon as the PIN-protected
+     * SIM files can be read.
      */
     drivers = mm_base_modem_get_drivers (MM_BASE_MODEM (self));
     for (i = 0; drivers[i]; i++) {
-        if (g_str_equal (drivers[i], "sierra_net"))
+        if (g_str_equal (drivers[i], "sierra_net")) {
+            sierra_net = TRUE;
             timeout = 3;
+        }
     }
 
     task = g_task_new (self, NULL, callback, user_data);
 
-    g_timeout_add_seconds (timeout, (GSourceFunc)after_sim_unlock_wait_cb, task);
+    mm_iface_modem_wait_sim_ready (self,
+                                   timeout,
+                                   sierra_net ? sim_ready_check : NULL,
+                                   sierra_net ? sim_ready_check_finish : NULL,
+                                   (GAsyncReadyCallback)after_sim_unlock_wait_ready,
+                                   task);
 }
 
 /*****************************************************************************/
@@ -18,11 +18,14 @@
 
 #include "mm-log.h"
 #include "mm-modem-helpers.h"
+#include "mm-regex.h"
 #include "mm-modem-helpers-ublox.h"
 
 /*****************************************************************************/
 /* +UPINCNT response parser */
 
+#define UPINCNT_REGEX "\\+UPINCNT: (\\d+),(\\d+),(\\d+),(\\d+)(?:\\r\\n)?"
+
 gboolean
 mm_ublox_parse_upincnt_response (const gchar  *response,
                                  guint        *out_pin_attempts,
@@ -48,7 +51,7 @@ mm_ublox_parse_upincnt_response (const gchar  *response,
     /* Response may be e.g.:
      * +UPINCNT: 3,3,10,10
      */
-    r = g_regex_new ("\\+UPINCNT: (\\d+),(\\d+),(\\d+),(\\d+)(?:\\r\\n)?", 0, 0, NULL);
+    r = mm_regex_get (UPINCNT_REGEX, 0, 0);
     g_assert (r != NULL);
 
     g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -99,6 +102,8 @@ out:
 /*****************************************************************************/
 /* UUSBCONF? response parser */
 
+#define UUSBCONF_REGEX "\\+UUSBCONF: (\\d+),([^,]*),([^,]*),([^,]*)(?:\\r\\n)?"
+
 gboolean
 mm_ublox_parse_uusbconf_response (const gchar        *response,
                                   MMUbloxUsbProfile  *out_profile,
@@ -119,7 +124,7 @@ mm_ublox_parse_uusbconf_response (const gchar        *response,
      * Note: we don't rely on the PID; assuming future new modules will
      * have a different PID but they may keep the profile names.
      */
-    r = g_regex_new ("\\+UUSBCONF: (\\d+),([^,]*),([^,]*),([^,]*)(?:\\r\\n)?", 0, 0, NULL);
+    r = mm_regex_get (UUSBCONF_REGEX, 0, 0);
     g_assert (r != NULL);
 
     g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -157,6 +162,8 @@ mm_ublox_parse_uusbconf_response (const gchar        *response,
 /*****************************************************************************/
 /* UBMCONF? response parser */
 
+#define UBMCONF_REGEX "\\+UBMCONF: (\\d+)(?:\\r\\n)?"
+
 gboolean
 mm_ublox_parse_ubmconf_response (const gchar            *response,
                                  MMUbloxNetworkingMode  *out_mode,
@@ -173,7 +180,7 @@ mm_ublox_parse_ubmconf_response (const gchar            *response,
      * +UBMCONF: 1
      * +UBMCONF: 2
      */
-    r = g_regex_new ("\\+UBMCONF: (\\d+)(?:\\r\\n)?", 0, 0, NULL);
+    r = mm_regex_get (UBMCONF_REGEX, 0, 0);
     g_assert (r != NULL);
 
     g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -214,6 +221,8 @@ mm_ublox_parse_ubmconf_response (const gchar            *response,
 /*****************************************************************************/
 /* UIPADDR=N response parser */
 
+#define UIPADDR_REGEX "\\+UIPADDR: (\\d+),([^,]*),([^,]*),([^,]*),([^,]*),([^,]*)(?:\\r\\n)?"
+
 gboolean
 mm_ublox_parse_uipaddr_response (const gchar  *response,
                                  guint        *out_cid,
@@ -241,7 +250,7 @@ mm_ublox_parse_uipaddr_response (const gchar  *response,
      *
      * We assume only ONE line is returned; because we request +UIPADDR with a specific N CID.
      */
-    r = g_regex_new ("\\+UIPADDR: (\\d+),([^,]*),([^,]*),([^,]*),([^,]*),([^,]*)(?:\\r\\n)?", 0, 0, NULL);
+    r = mm_regex_get (UIPADDR_REGEX, 0, 0);
     g_assert (r != NULL);
 
     g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -1515,6 +1524,8 @@ uact_num_array_to_band_array (GArray *nums)
     return bands;
 }
 
+#define UACT_REGEX "\\+UACT: ([^,]*),([^,]*),([^,]*),(.*)(?:\\r\\n)?"
+
 GArray *
 mm_ublox_parse_uact_response (const gchar  *response,
                               GError      **error)
@@ -1529,8 +1540,8 @@ mm_ublox_parse_uact_response (const gchar  *response,
      * AT+UACT?
      * +UACT: ,,,900,1800,1,8,101,103,107,108,120,138
      */
-    r = g_regex_new ("\\+UACT: ([^,]*),([^,]*),([^,]*),(.*)(?:\\r\\n)?",
-                     G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0, NULL);
+    r = mm_regex_get (UACT_REGEX,
+                      G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0);
     g_assert (r != NULL);
 
     g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -1614,8 +1625,8 @@ mm_ublox_parse_uact_test (const gchar  *response,
      * AT+UACT=?
      * +UACT: ,,,(900,1800),(1,8),(101,103,107,108,120),(138)
      */
-    r = g_regex_new ("\\+UACT: ([^,]*),([^,]*),([^,]*),(.*)(?:\\r\\n)?",
-                     G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0, NULL);
+    r = mm_regex_get (UACT_REGEX,
+                      G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0);
     g_assert (r != NULL);
 
     g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -1713,6 +1724,8 @@ mm_ublox_build_uact_set_command (GArray  *bands,
 /*****************************************************************************/
 /* URAT? response parser */
 
+#define URAT_READ_REGEX "\\+URAT: (\\d+)(?:,(\\d+))?(?:\\r\\n)?"
+
 gboolean
 mm_ublox_parse_urat_read_response (const gchar  *response,
                                    gpointer      log_object,
@@ -1734,7 +1747,7 @@ mm_ublox_parse_urat_read_response (const gchar  *response,
      * +URAT: 1,2
      * +URAT: 1
      */
-    r = g_regex_new ("\\+URAT: (\\d+)(?:,(\\d+))?(?:\\r\\n)?", 0, 0, NULL);
+    r = mm_regex_get (URAT_READ_REGEX, 0, 0);
     g_assert (r != NULL);
 
     g_regex_match_full (r, response, strlen (response), 0, 0, &match_info, &inner_error);
@@ -1925,6 +1938,8 @@ out:
 /*****************************************************************************/
 /* +UGCNTRD response parser */
 
+#define UGCNTRD_REGEX "\\+UGCNTRD:\\s*(\\d+),\\s*(\\d+),\\s*(\\d+),\\s*(\\d+),\\s*(\\d+)"
+
 gboolean
 mm_ublox_parse_ugcntrd_response_for_cid (const gchar  *response,
                                          guint         in_cid,
@@ -1947,8 +1962,8 @@ mm_ublox_parse_ugcntrd_response_for_cid (const gchar  *response,
      *  +UGCNTRD: 31,2704,1819,2724,1839
      * We assume only ONE line is returned.
      */
-    r = g_regex_new ("\\+UGCNTRD:\\s*(\\d+),\\s*(\\d+),\\s*(\\d+),\\s*(\\d+),\\s*(\\d+)",
-                     G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0, NULL);
+    r = mm_regex_get (UGCNTRD_REGEX,
+                      G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0);
     g_assert (r != NULL);
 
     /* Report invalid CID given */
@@ -2012,3 +2027,23 @@ out:
         *out_total_rx_bytes = total_rx_bytes;
     return TRUE;
 }
+
+/*****************************************************************************/
+
+/* Every constant pattern used by the parsers above, with the exact same flags
+ * as in the call site */
+static const MMRegexPattern warm_up_patterns[] = {
+    { UPINCNT_REGEX, 0, 0 },
+    { UUSBCONF_REGEX, 0, 0 },
+    { UBMCONF_REGEX, 0, 0 },
+    { UIPADDR_REGEX, 0, 0 },
+    { UACT_REGEX, G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0 },
+    { URAT_READ_REGEX, 0, 0 },
+    { UGCNTRD_REGEX, G_REGEX_DOLLAR_ENDONLY | G_REGEX_RAW, 0 },
+};
+
+void
+mm_ublox_warm_up (void)
+{
+    mm_regex_warm_up (warm_up_patterns, G_N_ELEMENTS (warm_up_patterns));
+}
@@ -210,4 +210,9 @@ gboolean mm_ublox_parse_ugcntrd_response_for_cid (const gchar  *response,
                                                   guint64      *total_rx_bytes,
                                                   GError      **error);
 
+/*****************************************************************************/
+/* Regex warm-up */
+
+void mm_ublox_warm_up (void);
+
 #endif  /* MM_MODEM_HELPERS_UBLOX_H */
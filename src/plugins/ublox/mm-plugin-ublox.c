@@ -23,6 +23,8 @@
 #include "mm-serial-parsers.h"
 #include "mm-broadband-modem-ublox.h"
 #include "mm-plugin-common.h"
+#include "mm-context.h"
+#include "mm-modem-helpers-ublox.h"
 
 #define MM_TYPE_PLUGIN_UBLOX mm_plugin_ublox_get_type ()
 MM_DEFINE_PLUGIN (UBLOX, ublox, Ublox)
@@ -238,6 +240,10 @@ mm_plugin_create_ublox (void)
         .finish = G_CALLBACK (ublox_custom_init_finish),
     };
 
+    /* Compile the plugin specific parser regexes in advance, if requested */
+    if (mm_context_get_regex_warm_up ())
+        mm_ublox_warm_up ();
+
     return MM_PLUGIN (g_object_new (MM_TYPE_PLUGIN_UBLOX,
                                     MM_PLUGIN_NAME,                   MM_MODULE_NAME,
                                     MM_PLUGIN_ALLOWED_SUBSYSTEMS,     subsystems,
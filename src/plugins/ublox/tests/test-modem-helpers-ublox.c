@@ -25,6 +25,7 @@
 #include "mm-log-test.h"
 #include "mm-modem-helpers.h"
 #include "mm-modem-helpers-ublox.h"
+#include "mm-regex.h"
 
 #include "test-helpers.h"
 
@@ -977,6 +978,23 @@ test_ugcntrd_response (void)
     }
 }
 
+/*****************************************************************************/
+/* Test regex warm-up coverage */
+
+static void
+test_regex_warm_up_coverage (void)
+{
+    g_auto(GStrv) unrequested = NULL;
+    guint         i;
+
+    /* Each pattern warmed up in main() must have been requested by one of the
+     * parsers exercised by the previous tests */
+    unrequested = mm_regex_list_unrequested ();
+    for (i = 0; unrequested[i]; i++)
+        g_test_message ("warmed pattern never requested: %s", unrequested[i]);
+    g_assert_cmpuint (g_strv_length (unrequested), ==, 0);
+}
+
 /*****************************************************************************/
 
 int main (int argc, char **argv)
@@ -985,6 +1003,10 @@ int main (int argc, char **argv)
 
     g_test_init (&argc, &argv, NULL);
 
+    /* Warm up before running any parser, so that the coverage test can
+     * validate the warm-up table against the real call sites */
+    mm_ublox_warm_up ();
+
     g_test_add_func ("/MM/ublox/upincnt/response",  test_upincnt_response);
     g_test_add_func ("/MM/ublox/uusbconf/response", test_uusbconf_response);
     g_test_add_func ("/MM/ublox/ubmconf/response",  test_ubmconf_response);
@@ -1022,5 +1044,8 @@ int main (int argc, char **argv)
     g_test_add_func ("/MM/ublox/uauthreq/test/less-fields", test_uauthreq_less_fields);
     g_test_add_func ("/MM/ublox/ugcntrd/response", test_ugcntrd_response);
 
+    /* Must run after all the parser tests */
+    g_test_add_func ("/MM/ublox/regex/warm-up", test_regex_warm_up_coverage);
+
     return g_test_run ();
 }
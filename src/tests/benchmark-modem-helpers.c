@@ -0,0 +1,175 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details:
+ *
+ * Copyright (C) 2026 The ModemManager authors
+ */
+
+#include <glib.h>
+#include <glib-object.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "modem-helpers-parsers.h"
+#include "mm-log-test.h"
+
+#define DEFAULT_ITERATIONS 2000
+
+/*****************************************************************************/
+/* Allocation counting
+ *
+ * GLib allocates through the system malloc(), so on glibc we can count the
+ * allocations done by each parser by interposing the malloc() family and
+ * forwarding to the real implementation. On other libc implementations the
+ * allocation count is not reported.
+ */
+
+#if defined (__GLIBC__)
+
+#define ALLOCATION_COUNTING_SUPPORTED 1
+
+extern void *__libc_malloc  (size_t size);
+extern void *__libc_calloc  (size_t nmemb, size_t size);
+extern void *__libc_realloc (void *ptr, size_t size);
+extern void  __libc_free    (void *ptr);
+
+static gboolean counting_enabled;
+static guint64  n_allocations;
+
+void *
+malloc (size_t size)
+{
+    if (counting_enabled)
+        n_allocations++;
+    return __libc_malloc (size);
+}
+
+void *
+calloc (size_t nmemb,
+        size_t size)
+{
+    if (counting_enabled)
+        n_allocations++;
+    return __libc_calloc (nmemb, size);
+}
+
+void *
+realloc (void   *ptr,
+         size_t  size)
+{
+    if (counting_enabled)
+        n_allocations++;
+    return __libc_realloc (ptr, size);
+}
+
+void
+free (void *ptr)
+{
+    __libc_free (ptr);
+}
+
+#else
+
+#define ALLOCATION_COUNTING_SUPPORTED 0
+
+static gboolean counting_enabled;
+static guint64  n_allocations;
+
+#endif
+
+/*****************************************************************************/
+
+static gint     iterations = DEFAULT_ITERATIONS;
+static gchar   *filter;
+
+static GOptionEntry entries[] = {
+    { "iterations", 'n', 0, G_OPTION_ARG_INT, &iterations,
+      "Number of iterations per corpus entry",
+      "[N]"
+    },
+    { "filter", 'f', 0, G_OPTION_ARG_STRING, &filter,
+      "Only run parsers whose name contains the given string",
+      "[NAME]"
+    },
+    { NULL }
+};
+
+static void
+benchmark_parser (const ParserEntry *entry)
+{
+    guint   n_inputs = 0;
+    guint   i;
+    gint    j;
+    gint64  start;
+    gint64  elapsed;
+    guint64 n_ops;
+
+    /* Warm up once, so that one-time initializations (e.g. GType
+     * registrations or quark lookups) are not accounted to the parser */
+    for (i = 0; i < G_N_ELEMENTS (entry->corpus) && entry->corpus[i]; i++) {
+        entry->run (entry->corpus[i]);
+        n_inputs++;
+    }
+    g_assert_cmpuint (n_inputs, >, 0);
+
+    n_allocations = 0;
+    counting_enabled = TRUE;
+    start = g_get_monotonic_time ();
+    for (j = 0; j < iterations; j++) {
+        for (i = 0; i < n_inputs; i++)
+            entry->run (entry->corpus[i]);
+    }
+    elapsed = g_get_monotonic_time () - start;
+    counting_enabled = FALSE;
+
+    n_ops = (guint64) iterations * n_inputs;
+
+    if (ALLOCATION_COUNTING_SUPPORTED)
+        g_print ("%-16s %10" G_GUINT64_FORMAT " ops %12.1f ns/op %10.1f allocs/op\n",
+                 entry->name,
+                 n_ops,
+                 (gdouble) elapsed * 1000.0 / (gdouble) n_ops,
+                 (gdouble) n_allocations / (gdouble) n_ops);
+    else
+        g_print ("%-16s %10" G_GUINT64_FORMAT " ops %12.1f ns/op %10s allocs/op\n",
+                 entry->name,
+                 n_ops,
+                 (gdouble) elapsed * 1000.0 / (gdouble) n_ops,
+                 "n/a");
+}
+
+int main (int argc, char **argv)
+{
+    g_autoptr(GOptionContext) context = NULL;
+    g_autoptr(GError)         error = NULL;
+    guint                     i;
+
+    context = g_option_context_new ("- AT response parser benchmark");
+    g_option_context_add_main_entries (context, entries, NULL);
+    if (!g_option_context_parse (context, &argc, &argv, &error)) {
+        g_printerr ("error: %s\n", error->message);
+        return EXIT_FAILURE;
+    }
+
+    if (iterations <= 0) {
+        g_printerr ("error: number of iterations must be greater than zero\n");
+        return EXIT_FAILURE;
+    }
+
+    for (i = 0; i < G_N_ELEMENTS (parser_entries); i++) {
+        if (filter && !strstr (parser_entries[i].name, filter))
+            continue;
+        benchmark_parser (&parser_entries[i]);
+    }
+
+    g_free (filter);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,50 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details:
+ *
+ * Copyright (C) 2026 The ModemManager authors
+ */
+
+/*
+ * libFuzzer entry point running every AT response parser in the shared
+ * parser table over the given input. Build with -Dfuzzer=true (requires clang) and run e.g.:
+ *
+ *   ./src/tests/fuzz-modem-helpers -max_len=4096 corpus/
+ */
+
+#include <glib.h>
+#include <glib-object.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "modem-helpers-parsers.h"
+#include "mm-log-test.h"
+
+int LLVMFuzzerTestOneInput (const uint8_t *data,
+                            size_t         size);
+
+int
+LLVMFuzzerTestOneInput (const uint8_t *data,
+                        size_t         size)
+{
+    g_autofree gchar *input = NULL;
+    guint             i;
+
+    /* All parsers expect a NUL-terminated string */
+    input = g_malloc (size + 1);
+    memcpy (input, data, size);
+    input[size] = '\0';
+
+    for (i = 0; i < G_N_ELEMENTS (parser_entries); i++)
+        parser_entries[i].run (input);
+
+    return 0;
+}
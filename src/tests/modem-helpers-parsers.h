@@ -0,0 +1,448 @@
+/* -*- Mode: C; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details:
+ *
+ * Copyright (C) 2026 The ModemManager authors
+ */
+
+/*
+ * Table of some of the core AT response parsers (none of the plugin
+ * helpers), shared by the parser benchmark and the fuzzer harness. Each entry runs one parser over an arbitrary input string
+ * and releases whatever the parser returned, so that the same runner can be
+ * used both with the well-formed corpus below and with random input.
+ *
+ * The corpus is a representative subset of the responses already used in
+ * test-modem-helpers.c; when a new parser or a new tricky response is added
+ * there, it should also be added here.
+ */
+
+#ifndef MM_TESTS_MODEM_HELPERS_PARSERS_H
+#define MM_TESTS_MODEM_HELPERS_PARSERS_H
+
+#include <glib.h>
+
+#define _LIBMM_INSIDE_MM
+#include <libmm-glib.h>
+#include "mm-modem-helpers.h"
+
+typedef void (* ParserRunFunc) (const gchar *input);
+
+typedef struct {
+    const gchar    *name;
+    ParserRunFunc   run;
+    const gchar    *corpus[5];
+} ParserEntry;
+
+/*****************************************************************************/
+
+static void
+run_ifc_test (const gchar *input)
+{
+    g_autoptr(GError) error = NULL;
+
+    mm_parse_ifc_test_response (input, NULL, &error);
+}
+
+static void
+run_ws46_test (const gchar *input)
+{
+    g_autoptr(GError) error = NULL;
+    GArray            *modes;
+
+    modes = mm_3gpp_parse_ws46_test_response (input, NULL, &error);
+    if (modes)
+        g_array_unref (modes);
+}
+
+static void
+run_cops_test (const gchar *input)
+{
+    g_autoptr(GError) error = NULL;
+    GList             *list;
+
+    list = mm_3gpp_parse_cops_test_response (input, MM_MODEM_CHARSET_GSM, NULL, &error);
+    mm_3gpp_network_info_list_free (list);
+}
+
+static void
+run_cops_read (const gchar *input)
+{
+    g_autoptr(GError)        error = NULL;
+    g_autofree gchar        *operator = NULL;
+    guint                    mode;
+    guint                    format;
+    MMModemAccessTechnology  act;
+
+    mm_3gpp_parse_cops_read_response (input, &mode, &format, &operator, &act, NULL, &error);
+}
+
+static void
+run_creg (const gchar *input)
+{
+    GPtrArray *array;
+    guint      i;
+
+    array = mm_3gpp_creg_regex_get (TRUE);
+    for (i = 0; i < array->len; i++) {
+        g_autoptr(GMatchInfo)         info = NULL;
+        g_autoptr(GError)             error = NULL;
+        MMModem3gppRegistrationState  state;
+        gulong                        lac;
+        gulong                        ci;
+        MMModemAccessTechnology       act;
+        gboolean                      cgreg;
+        gboolean                      cereg;
+        gboolean                      c5greg;
+
+        if (g_regex_match ((GRegex *) g_ptr_array_index (array, i), input, 0, &info)) {
+            mm_3gpp_parse_creg_response (info, NULL, &state, &lac, &ci, &act, &cgreg, &cereg, &c5greg, &error);
+            break;
+        }
+    }
+    mm_3gpp_creg_regex_destroy (array);
+}
+
+static void
+run_cgdcont_test (const gchar *input)
+{
+    g_autoptr(GError) error = NULL;
+    GList             *list;
+
+    list = mm_3gpp_parse_cgdcont_test_response (input, NULL, &error);
+    mm_3gpp_pdp_context_format_list_free (list);
+}
+
+static void
+run_cgdcont_read (const gchar *input)
+{
+    g_autoptr(GError) error = NULL;
+    GList             *list;
+
+    list = mm_3gpp_parse_cgdcont_read_response (input, &error);
+    mm_3gpp_pdp_context_list_free (list);
+}
+
+static void
+run_cgact_read (const gchar *input)
+{
+    g_autoptr(GError) error = NULL;
+    GList             *list;
+
+    list = mm_3gpp_parse_cgact_read_response (input, &error);
+    mm_3gpp_pdp_context_active_list_free (list);
+}
+
+static void
+run_cmgf_test (const gchar *input)
+{
+    g_autoptr(GError) error = NULL;
+    gboolean           pdu;
+    gboolean           text;
+
+    mm_3gpp_parse_cmgf_test_response (input, &pdu, &text, &error);
+}
+
+static void
+run_cpms_test (const gchar *input)
+{
+    g_autoptr(GError)  error = NULL;
+    g_autoptr(GArray)  mem1 = NULL;
+    g_autoptr(GArray)  mem2 = NULL;
+    g_autoptr(GArray)  mem3 = NULL;
+
+    mm_3gpp_parse_cpms_test_response (input, &mem1, &mem2, &mem3, &error);
+}
+
+static void
+run_cpms_query (const gchar *input)
+{
+    g_autoptr(GError) error = NULL;
+    MMSmsStorage       mem1;
+    MMSmsStorage       mem2;
+
+    mm_3gpp_parse_cpms_query_response (input, &mem1, &mem2, &error);
+}
+
+static void
+run_cscs_test (const gchar *input)
+{
+    MMModemCharset charsets;
+
+    mm_3gpp_parse_cscs_test_response (input, &charsets);
+}
+
+static void
+run_clck_test (const gchar *input)
+{
+    MMModem3gppFacility facilities;
+
+    mm_3gpp_parse_clck_test_response (input, &facilities);
+}
+
+static void
+run_cnum_exec (const gchar *input)
+{
+    g_auto(GStrv) numbers = NULL;
+
+    numbers = mm_3gpp_parse_cnum_exec_response (input);
+}
+
+static void
+run_cmer_test (const gchar *input)
+{
+    g_autoptr(GError) error = NULL;
+    MM3gppCmerMode     modes;
+    MM3gppCmerInd      inds;
+
+    mm_3gpp_parse_cmer_test_response (input, NULL, &modes, &inds, &error);
+}
+
+static void
+run_cind_test (const gchar *input)
+{
+    g_autoptr(GError) error = NULL;
+    GHashTable        *table;
+
+    table = mm_3gpp_parse_cind_test_response (input, &error);
+    if (table)
+        g_hash_table_destroy (table);
+}
+
+static void
+run_cind_read (const gchar *input)
+{
+    g_autoptr(GError) error = NULL;
+    GByteArray        *array;
+
+    array = mm_3gpp_parse_cind_read_response (input, &error);
+    if (array)
+        g_byte_array_unref (array);
+}
+
+static void
+run_cgev (const gchar *input)
+{
+    g_autoptr(GError)  error = NULL;
+    g_autofree gchar  *pdp_type = NULL;
+    g_autofree gchar  *pdp_addr = NULL;
+    MM3gppCgev         type;
+    guint              p_cid;
+    guint              cid;
+    guint              event_type;
+
+    type = mm_3gpp_parse_cgev_indication_action (input);
+    switch (type) {
+    case MM_3GPP_CGEV_REJECT:
+    case MM_3GPP_CGEV_NW_REACT:
+    case MM_3GPP_CGEV_NW_DEACT_PDP:
+    case MM_3GPP_CGEV_ME_DEACT_PDP:
+        mm_3gpp_parse_cgev_indication_pdp (input, type, &pdp_type, &pdp_addr, &cid, &error);
+        break;
+    case MM_3GPP_CGEV_NW_ACT_PRIMARY:
+    case MM_3GPP_CGEV_ME_ACT_PRIMARY:
+    case MM_3GPP_CGEV_NW_DEACT_PRIMARY:
+    case MM_3GPP_CGEV_ME_DEACT_PRIMARY:
+        mm_3gpp_parse_cgev_indication_primary (input, type, &cid, &error);
+        break;
+    case MM_3GPP_CGEV_NW_ACT_SECONDARY:
+    case MM_3GPP_CGEV_ME_ACT_SECONDARY:
+    case MM_3GPP_CGEV_NW_DEACT_SECONDARY:
+    case MM_3GPP_CGEV_ME_DEACT_SECONDARY:
+        mm_3gpp_parse_cgev_indication_secondary (input, type, &p_cid, &cid, &event_type, &error);
+        break;
+    default:
+        break;
+    }
+}
+
+static void
+run_cmgl_pdu (const gchar *input)
+{
+    g_autoptr(GError) error = NULL;
+    GList             *list;
+
+    list = mm_3gpp_parse_pdu_cmgl_response (input, &error);
+    mm_3gpp_pdu_info_list_free (list);
+}
+
+static void
+run_crsm (const gchar *input)
+{
+    g_autoptr(GError)  error = NULL;
+    g_autofree gchar  *hex = NULL;
+    guint              sw1;
+    guint              sw2;
+
+    mm_3gpp_parse_crsm_response (input, &sw1, &sw2, &hex, &error);
+}
+
+static void
+run_cgcontrdp (const gchar *input)
+{
+    g_autoptr(GError)  error = NULL;
+    g_autofree gchar  *apn = NULL;
+    g_autofree gchar  *local_address = NULL;
+    g_autofree gchar  *subnet = NULL;
+    g_autofree gchar  *gateway_address = NULL;
+    g_autofree gchar  *dns_primary_address = NULL;
+    g_autofree gchar  *dns_secondary_address = NULL;
+    guint              cid;
+    guint              bearer_id;
+
+    mm_3gpp_parse_cgcontrdp_response (input, &cid, &bearer_id, &apn,
+                                      &local_address, &subnet, &gateway_address,
+                                      &dns_primary_address, &dns_secondary_address,
+                                      &error);
+}
+
+static void
+run_cfun_query (const gchar *input)
+{
+    g_autoptr(GError) error = NULL;
+    guint              state;
+
+    mm_3gpp_parse_cfun_query_response (input, &state, &error);
+}
+
+static void
+run_cesq (const gchar *input)
+{
+    g_autoptr(GError) error = NULL;
+    guint              rxlev;
+    guint              ber;
+    guint              rscp;
+    guint              ecn0;
+    guint              rsrq;
+    guint              rsrp;
+
+    mm_3gpp_parse_cesq_response (input, &rxlev, &ber, &rscp, &ecn0, &rsrq, &rsrp, &error);
+}
+
+static void
+run_clcc (const gchar *input)
+{
+    g_autoptr(GError) error = NULL;
+    GList             *list = NULL;
+
+    mm_3gpp_parse_clcc_response (input, NULL, &list, &error);
+    mm_3gpp_call_info_list_free (list);
+}
+
+/*****************************************************************************/
+
+static const ParserEntry parser_entries[] = {
+    { "ifc-test", run_ifc_test, {
+        "+IFC (0-2),(0-2)",
+        "+IFC: (0,2),(0,2)",
+    } },
+    { "ws46-test", run_ws46_test, {
+        "+WS46: (12,22,25,28,29)",
+        "+WS46: (12,22,25,28,29,30,31)",
+    } },
+    { "cops-test", run_cops_test, {
+        "+COPS: (2,\"T-Mobile\",\"TMO\",\"31026\",0),(1,\"Cingular\",\"Cinglr\",\"310410\",2),(1,\"Cingular\",\"Cinglr\",\"310410\",0),,(0,1,2,3,4),(0,1,2)",
+        "+COPS: (2,\"\",\"T-Mobile\",\"31026\",0),(1,\"AT&T\",\"AT&T\",\"310410\",2),,(0,1,2,3,4),(0,1,2)",
+    } },
+    { "cops-read", run_cops_read, {
+        "+COPS: 1,0,\"CHINA MOBILE\",7",
+        "+COPS: 0,2,\"310410\",2",
+        "+COPS: 2",
+    } },
+    { "creg", run_creg, {
+        "\r\n+CREG: 2,1,\"CE00\",\"01CEAD8F\"\r\n",
+        "\r\n+CGREG: 2,1,\"31\",\"2c2a82\",7\r\n",
+        "\r\n+CEREG: 2,1,\"1F00\",\"79D903\",7\r\n",
+    } },
+    { "cgdcont-test", run_cgdcont_test, {
+        "+CGDCONT: (1-10),\"IP\",,,(0,1),(0,1)\r\n"
+        "+CGDCONT: (1-10),\"IPV6\",,,(0,1),(0,1)\r\n"
+        "+CGDCONT: (1-10),\"IPV4V6\",,,(0,1),(0,1)\r\n",
+    } },
+    { "cgdcont-read", run_cgdcont_read, {
+        "+CGDCONT: 1,\"IP\",\"nate.sktelecom.com\",\"\",0,0\r\n"
+        "+CGDCONT: 2,\"IPV6\",\"epc.tmobile.com\",\"\",0,0\r\n"
+        "+CGDCONT: 3,\"IPV4V6\",\"internet\",\"\",0,0\r\n",
+    } },
+    { "cgact-read", run_cgact_read, {
+        "+CGACT: 1,0\r\n"
+        "+CGACT: 2,1\r\n",
+    } },
+    { "cmgf-test", run_cmgf_test, {
+        "+CMGF: (0-1)",
+        "+CMGF: (0)",
+    } },
+    { "cpms-test", run_cpms_test, {
+        "+CPMS: (\"ME\",\"MT\"),(\"ME\",\"SM\",\"MT\"),(\"SM\",\"MT\")",
+        "+CPMS: \"ME\",\"MT\",\"SM\"",
+    } },
+    { "cpms-query", run_cpms_query, {
+        "+CPMS: \"ME\",1,100,\"MT\",5,100,\"TA\",1,100",
+    } },
+    { "cscs-test", run_cscs_test, {
+        "+CSCS: (\"IRA\",\"GSM\",\"UCS2\")",
+        "+CSCS: (\"8859-1\",\"IRA\",\"GSM\",\"PCCP437\",\"UCS2\")",
+    } },
+    { "clck-test", run_clck_test, {
+        "+CLCK: (\"SC\",\"AO\",\"OI\",\"OX\",\"AI\",\"IR\",\"AB\",\"AG\",\"AC\",\"PS\",\"FD\",\"PN\",\"PU\",\"PP\")",
+    } },
+    { "cnum-exec", run_cnum_exec, {
+        "+CNUM: \"Line 1\",\"+12345678901\",145\r\n"
+        "+CNUM: \"Line 2\",\"1234567890\",129\r\n",
+    } },
+    { "cmer-test", run_cmer_test, {
+        "+CMER: (0-3),(0),(0),(0-1),(0-1)",
+        "+CMER: (0-1),(0),(0),(0-2),(0-1)",
+    } },
+    { "cind-test", run_cind_test, {
+        "+CIND: (\"battchg\",(0-5)),(\"signal\",(0-5)),(\"service\",(0,1)),(\"call\",(0,1)),(\"roam\",(0,1)),(\"smsfull\",(0,1)),(\"callsetup\",(0-3))",
+    } },
+    { "cind-read", run_cind_read, {
+        "+CIND: 5,3,1,0,0,0,0",
+    } },
+    { "cgev", run_cgev, {
+        "+CGEV: NW DEACT IP, 123.123.123.123, 1",
+        "+CGEV: ME PDN ACT 2",
+        "+CGEV: NW ACT 1, 2, 3",
+        "+CGEV: NW DETACH",
+    } },
+    { "cmgl-pdu", run_cmgl_pdu, {
+        "+CMGL: 0,1,,147\r\n"
+        "07914306073011F00405812261F700003130916191314095C27"
+        "4D96D2FBBD3E437280CB2BEC961F3DB5D76818EF2F0381D9E83E06F39A8CC2E9FD372F"
+        "77BEE0249CBE37A594E0E83E2F532085E2F93CB73D0B93CA7A7DFEEB01C447F93DF731"
+        "0BD3E07CDCB727B7C9C7ECF41E432C8FC96B7C32079189E26874179D0F8DD7E93C3A0B"
+        "21B246AA641D637396C7EBBCB22D0FD7E77B5D376B3AB3C07\r\n",
+    } },
+    { "crsm", run_crsm, {
+        "+CRSM: 144,0,\"0054485552415941FFFFFFFFFFFFFFFFFF\"",
+        "+CRSM: 144,0,00FFFF",
+    } },
+    { "cgcontrdp", run_cgcontrdp, {
+        "+CGCONTRDP: 4,5,\"ibox.tim.it.mnc001.mcc222.gprs\",\"2.197.17.49.255.255.255.255\",\"2.197.17.49\",\"10.207.43.46\",\"10.206.56.132\",\"0.0.0.0\",\"0.0.0.0\",0",
+        "+CGCONTRDP: 1,5,\"internet.mnc001.mcc222.gprs\",\"10.0.0.2\",\"10.0.0.1\",\"8.8.8.8\",\"8.8.4.4\"",
+    } },
+    { "cfun-query", run_cfun_query, {
+        "+CFUN: 1",
+        "+CFUN: 4,0",
+    } },
+    { "cesq", run_cesq, {
+        "+CESQ: 99,99,255,255,20,80",
+        "+CESQ: 10,6,255,255,255,255",
+    } },
+    { "clcc", run_clcc, {
+        "+CLCC: 1,1,0,0,0,\"123456789\",161\r\n",
+        "+CLCC: 1,1,0,0,0,\"123456789\",161\r\n"
+        "+CLCC: 2,1,0,0,0,\"987654321\",161\r\n"
+        "+CLCC: 3,0,0,1,0,\"555555555\",161\r\n",
+    } },
+};
+
+#endif /* MM_TESTS_MODEM_HELPERS_PARSERS_H */
@@ -22,6 +22,7 @@
 #define _LIBMM_INSIDE_MM
 #include <libmm-glib.h>
 #include "mm-modem-helpers.h"
+#include "mm-regex.h"
 #include "mm-log-test.h"
 
 #define g_assert_cmpfloat_tolerance(val1, val2, tolerance)  \
@@ -2139,6 +2140,23 @@ test_cind_response_moto_v3m (void *f, gpointer d)
     test_cind_results ("Motorola V3m", reply, &expected[0], G_N_ELEMENTS (expected));
 }
 
+static void
+test_cind_read_response (void *f, gpointer d)
+{
+    const gchar          *reply = "+CIND: 5,3,0,0,1,0,0\r\n";
+    static const guint8   expected[] = { 0, 5, 3, 0, 0, 1, 0, 0 };
+    g_autoptr(GByteArray) array = NULL;
+    g_autoptr(GError)     error = NULL;
+    guint                 i;
+
+    array = mm_3gpp_parse_cind_read_response (reply, &error);
+    g_assert_no_error (error);
+    g_assert (array);
+    g_assert_cmpuint (array->len, ==, G_N_ELEMENTS (expected));
+    for (i = 0; i < G_N_ELEMENTS (expected); i++)
+        g_assert_cmpuint (array->data[i], ==, expected[i]);
+}
+
 /*****************************************************************************/
 /* Test +CGEV indication parsing */
 
@@ -3717,6 +3735,42 @@ test_crsm_response (void)
     }
 }
 
+static void
+test_crsm_split_responses (void)
+{
+    g_autoptr(GError)  error = NULL;
+    g_auto(GStrv)      responses = NULL;
+    const gchar       *reply =
+        "+CRSM: 144,0,\"00000002\"\r\n"
+        "\r\n"
+        "+CRSM: 144,0,\"0054485552415941FFFFFFFFFFFFFFFFFF\"\r\n"
+        "+CRSM: 106,130,\"\"";
+
+    responses = mm_3gpp_split_crsm_responses (reply, &error);
+    g_assert_no_error (error);
+    g_assert_nonnull (responses);
+    g_assert_cmpuint (g_strv_length (responses), ==, 3);
+    g_assert_cmpstr (responses[0], ==, "+CRSM: 144,0,\"00000002\"");
+    g_assert_cmpstr (responses[1], ==, "+CRSM: 144,0,\"0054485552415941FFFFFFFFFFFFFFFFFF\"");
+    g_assert_cmpstr (responses[2], ==, "+CRSM: 106,130,\"\"");
+}
+
+static void
+test_crsm_split_responses_unexpected (void)
+{
+    g_autoptr(GError) error = NULL;
+    g_auto(GStrv)     responses = NULL;
+
+    responses = mm_3gpp_split_crsm_responses ("+CRSM: 144,0,\"00000002\"\r\n+CME ERROR: 10", &error);
+    g_assert_error (error, MM_CORE_ERROR, MM_CORE_ERROR_FAILED);
+    g_assert_null (responses);
+
+    g_clear_error (&error);
+    responses = mm_3gpp_split_crsm_responses ("", &error);
+    g_assert_error (error, MM_CORE_ERROR, MM_CORE_ERROR_FAILED);
+    g_assert_null (responses);
+}
+
 /*****************************************************************************/
 /* Test CGCONTRDP=N responses */
 
@@ -4603,6 +4657,156 @@ test_cpol_response (void)
     }
 }
 
+static void
+test_cpol_test_response (void)
+{
+    guint    min_index = 0;
+    guint    max_index = 0;
+    gboolean result;
+    GError  *error = NULL;
+
+    result = mm_sim_parse_cpol_test_response ("+CPOL: (1-50),(0-2)", &min_index, &max_index, &error);
+    g_assert_no_error (error);
+    g_assert (result);
+    g_assert_cmpuint (min_index, ==, 1);
+    g_assert_cmpuint (max_index, ==, 50);
+
+    result = mm_sim_parse_cpol_test_response ("+CPOL: 1,2", &min_index, &max_index, &error);
+    g_assert_error (error, MM_CORE_ERROR, MM_CORE_ERROR_FAILED);
+    g_assert (!result);
+    g_clear_error (&error);
+}
+
+/*****************************************************************************/
+/* Test +CLCK responses */
+
+static void
+test_clck_test_response (void)
+{
+    MMModem3gppFacility facilities = MM_MODEM_3GPP_FACILITY_NONE;
+
+    g_assert (mm_3gpp_parse_clck_test_response ("+CLCK: (\"SC\",\"AO\",\"AI\",\"PN\")", &facilities));
+    g_assert_cmpuint (facilities, ==, (MM_MODEM_3GPP_FACILITY_SIM | MM_MODEM_3GPP_FACILITY_NET_PERS));
+}
+
+static void
+test_clck_write_response (void)
+{
+    gboolean enabled = FALSE;
+
+    g_assert (mm_3gpp_parse_clck_write_response ("+CLCK: 1", &enabled));
+    g_assert (enabled);
+    g_assert (mm_3gpp_parse_clck_write_response ("+CLCK: 0", &enabled));
+    g_assert (!enabled);
+    g_assert (!mm_3gpp_parse_clck_write_response ("+CLCK: ", &enabled));
+}
+
+/*****************************************************************************/
+/* Test +CMGF=? responses */
+
+static void
+test_cmgf_test_response (void)
+{
+    gboolean pdu = FALSE;
+    gboolean text = FALSE;
+    GError  *error = NULL;
+
+    g_assert (mm_3gpp_parse_cmgf_test_response ("+CMGF: (0-1)", &pdu, &text, &error));
+    g_assert_no_error (error);
+    g_assert (pdu);
+    g_assert (text);
+
+    g_assert (mm_3gpp_parse_cmgf_test_response ("+CMGF: (1)", &pdu, &text, &error));
+    g_assert_no_error (error);
+    g_assert (!pdu);
+    g_assert (text);
+}
+
+/*****************************************************************************/
+/* Test +CRM=? responses */
+
+static void
+test_crm_test_response (void)
+{
+    MMModemCdmaRmProtocol  min = MM_MODEM_CDMA_RM_PROTOCOL_UNKNOWN;
+    MMModemCdmaRmProtocol  max = MM_MODEM_CDMA_RM_PROTOCOL_UNKNOWN;
+    gboolean               result;
+    GError                *error = NULL;
+
+    result = mm_cdma_parse_crm_test_response ("+CRM: (1-2)", &min, &max, &error);
+    g_assert_no_error (error);
+    g_assert (result);
+    g_assert_cmpuint (min, ==, MM_MODEM_CDMA_RM_PROTOCOL_PACKET_RELAY);
+    g_assert_cmpuint (max, ==, MM_MODEM_CDMA_RM_PROTOCOL_PACKET_NETWORK_PPP);
+
+    /* Index 0 is not a valid lower bound */
+    result = mm_cdma_parse_crm_test_response ("+CRM: (0-2)", &min, &max, &error);
+    g_assert_error (error, MM_CORE_ERROR, MM_CORE_ERROR_FAILED);
+    g_assert (!result);
+    g_clear_error (&error);
+}
+
+/*****************************************************************************/
+/* Test regex registry */
+
+static void
+test_regex_registry (void)
+{
+    g_autoptr(GRegex)        r1 = NULL;
+    g_autoptr(GRegex)        r2 = NULL;
+    g_autoptr(GError)        error = NULL;
+    g_autofree gchar        *operator = NULL;
+    guint                    n_compilations;
+    guint                    mode;
+    guint                    format;
+    MMModemAccessTechnology  act;
+    gboolean                 result;
+
+    mm_modem_helpers_warm_up ();
+    n_compilations = mm_regex_get_n_compilations ();
+    g_assert_cmpuint (n_compilations, >, 0);
+
+    /* Warming up again must not compile anything */
+    mm_modem_helpers_warm_up ();
+    g_assert_cmpuint (mm_regex_get_n_compilations (), ==, n_compilations);
+
+    /* Neither must parsing with an already compiled pattern */
+    result = mm_3gpp_parse_cops_read_response ("+COPS: 1,0,\"CHINA MOBILE\",7",
+                                               &mode, &format, &operator, &act, NULL, &error);
+    g_assert_no_error (error);
+    g_assert (result);
+    g_assert_cmpuint (mm_regex_get_n_compilations (), ==, n_compilations);
+
+    /* New patterns are compiled only once and shared afterwards */
+    r1 = mm_regex_get ("\\+TEST:\\s*(\\d+)", G_REGEX_RAW, 0);
+    g_assert_cmpuint (mm_regex_get_n_compilations (), ==, n_compilations + 1);
+    r2 = mm_regex_get ("\\+TEST:\\s*(\\d+)", G_REGEX_RAW, 0);
+    g_assert_cmpuint (mm_regex_get_n_compilations (), ==, n_compilations + 1);
+    g_assert (r1 == r2);
+}
+
+/*****************************************************************************/
+/* Test regex warm-up coverage */
+
+static guint n_warm_up_compilations;
+
+static void
+test_regex_warm_up_coverage (void)
+{
+    g_auto(GStrv) unrequested = NULL;
+    guint         i;
+
+    /* All the previous tests ran after the warm-up done in main(), so none of
+     * the parsers they exercised must have needed a new compilation... */
+    g_assert_cmpuint (mm_regex_get_n_compilations (), ==, n_warm_up_compilations);
+
+    /* ...and each warmed pattern must have been requested by one of them */
+    unrequested = mm_regex_list_unrequested ();
+    for (i = 0; unrequested[i]; i++)
+        g_test_message ("warmed pattern never requested: %s", unrequested[i]);
+    g_assert_cmpuint (g_strv_length (unrequested), ==, 0);
+}
+
 /*****************************************************************************/
 
 #define TESTCASE(t, d) g_test_create_case (#t, 0, d, NULL, (GTestFixtureFunc) t, NULL)
@@ -4616,6 +4820,11 @@ int main (int argc, char **argv)
 
     g_test_init (&argc, &argv, NULL);
 
+    /* Warm up before running any parser, so that the coverage test can
+     * validate the warm-up table against the real call sites */
+    mm_modem_helpers_warm_up ();
+    n_warm_up_compilations = mm_regex_get_n_compilations ();
+
     suite = g_test_get_root ();
     reg_data = reg_test_data_new ();
 
@@ -4739,6 +4948,7 @@ int main (int argc, char **argv)
 
     g_test_suite_add (suite, TESTCASE (test_cind_response_linktop_lw273, NULL));
     g_test_suite_add (suite, TESTCASE (test_cind_response_moto_v3m, NULL));
+    g_test_suite_add (suite, TESTCASE (test_cind_read_response, NULL));
 
     g_test_suite_add (suite, TESTCASE (test_cgev_indication, NULL));
 
@@ -4811,6 +5021,8 @@ int main (int argc, char **argv)
     g_test_suite_add (suite, TESTCASE (test_cclk_response, NULL));
 
     g_test_suite_add (suite, TESTCASE (test_crsm_response, NULL));
+    g_test_suite_add (suite, TESTCASE (test_crsm_split_responses, NULL));
+    g_test_suite_add (suite, TESTCASE (test_crsm_split_responses_unexpected, NULL));
 
     g_test_suite_add (suite, TESTCASE (test_cgcontrdp_response, NULL));
 
@@ -4839,6 +5051,19 @@ int main (int argc, char **argv)
     g_test_suite_add (suite, TESTCASE (test_bcd_to_string, NULL));
 
     g_test_suite_add (suite, TESTCASE (test_cpol_response, NULL));
+    g_test_suite_add (suite, TESTCASE (test_cpol_test_response, NULL));
+
+    g_test_suite_add (suite, TESTCASE (test_clck_test_response, NULL));
+    g_test_suite_add (suite, TESTCASE (test_clck_write_response, NULL));
+
+    g_test_suite_add (suite, TESTCASE (test_cmgf_test_response, NULL));
+
+    g_test_suite_add (suite, TESTCASE (test_crm_test_response, NULL));
+
+    /* Must run after all the parser tests, and before the registry test
+     * compiles its own patterns */
+    g_test_suite_add (suite, TESTCASE (test_regex_warm_up_coverage, NULL));
+    g_test_suite_add (suite, TESTCASE (test_regex_registry, NULL));
 
     result = g_test_run ();
 